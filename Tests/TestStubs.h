@@ -198,6 +198,16 @@ namespace RE {
         float entry[3][3] = {{1,0,0}, {0,1,0}, {0,0,1}};
     };
 
+    // === NiQuaternion Stub ===
+    struct NiQuaternion {
+        NiQuaternion() = default;
+        NiQuaternion(float a_w, float a_x, float a_y, float a_z) : w(a_w), x(a_x), y(a_y), z(a_z) {}
+        float w = 0.0f;
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+    };
+
     // === NiTransform Stub ===
     struct NiTransform {
         NiMatrix3 rotate;
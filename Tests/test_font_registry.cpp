@@ -0,0 +1,192 @@
+#include <catch2/catch_all.hpp>
+
+#include "projectile/FontRegistry.h"
+#include "projectile/TextLayout.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Projectile;
+using Catch::Approx;
+
+// ============================================================================
+// Font Registry Tests
+// Fixtures in Tests/fixtures/fonts: a Latin font with kerning, a Cyrillic one that also
+// has its own 'A', each falling back to the other, plus a row with missing metrics and
+// one naming an unknown fallback.
+// ============================================================================
+
+namespace {
+    const std::filesystem::path FONT_FIXTURES = std::filesystem::path(TEST_FIXTURES_DIR) / "fonts";
+
+    constexpr FontId LATIN = 0;
+    constexpr FontId CYRILLIC = 1;
+    constexpr float L = TextAssets::BASE_LETTER_DISTANCE;
+
+    void LoadFixtureFonts(FontRegistry& fonts, std::vector<std::string>* errors = nullptr) {
+        std::ifstream manifest(FONT_FIXTURES / "fonts.csv");
+        REQUIRE(manifest.is_open());
+        fonts.LoadManifest(manifest, FONT_FIXTURES, errors);
+        REQUIRE(fonts.GetFontCount() == 3);
+    }
+
+    TextLayoutParams LeftAligned(FontId font = LATIN) {
+        TextLayoutParams params;
+        params.alignment = TextAlignment::Left;
+        params.font = font;
+        return params;
+    }
+}
+
+TEST_CASE("KerningTable parses pair adjustments", "[fonts]") {
+    std::ifstream in(FONT_FIXTURES / "latin_kerning.csv");
+    auto kerning = KerningTable::ParseCSV(in);
+    REQUIRE(kerning);
+
+    // The row with bare characters instead of U+XXXX is skipped
+    REQUIRE(kerning->Size() == 3);
+    REQUIRE(kerning->Get(L'A', L'V') == Approx(-0.12f));
+    REQUIRE(kerning->Get(L'T', L'o') == Approx(-0.08f));
+    REQUIRE(kerning->Get(L'o', L'T') == 0.0f);
+    REQUIRE(kerning->Get(L'V', L'V') == 0.0f);
+
+    // Later duplicates win
+    KerningTable table({{1, 2, 0.1f}, {3, 4, 0.3f}, {1, 2, 0.2f}});
+    REQUIRE(table.Size() == 2);
+    REQUIRE(table.Get(1, 2) == Approx(0.2f));
+
+    std::istringstream empty("");
+    REQUIRE_FALSE(KerningTable::ParseCSV(empty));
+    REQUIRE(KerningTable().Get(1, 2) == 0.0f);
+}
+
+TEST_CASE("FontRegistry loads fonts from a manifest", "[fonts]") {
+    FontRegistry fonts;
+    std::vector<std::string> errors;
+    LoadFixtureFonts(fonts, &errors);
+
+    REQUIRE(fonts.FindFont("latin") == LATIN);
+    REQUIRE(fonts.FindFont("cyrillic") == CYRILLIC);
+    REQUIRE(fonts.FindFont("broken") == FontRegistry::INVALID_FONT);
+
+    const auto& latin = fonts.GetFont(LATIN);
+    REQUIRE(latin.atlasPath == "textures\\3DUI\\fonts\\latin.dds");
+    REQUIRE(latin.metrics.GetGlyphCount() == 7);
+    REQUIRE(latin.kerning.Size() == 3);
+    REQUIRE(latin.fallbacks == std::vector<FontId>{CYRILLIC});
+    REQUIRE(fonts.GetFont(CYRILLIC).fallbacks == std::vector<FontId>{LATIN});
+
+    // Unknown fallbacks are dropped, the rest kept
+    FontId mono = fonts.FindFont("mono");
+    REQUIRE(fonts.GetFont(mono).kerning.Empty());
+    REQUIRE(fonts.GetFont(mono).fallbacks == std::vector<FontId>{LATIN});
+
+    // Missing metrics file and unknown fallback
+    REQUIRE(errors.size() == 2);
+
+    // Loading again adds nothing
+    std::ifstream manifest(FONT_FIXTURES / "fonts.csv");
+    REQUIRE(fonts.LoadManifest(manifest, FONT_FIXTURES).empty());
+    REQUIRE(fonts.GetFontCount() == 3);
+}
+
+TEST_CASE("FontRegistry resolves characters through fallback chains", "[fonts]") {
+    FontRegistry fonts;
+    LoadFixtureFonts(fonts);
+
+    // Each font prefers its own glyph
+    auto latinA = fonts.Resolve(LATIN, L'A');
+    REQUIRE(latinA.font == LATIN);
+    REQUIRE(latinA.glyph->widthRatio == Approx(0.7f));
+    REQUIRE(fonts.Resolve(CYRILLIC, L'A').font == CYRILLIC);
+
+    // Missing characters come from the chain, the same way every time
+    auto zhe = fonts.Resolve(LATIN, 0x436);
+    REQUIRE(zhe.font == CYRILLIC);
+    REQUIRE(zhe.glyph == fonts.GetFont(CYRILLIC).metrics.Find(0x436));
+    REQUIRE(fonts.Resolve(LATIN, 0x436).glyph == zhe.glyph);
+    REQUIRE(fonts.Resolve(CYRILLIC, L'T').font == LATIN);
+
+    // Latin and Cyrillic fall back to each other - a character in neither terminates
+    auto missing = fonts.Resolve(CYRILLIC, L'#');
+    REQUIRE(missing.glyph == nullptr);
+    REQUIRE(missing.font == FontRegistry::INVALID_FONT);
+
+    // Changing a chain drops cached resolutions
+    fonts.SetFallbacks(LATIN, {});
+    REQUIRE(fonts.Resolve(LATIN, 0x436).glyph == nullptr);
+}
+
+TEST_CASE("TextLayout kerns adjacent glyphs of the same font", "[fonts][text]") {
+    FontRegistry fonts;
+    LoadFixtureFonts(fonts);
+
+    auto kerned = TextLayout::Compute(L"AV", LeftAligned(), fonts);
+    REQUIRE(kerned.glyphs[1].x == Approx(L * (0.7f + TextAssets::CHAR_GAP - 0.12f)));
+    REQUIRE(kerned.fonts == std::vector<FontId>{LATIN});
+
+    // Whitespace breaks the pair
+    auto spaced = TextLayout::Compute(L"A V", LeftAligned(), fonts);
+    REQUIRE(spaced.glyphs[1].x == Approx(L * (0.7f + 0.3f + 2 * TextAssets::CHAR_GAP)));
+
+    // Fallback glyphs are kerned with their own font's pairs, never across fonts
+    auto cyrillic = TextLayout::Compute(L"A\u0436\u044F", LeftAligned(), fonts);
+    REQUIRE(cyrillic.glyphs[0].font == LATIN);
+    REQUIRE(cyrillic.glyphs[1].font == CYRILLIC);
+    REQUIRE(cyrillic.glyphs[1].x == Approx(L * (0.7f + TextAssets::CHAR_GAP)));
+    REQUIRE(cyrillic.glyphs[2].x == Approx(cyrillic.glyphs[1].x + L * (0.8f + TextAssets::CHAR_GAP - 0.05f)));
+    REQUIRE(cyrillic.fonts == std::vector<FontId>{LATIN, CYRILLIC});
+
+    // Unknown font IDs lay out in the first font
+    auto unknown = TextLayout::Compute(L"AV", LeftAligned(FontId(42)), fonts);
+    REQUIRE(unknown.glyphs[1].x == Approx(kerned.glyphs[1].x));
+}
+
+TEST_CASE("TextLayoutCache keys layouts by font", "[fonts][text]") {
+    FontRegistry fonts;
+    LoadFixtureFonts(fonts);
+    TextLayoutCache cache(&fonts, 8);
+
+    auto latin = cache.Get(L"A", LeftAligned(LATIN));
+    auto cyrillic = cache.Get(L"A", LeftAligned(CYRILLIC));
+    REQUIRE(latin != cyrillic);
+    REQUIRE(latin->glyphs[0].widthRatio == Approx(0.7f));
+    REQUIRE(cyrillic->glyphs[0].widthRatio == Approx(0.65f));
+    REQUIRE(cache.Get(L"A", LeftAligned(CYRILLIC)) == cyrillic);
+}
+
+TEST_CASE("PlanGlyphNodeUpdates rebinds atlases only when a node's font changes", "[fonts][text]") {
+    FontRegistry fonts;
+    LoadFixtureFonts(fonts);
+    auto mixed = TextLayout::Compute(L"A\u0436", LeftAligned(), fonts);
+    auto latin = TextLayout::Compute(L"AA", LeftAligned(), fonts);
+
+    std::vector<GlyphNodeState> states(2);
+    std::vector<GlyphNodeUpdate> updates;
+    PlanGlyphNodeUpdates(mixed, states, updates);
+    REQUIRE(updates.size() == 2);
+    REQUIRE_FALSE(updates[0].ops & GlyphNodeUpdate::SetFont);
+    REQUIRE(updates[1].ops & GlyphNodeUpdate::SetFont);
+    REQUIRE(states[1].font == CYRILLIC);
+
+    // Nodes written from scratch (shown again) keep their material's font
+    for (auto& state : states) {
+        FontId font = state.font;
+        state = GlyphNodeState{};
+        state.font = font;
+    }
+    updates.clear();
+    PlanGlyphNodeUpdates(mixed, states, updates);
+    REQUIRE(updates.size() == 2);
+    REQUIRE_FALSE(updates[1].ops & GlyphNodeUpdate::SetFont);
+
+    // Back to the Latin atlas
+    updates.clear();
+    PlanGlyphNodeUpdates(latin, states, updates);
+    REQUIRE(updates.size() == 1);
+    REQUIRE(updates[0].node == 1);
+    REQUIRE(updates[0].ops == (GlyphNodeUpdate::SetFont | GlyphNodeUpdate::SetUV));
+}
@@ -0,0 +1,177 @@
+#include <catch2/catch_all.hpp>
+
+#include "projectile/FormManager.h"
+
+#include <string>
+#include <vector>
+
+using namespace Projectile;
+
+// ============================================================================
+// FormManager Tests
+// ============================================================================
+
+namespace {
+    // FormManager over `count` stub forms
+    struct FormFixture {
+        std::vector<RE::BGSProjectile> projForms;
+        std::vector<RE::TESAmmo> ammoForms;
+        FormManager manager;
+
+        explicit FormFixture(size_t count) : projForms(count), ammoForms(count) {
+            std::vector<RE::BGSProjectile*> projPtrs;
+            std::vector<RE::TESAmmo*> ammoPtrs;
+            for (size_t i = 0; i < count; ++i) {
+                projPtrs.push_back(&projForms[i]);
+                ammoPtrs.push_back(&ammoForms[i]);
+            }
+            manager.Initialize(std::move(projPtrs), std::move(ammoPtrs));
+        }
+    };
+}
+
+TEST_CASE("FormManager shares forms between instances of a model", "[forms]") {
+    FormFixture fixture(2);
+    auto& manager = fixture.manager;
+
+    int a = manager.AcquireForm("a.nif");
+    REQUIRE(a >= 0);
+    REQUIRE(manager.AcquireForm("a.nif") == a);
+    REQUIRE(manager.GetFormSlot(a)->refCount == 2);
+    REQUIRE(fixture.ammoForms[a].GetModel() == "a.nif");
+
+    auto stats = manager.GetStats();
+    REQUIRE(stats.misses == 1);
+    REQUIRE(stats.hits == 1);
+    REQUIRE(manager.GetUsedForms() == 1);
+}
+
+TEST_CASE("FormManager keeps idle models and evicts the least recently used", "[forms]") {
+    FormFixture fixture(2);
+    auto& manager = fixture.manager;
+
+    int a = manager.AcquireForm("a.nif");
+    int b = manager.AcquireForm("b.nif");
+    manager.ReleaseForm(a);
+    manager.ReleaseForm(b);
+    REQUIRE(manager.GetIdleForms() == 2);
+    REQUIRE(manager.GetFreeForms() == 2);
+
+    SECTION("Re-showing an idle model is a hit") {
+        REQUIRE(manager.AcquireForm("a.nif") == a);
+        REQUIRE(manager.GetStats().hits == 1);
+        REQUIRE(manager.GetStats().evictions == 0);
+        REQUIRE(manager.GetIdleForms() == 1);
+    }
+
+    SECTION("A new model evicts the idle form released first") {
+        REQUIRE(manager.AcquireForm("c.nif") == a);
+        REQUIRE(fixture.projForms[a].data.model == "c.nif");
+        REQUIRE(manager.GetStats().evictions == 1);
+
+        // a was evicted, b is still cached
+        REQUIRE(manager.AcquireForm("b.nif") == b);
+        REQUIRE(manager.GetStats().hits == 1);
+    }
+
+    SECTION("Acquiring an idle model refreshes its LRU position") {
+        manager.ReleaseForm(manager.AcquireForm("a.nif"));
+        REQUIRE(manager.AcquireForm("c.nif") == b);
+    }
+}
+
+TEST_CASE("FormManager prefers never-used forms over evicting", "[forms]") {
+    FormFixture fixture(2);
+    auto& manager = fixture.manager;
+
+    int a = manager.AcquireForm("a.nif");
+    manager.ReleaseForm(a);
+
+    int b = manager.AcquireForm("b.nif");
+    REQUIRE(b != a);
+    REQUIRE(manager.GetStats().evictions == 0);
+    REQUIRE(manager.AcquireForm("a.nif") == a);
+}
+
+TEST_CASE("FormManager counts exhaustion", "[forms]") {
+    FormFixture fixture(1);
+    auto& manager = fixture.manager;
+
+    int a = manager.AcquireForm("a.nif");
+    REQUIRE(manager.AcquireForm("b.nif") == -1);
+    REQUIRE(manager.GetStats().exhaustions == 1);
+
+    manager.ReleaseForm(a);
+    REQUIRE(manager.AcquireForm("b.nif") == a);
+    REQUIRE(manager.GetStats().evictions == 1);
+    REQUIRE(manager.GetStats().exhaustions == 1);
+}
+
+TEST_CASE("FormManager counters stay consistent under churn", "[forms]") {
+    FormFixture fixture(8);
+    auto& manager = fixture.manager;
+
+    // 12 models over 8 forms, acquired and released in a fixed pseudo-random order
+    std::vector<std::string> models;
+    for (int i = 0; i < 12; ++i) {
+        models.push_back("model" + std::to_string(i) + ".nif");
+    }
+    std::vector<int> held;
+    uint32_t seed = 12345;
+    for (int step = 0; step < 2000; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        if (!held.empty() && (seed >> 16) % 3 == 0) {
+            size_t pick = (seed >> 8) % held.size();
+            manager.ReleaseForm(held[pick]);
+            held.erase(held.begin() + pick);
+        } else {
+            int form = manager.AcquireForm(models[(seed >> 16) % models.size()]);
+            if (form >= 0) {
+                held.push_back(form);
+            }
+        }
+
+        size_t used = 0, idle = 0;
+        for (size_t i = 0; i < manager.GetTotalForms(); ++i) {
+            const auto* slot = manager.GetFormSlot(static_cast<int>(i));
+            used += slot->refCount > 0;
+            idle += slot->refCount == 0 && !slot->assignedModel.empty();
+        }
+        REQUIRE(manager.GetUsedForms() == used);
+        REQUIRE(manager.GetFreeForms() == manager.GetTotalForms() - used);
+        REQUIRE(manager.GetIdleForms() == idle);
+    }
+
+    auto stats = manager.GetStats();
+    REQUIRE(stats.hits + stats.misses + stats.exhaustions > 0);
+    REQUIRE(stats.evictions <= stats.misses);
+}
+
+// ============================================================================
+// Benchmark: acquire/release cycles as menus open and close
+// Hidden from the default run - run: 3DUITests "[benchmark]"
+// ============================================================================
+
+TEST_CASE("FormManager acquire/release throughput", "[.][benchmark][forms]") {
+    FormFixture fixture(200);
+    auto& manager = fixture.manager;
+
+    // A menu of 40 items over 30 distinct models, opened and closed repeatedly
+    std::vector<std::string> models;
+    for (int i = 0; i < 40; ++i) {
+        models.push_back("meshes\\3DUI\\icons\\icon" + std::to_string(i % 30) + ".nif");
+    }
+    std::vector<int> forms(models.size());
+
+    BENCHMARK("Open + close 40 items x100") {
+        for (int cycle = 0; cycle < 100; ++cycle) {
+            for (size_t i = 0; i < models.size(); ++i) {
+                forms[i] = manager.AcquireForm(models[i]);
+            }
+            for (int form : forms) {
+                manager.ReleaseForm(form);
+            }
+        }
+        return forms[0];
+    };
+}
@@ -0,0 +1,157 @@
+#include <catch2/catch_all.hpp>
+
+#include "projectile/FrameProfiler.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace Projectile;
+using namespace std::chrono_literals;
+
+// ============================================================================
+// FrameProfiler Tests
+// ============================================================================
+
+TEST_CASE("FrameProfiler percentiles per owner", "[profiler]") {
+    FrameProfiler profiler;
+    int menuA = 0, menuB = 0;  // Any stable address works as an owner
+    profiler.SetOwnerName(&menuA, "ModA_Menu");
+    profiler.SetOwnerName(&menuB, "ModB_Menu");
+
+    // 100 frames: menu A costs 1..100us, menu B a flat 5us
+    for (int frame = 1; frame <= 100; ++frame) {
+        profiler.Record(ProfileScope::DriverUpdate, &menuA, std::chrono::microseconds(frame));
+        profiler.Record(ProfileScope::DriverUpdate, &menuB, 5us);
+        profiler.EndFrame();
+    }
+
+    auto a = profiler.Query(&menuA, ProfileScope::DriverUpdate);
+    REQUIRE(a.frameCount == 100);
+    REQUIRE(a.p50Us == Catch::Approx(50.0f));
+    REQUIRE(a.p95Us == Catch::Approx(95.0f));
+    REQUIRE(a.p99Us == Catch::Approx(99.0f));
+    REQUIRE(a.maxUs == Catch::Approx(100.0f));
+
+    auto b = profiler.Query(&menuB, ProfileScope::DriverUpdate);
+    REQUIRE(b.p99Us == Catch::Approx(5.0f));
+
+    SECTION("Report lists the most expensive owner first") {
+        auto report = profiler.GetReport();
+        REQUIRE(report.size() == 2);
+        REQUIRE(report[0].name == "ModA_Menu");
+        REQUIRE(!profiler.FormatReport().empty());
+    }
+
+    SECTION("Unrecorded scopes report nothing") {
+        REQUIRE(profiler.Query(&menuA, ProfileScope::Layout).frameCount == 0);
+    }
+}
+
+TEST_CASE("FrameProfiler sums samples within a frame", "[profiler]") {
+    FrameProfiler profiler;
+    int menu = 0;
+    profiler.SetOwnerName(&menu, "Menu");
+
+    // Three sub-driver layouts in one frame count as one 30us frame
+    for (int i = 0; i < 3; ++i) {
+        profiler.Record(ProfileScope::Layout, &menu, 10us);
+    }
+    profiler.EndFrame();
+
+    auto stats = profiler.Query(&menu, ProfileScope::Layout);
+    REQUIRE(stats.frameCount == 1);
+    REQUIRE(stats.p50Us == Catch::Approx(30.0f));
+}
+
+TEST_CASE("FrameProfiler window rolls over", "[profiler]") {
+    FrameProfiler profiler;
+    for (size_t frame = 0; frame < FrameProfiler::WINDOW_FRAMES; ++frame) {
+        profiler.Record(ProfileScope::Frame, nullptr, 1000us);
+        profiler.EndFrame();
+    }
+    for (size_t frame = 0; frame < FrameProfiler::WINDOW_FRAMES; ++frame) {
+        profiler.Record(ProfileScope::Frame, nullptr, 2us);
+        profiler.EndFrame();
+    }
+
+    // Old frames have been fully replaced (the global owner needs no name)
+    auto stats = profiler.Query(nullptr, ProfileScope::Frame);
+    REQUIRE(stats.frameCount == FrameProfiler::WINDOW_FRAMES);
+    REQUIRE(stats.maxUs == Catch::Approx(2.0f));
+}
+
+TEST_CASE("FrameProfiler owner lifetime", "[profiler]") {
+    FrameProfiler profiler;
+    int menu = 0;
+
+    SECTION("Samples of unnamed owners are discarded") {
+        profiler.Record(ProfileScope::DriverUpdate, &menu, 10us);
+        profiler.EndFrame();
+        REQUIRE(profiler.GetReport().empty());
+    }
+
+    SECTION("Late samples don't resurrect a forgotten owner") {
+        profiler.SetOwnerName(&menu, "Menu");
+        profiler.Record(ProfileScope::DriverUpdate, &menu, 10us);
+        profiler.ForgetOwner(&menu);
+        profiler.EndFrame();
+        REQUIRE(profiler.Query(&menu, ProfileScope::DriverUpdate).frameCount == 0);
+        REQUIRE(profiler.GetReport().empty());
+    }
+}
+
+TEST_CASE("FrameProfiler collects from several threads", "[profiler]") {
+    FrameProfiler profiler;
+    int menu = 0;
+    profiler.SetOwnerName(&menu, "Menu");
+
+    constexpr int threads = 4;
+    constexpr int samplesPerThread = 500;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&]() {
+            for (int i = 0; i < samplesPerThread; ++i) {
+                profiler.Record(ProfileScope::Hook, &menu, 1us);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    profiler.EndFrame();
+
+    auto stats = profiler.Query(&menu, ProfileScope::Hook);
+    REQUIRE(stats.frameCount == 1);
+    REQUIRE(stats.p50Us == Catch::Approx(static_cast<float>(threads * samplesPerThread)));
+    REQUIRE(profiler.GetDroppedSampleCount() == 0);
+}
+
+TEST_CASE("FrameProfiler drops samples when a ring is full", "[profiler]") {
+    FrameProfiler profiler;
+    for (size_t i = 0; i < FrameProfiler::RING_CAPACITY + 10; ++i) {
+        profiler.Record(ProfileScope::Hook, nullptr, 1us);
+    }
+    REQUIRE(profiler.GetDroppedSampleCount() == 10);
+
+    profiler.EndFrame();
+    REQUIRE(profiler.Query(nullptr, ProfileScope::Hook).p50Us ==
+            Catch::Approx(static_cast<float>(FrameProfiler::RING_CAPACITY)));
+}
+
+TEST_CASE("FrameProfiler scopes attribute to the current owner", "[profiler]") {
+    auto& profiler = FrameProfiler::GetSingleton();
+    profiler.Reset();
+    int menu = 0;
+    profiler.SetOwnerName(&menu, "ScopedMenu");
+
+    {
+        FrameProfiler::OwnerScope owner(&menu);
+        FrameProfiler::Scope scope(ProfileScope::Interaction);
+    }
+    REQUIRE(FrameProfiler::GetCurrentOwner() == nullptr);  // Restored
+    profiler.EndFrame();
+
+    REQUIRE(profiler.Query(&menu, ProfileScope::Interaction).frameCount == 1);
+    profiler.ForgetOwner(&menu);
+}
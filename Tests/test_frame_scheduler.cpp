@@ -0,0 +1,175 @@
+#include <catch2/catch_all.hpp>
+
+#include "projectile/FrameScheduler.h"
+
+#include <vector>
+
+using namespace Widget;
+
+// ============================================================================
+// FrameScheduler Tests
+// ============================================================================
+
+namespace {
+    // Run one frame: plan, then admit every planned root, charging costUs per admitted root.
+    // Returns the keys that ran and the delta each one received.
+    struct FrameResult {
+        std::vector<const void*> ran;
+        std::vector<float> deltas;
+    };
+
+    FrameResult RunFrame(FrameScheduler& scheduler, const std::vector<FrameScheduler::Candidate>& candidates,
+                         float deltaTime, uint64_t costUs = 0) {
+        FrameResult result;
+        uint64_t spent = 0;
+        for (size_t index : scheduler.Plan(candidates, deltaTime)) {
+            float delta = 0.0f;
+            if (scheduler.Admit(candidates[index].key, spent, delta)) {
+                result.ran.push_back(candidates[index].key);
+                result.deltas.push_back(delta);
+                scheduler.RecordCost(candidates[index].key, costUs);
+                spent += costUs;
+            }
+        }
+        return result;
+    }
+}
+
+TEST_CASE("FrameScheduler runs reduced-rate roots on their interval", "[scheduler]") {
+    FrameScheduler scheduler;
+    FrameScheduler::Settings settings;
+    settings.farInterval = 2;
+    settings.hiddenInterval = 5;
+    scheduler.SetSettings(settings);
+
+    int normal = 0, far = 0, hidden = 0;
+    std::vector<FrameScheduler::Candidate> candidates = {
+        {&normal, UpdatePriority::Normal},
+        {&far, UpdatePriority::Far},
+        {&hidden, UpdatePriority::Hidden},
+    };
+
+    int normalRuns = 0, farRuns = 0, hiddenRuns = 0;
+    float hiddenDelta = 0.0f;
+    for (int frame = 0; frame < 10; ++frame) {
+        auto result = RunFrame(scheduler, candidates, 0.01f);
+        for (size_t i = 0; i < result.ran.size(); ++i) {
+            if (result.ran[i] == &normal) ++normalRuns;
+            if (result.ran[i] == &far) ++farRuns;
+            if (result.ran[i] == &hidden) {
+                ++hiddenRuns;
+                hiddenDelta = result.deltas[i];
+            }
+        }
+    }
+
+    REQUIRE(normalRuns == 10);
+    REQUIRE(farRuns == 5);
+    REQUIRE(hiddenRuns == 2);
+    // A reduced-rate root receives all the time that passed since it last ran
+    REQUIRE(hiddenDelta == Catch::Approx(0.05f));
+}
+
+TEST_CASE("FrameScheduler orders roots by urgency", "[scheduler]") {
+    FrameScheduler scheduler;
+    int a = 0, b = 0, c = 0;
+    std::vector<FrameScheduler::Candidate> candidates = {
+        {&a, UpdatePriority::Normal},
+        {&b, UpdatePriority::Hidden},
+        {&c, UpdatePriority::Interacting},
+    };
+
+    FrameScheduler::Settings settings;
+    settings.hiddenInterval = 1;
+    scheduler.SetSettings(settings);
+
+    const auto& plan = scheduler.Plan(candidates, 0.01f);
+    REQUIRE(plan.size() == 3);
+    REQUIRE(plan[0] == 2);  // Interacting
+    REQUIRE(plan[1] == 0);  // Normal
+    REQUIRE(plan[2] == 1);  // Hidden
+}
+
+TEST_CASE("FrameScheduler defers work over budget", "[scheduler]") {
+    FrameScheduler scheduler;
+    int a = 0, b = 0, c = 0;
+    std::vector<FrameScheduler::Candidate> candidates = {
+        {&a, UpdatePriority::Normal},
+        {&b, UpdatePriority::Normal},
+        {&c, UpdatePriority::Normal},
+    };
+
+    // Unbudgeted warm-up frame records a 100us cost estimate for each root
+    auto first = RunFrame(scheduler, candidates, 0.01f, 100);
+    REQUIRE(first.ran.size() == 3);
+
+    FrameScheduler::Settings settings;
+    settings.budgetUs = 150;
+    settings.maxDeferredFrames = 4;
+    scheduler.SetSettings(settings);
+
+    SECTION("Only what fits the budget runs, the rest rolls over") {
+        auto second = RunFrame(scheduler, candidates, 0.01f, 100);
+        REQUIRE(second.ran.size() == 1);
+        REQUIRE(scheduler.GetDeferredCount() == 2);
+
+        // Deferred roots go first next frame and receive both frames' time
+        auto third = RunFrame(scheduler, candidates, 0.01f, 100);
+        REQUIRE(third.ran.size() == 1);
+        REQUIRE(third.ran[0] != second.ran[0]);
+        REQUIRE(third.deltas[0] == Catch::Approx(0.02f));
+    }
+
+    SECTION("Interacting roots ignore the budget") {
+        candidates[1].priority = UpdatePriority::Interacting;
+        candidates[2].priority = UpdatePriority::Interacting;
+        auto second = RunFrame(scheduler, candidates, 0.01f, 100);
+
+        // Both interacting roots run although the second overruns; the normal one waits
+        REQUIRE(second.ran.size() == 2);
+        REQUIRE(second.ran[0] == &b);
+        REQUIRE(second.ran[1] == &c);
+        REQUIRE(scheduler.GetDeferredCount() == 1);
+    }
+
+    SECTION("A root is never starved past maxDeferredFrames") {
+        // c runs first every frame and a is always admitted after it, so b keeps losing
+        candidates[2].priority = UpdatePriority::Interacting;
+        candidates[0].priority = UpdatePriority::Interacting;
+
+        int bRuns = 0;
+        float bDelta = 0.0f;
+        for (int frame = 0; frame < 5; ++frame) {
+            auto result = RunFrame(scheduler, candidates, 0.01f, 100);
+            for (size_t i = 0; i < result.ran.size(); ++i) {
+                if (result.ran[i] == &b) {
+                    ++bRuns;
+                    bDelta = result.deltas[i];
+                }
+            }
+        }
+        REQUIRE(bRuns == 1);
+        REQUIRE(bDelta == Catch::Approx(0.05f));
+    }
+}
+
+TEST_CASE("FrameScheduler with no budget runs every due root", "[scheduler]") {
+    FrameScheduler scheduler;
+    std::vector<int> roots(8);
+    std::vector<FrameScheduler::Candidate> candidates;
+    for (auto& root : roots) {
+        candidates.push_back({&root, UpdatePriority::Normal});
+    }
+
+    for (int frame = 0; frame < 3; ++frame) {
+        auto result = RunFrame(scheduler, candidates, 0.01f, 10000);
+        REQUIRE(result.ran.size() == roots.size());
+        REQUIRE(scheduler.GetDeferredCount() == 0);
+    }
+
+    SECTION("Forgotten roots start fresh") {
+        scheduler.Forget(&roots[0]);
+        float delta = 0.0f;
+        REQUIRE_FALSE(scheduler.Admit(&roots[0], 0, delta));
+    }
+}
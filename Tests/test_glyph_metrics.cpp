@@ -0,0 +1,218 @@
+#include <catch2/catch_all.hpp>
+
+#include "projectile/GlyphMetricsTable.h"
+#include "projectile/TextLayout.h"
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Projectile;
+using Catch::Approx;
+
+// ============================================================================
+// Glyph Metrics Table Tests
+// ============================================================================
+
+namespace {
+    // Same shape as text_atlas_main_mapping.csv: ASCII and Latin-1 share the first page, a
+    // few punctuation/currency characters are scattered beyond them
+    std::string MakeAtlasCSV() {
+        std::vector<uint32_t> codepoints;
+        for (uint32_t cp = 0x20; cp <= 0x7E; ++cp) codepoints.push_back(cp);
+        for (uint32_t cp = 0xA1; cp <= 0xFF; ++cp) codepoints.push_back(cp);
+        for (uint32_t cp : {0x152u, 0x153u, 0x160u, 0x161u, 0x178u, 0x2013u, 0x2014u, 0x2026u, 0x20ACu, 0x2122u}) {
+            codepoints.push_back(cp);
+        }
+
+        std::ostringstream csv;
+        csv << "Character,Unicode,Index,Row,Col,X,Y,Width,WidthRatio\n";
+        for (size_t i = 0; i < codepoints.size(); ++i) {
+            uint32_t cp = codepoints[i];
+            int row = static_cast<int>(i / 16);
+            int col = static_cast<int>(i % 16);
+            char unicode[16];
+            std::snprintf(unicode, sizeof(unicode), "U+%04X", cp);
+            // Character column as the generator writes it: quoted when it's a comma or quote
+            std::string character = cp == ',' ? "\",\"" : cp == '"' ? "\"\"\"\"" : cp < 0x80 ? std::string(1, static_cast<char>(cp)) : "?";
+            csv << character << ',' << unicode << ',' << i << ',' << row << ',' << col << ','
+                << col * 128 << ',' << row * 128 << ',' << 40 + (cp % 50) << ','
+                << (40 + (cp % 50)) / 128.0f << '\n';
+        }
+        return csv.str();
+    }
+
+    GlyphMetricsTable ParseAtlasCSV() {
+        std::istringstream in(MakeAtlasCSV());
+        auto table = GlyphMetricsTable::ParseCSV(in);
+        REQUIRE(table);
+        return std::move(*table);
+    }
+}
+
+TEST_CASE("GlyphMetricsTable parses the atlas mapping CSV", "[glyphs]") {
+    GlyphMetricsTable table = ParseAtlasCSV();
+
+    REQUIRE(table.GetGlyphCount() == 95 + 95 + 10);
+    REQUIRE(table.GetAtlasCols() == 16);
+    REQUIRE(table.GetAtlasRows() == 13);
+
+    // Quoted characters parse like any other
+    const auto* comma = table.Find(L',');
+    REQUIRE(comma);
+    REQUIRE(comma->uv.col == 12);
+    REQUIRE(comma->uv.row == 0);
+    REQUIRE(comma->widthRatio == Approx((40 + ',' % 50) / 128.0f));
+    REQUIRE(table.Find(L'"'));
+
+    // Dense pages for ASCII and Latin-1, the rest sparse
+    REQUIRE(table.GetDensePageCount() == 1);
+    REQUIRE(table.GetSparseCount() == 10);
+    REQUIRE(table.Find(0x20AC)->uv.row == 12);
+    REQUIRE(table.Find(0xE9));
+
+    // Absent: inside a dense page, in a sparse range, outside the BMP
+    REQUIRE_FALSE(table.Find(0x7F));
+    REQUIRE_FALSE(table.Find(0x2015));
+    REQUIRE_FALSE(table.Find(0x1F600));
+    REQUIRE_FALSE(table.Find(0));
+}
+
+TEST_CASE("GlyphMetricsTable skips bad rows and keeps the last duplicate", "[glyphs]") {
+    std::istringstream in(
+        "Character,Unicode,Index,Row,Col,X,Y,Width,WidthRatio\n"
+        "A,U+0041,0,0,0,0,0,60,0.5\n"
+        "B,U+0042,1,0,1,128,0,60\n"            // No width ratio
+        "C,U+0043,2,x,2,256,0,60,0.5\n"        // Bad row
+        "\r\n"
+        "A,U+0041,3,0,3,384,0,70,0.55\r\n"     // Duplicate, CRLF
+        "\xC3\xA9,U+00E9,4,0,4,512,0,60,0.5\n");  // Multi-byte UTF-8 character, found via Unicode
+
+    auto table = GlyphMetricsTable::ParseCSV(in);
+    REQUIRE(table);
+    REQUIRE(table->GetGlyphCount() == 2);
+    REQUIRE(table->Find(L'A')->uv.col == 3);
+    REQUIRE(table->Find(L'A')->widthRatio == Approx(0.55f));
+    REQUIRE(table->Find(0xE9)->uv.col == 4);
+    REQUIRE_FALSE(table->Find(L'B'));
+
+    std::istringstream empty("");
+    REQUIRE_FALSE(GlyphMetricsTable::ParseCSV(empty));
+}
+
+TEST_CASE("GlyphMetricsTable binary round trip", "[glyphs]") {
+    GlyphMetricsTable table = ParseAtlasCSV();
+
+    std::stringstream binary;
+    REQUIRE(table.WriteBinary(binary));
+    REQUIRE(binary.str().size() == 12 + table.GetGlyphCount() * 12);
+
+    auto loaded = GlyphMetricsTable::ReadBinary(binary);
+    REQUIRE(loaded);
+    REQUIRE(loaded->GetGlyphCount() == table.GetGlyphCount());
+    REQUIRE(loaded->GetAtlasRows() == table.GetAtlasRows());
+    for (const auto& entry : table.GetEntries()) {
+        const auto* glyph = loaded->Find(entry.codepoint);
+        REQUIRE(glyph);
+        REQUIRE(glyph->uv.col == entry.glyph.uv.col);
+        REQUIRE(glyph->uv.row == entry.glyph.uv.row);
+        REQUIRE(glyph->widthRatio == entry.glyph.widthRatio);
+    }
+
+    SECTION("Truncated or foreign files are rejected") {
+        std::string bytes = binary.str();
+        std::istringstream truncated(bytes.substr(0, bytes.size() - 3));
+        REQUIRE_FALSE(GlyphMetricsTable::ReadBinary(truncated));
+
+        std::istringstream csv(MakeAtlasCSV());
+        REQUIRE_FALSE(GlyphMetricsTable::ReadBinary(csv));
+    }
+}
+
+// ============================================================================
+// Benchmark: lay out 10k strings with the hash-map lookups TextAssets used before
+// (one map for UVs, one for widths) vs the flat table. Also compares loading the
+// metrics from CSV and from the binary file.
+// Hidden from the default run - run: 3DUITests "[benchmark]"
+// ============================================================================
+
+namespace {
+    std::unordered_map<wchar_t, TextAssets::UVCoord> s_benchUVs;
+    std::unordered_map<wchar_t, float> s_benchWidths;
+    GlyphMetricsTable s_benchTable;
+
+    GlyphMetrics MapMetrics(wchar_t ch) {
+        GlyphMetrics metrics;
+        if (auto it = s_benchUVs.find(ch); it != s_benchUVs.end()) {
+            metrics.uv = &it->second;
+        }
+        if (auto it = s_benchWidths.find(ch); it != s_benchWidths.end()) {
+            metrics.widthRatio = it->second;
+        }
+        return metrics;
+    }
+
+    GlyphMetrics TableMetrics(wchar_t ch) {
+        const auto* glyph = s_benchTable.Find(static_cast<uint32_t>(ch));
+        return glyph ? GlyphMetrics{glyph->widthRatio, &glyph->uv} : GlyphMetrics{};
+    }
+}
+
+TEST_CASE("Glyph metric lookups: hash maps vs flat table", "[.][benchmark][glyphs]") {
+    s_benchTable = ParseAtlasCSV();
+    s_benchUVs.clear();
+    s_benchWidths.clear();
+    for (const auto& entry : s_benchTable.GetEntries()) {
+        s_benchUVs[static_cast<wchar_t>(entry.codepoint)] = entry.glyph.uv;
+        s_benchWidths[static_cast<wchar_t>(entry.codepoint)] = entry.glyph.widthRatio;
+    }
+
+    // Item names, counts and a few accented/typographic characters
+    const wchar_t* words[] = {L"Iron", L"Sword", L"of", L"Flames", L"Gold", L"Weight:", L"Value",
+                              L"\u00C9lan", L"\u00D1and\u00FA", L"Potion", L"\u20AC", L"\u2014", L"Caf\u00E9", L"\u0152uvre", L"x3"};
+    std::vector<std::wstring> strings;
+    strings.reserve(10000);
+    for (size_t i = 0; i < 10000; ++i) {
+        std::wstring text;
+        for (size_t w = 0; w < 2 + i % 4; ++w) {
+            text += words[(i * 7 + w * 3) % std::size(words)];
+            text += L' ';
+        }
+        text += std::to_wstring(i);
+        strings.push_back(std::move(text));
+    }
+
+    TextLayoutParams params;
+    BENCHMARK("Hash maps, 10k layouts") {
+        size_t glyphs = 0;
+        for (const auto& text : strings) {
+            glyphs += TextLayout::Compute(text, params, &MapMetrics).glyphs.size();
+        }
+        return glyphs;
+    };
+
+    BENCHMARK("Flat table, 10k layouts") {
+        size_t glyphs = 0;
+        for (const auto& text : strings) {
+            glyphs += TextLayout::Compute(text, params, &TableMetrics).glyphs.size();
+        }
+        return glyphs;
+    };
+
+    std::string csv = MakeAtlasCSV();
+    std::stringstream binaryOut;
+    s_benchTable.WriteBinary(binaryOut);
+    std::string binary = binaryOut.str();
+
+    BENCHMARK("Load from CSV") {
+        std::istringstream in(csv);
+        return GlyphMetricsTable::ParseCSV(in)->GetGlyphCount();
+    };
+
+    BENCHMARK("Load from binary") {
+        std::istringstream in(binary);
+        return GlyphMetricsTable::ReadBinary(in)->GetGlyphCount();
+    };
+}
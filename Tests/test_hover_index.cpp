@@ -0,0 +1,247 @@
+#include <catch2/catch_all.hpp>
+
+#include "projectile/HoverSpatialIndex.h"
+#include "projectile/IPositionable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Projectile;
+
+// ============================================================================
+// HoverSpatialIndex Tests
+// ============================================================================
+
+namespace {
+    // Brute-force reference with the same distance math as InteractionController
+    std::vector<HoverSpatialIndex::Neighbor> BruteForceNearest(
+        const std::vector<RE::NiPoint3>& positions, const RE::NiPoint3& center,
+        float maxDistance, size_t k)
+    {
+        std::vector<HoverSpatialIndex::Neighbor> out;
+        for (uint32_t id = 0; id < positions.size(); ++id) {
+            float dx = positions[id].x - center.x;
+            float dy = positions[id].y - center.y;
+            float dz = positions[id].z - center.z;
+            float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+            if (dist <= maxDistance) {
+                out.push_back({id, dist});
+            }
+        }
+        std::sort(out.begin(), out.end(), [](const auto& a, const auto& b) {
+            return a.distance < b.distance || (a.distance == b.distance && a.id < b.id);
+        });
+        if (out.size() > k) {
+            out.resize(k);
+        }
+        return out;
+    }
+
+    void RequireSameNeighbors(const std::vector<HoverSpatialIndex::Neighbor>& a,
+                              const std::vector<HoverSpatialIndex::Neighbor>& b) {
+        REQUIRE(a.size() == b.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            REQUIRE(a[i].id == b[i].id);
+            REQUIRE(a[i].distance == b[i].distance);
+        }
+    }
+}
+
+TEST_CASE("HoverSpatialIndex queries", "[interaction][hover][index]") {
+    HoverSpatialIndex index;
+    index.SetCellSize(10.0f);
+    index.Resize(3);
+    index.SetPosition(0, RE::NiPoint3(0, 0, 0));
+    index.SetPosition(1, RE::NiPoint3(5, 0, 0));
+    index.SetPosition(2, RE::NiPoint3(50, 0, 0));
+
+    std::vector<HoverSpatialIndex::Neighbor> out;
+
+    SECTION("Returns elements within range sorted by distance") {
+        index.QueryNearest(RE::NiPoint3(4, 0, 0), 10.0f, 10, out);
+        REQUIRE(out.size() == 2);
+        REQUIRE(out[0].id == 1);
+        REQUIRE(out[0].distance == Catch::Approx(1.0f));
+        REQUIRE(out[1].id == 0);
+    }
+
+    SECTION("k limits the result count") {
+        index.QueryNearest(RE::NiPoint3(4, 0, 0), 10.0f, 1, out);
+        REQUIRE(out.size() == 1);
+        REQUIRE(out[0].id == 1);
+    }
+
+    SECTION("Moved element is found at its new position only") {
+        index.SetPosition(2, RE::NiPoint3(-3, 0, 0));
+        index.QueryNearest(RE::NiPoint3(-3, 0, 0), 1.0f, 10, out);
+        REQUIRE(out.size() == 1);
+        REQUIRE(out[0].id == 2);
+
+        index.QueryNearest(RE::NiPoint3(50, 0, 0), 1.0f, 10, out);
+        REQUIRE(out.empty());
+    }
+
+    SECTION("Shrinking drops removed ids") {
+        index.Resize(1);
+        index.QueryNearest(RE::NiPoint3(0, 0, 0), 100.0f, 10, out);
+        REQUIRE(out.size() == 1);
+        REQUIRE(out[0].id == 0);
+    }
+
+    SECTION("Non-finite positions are not indexed") {
+        index.SetPosition(1, RE::NiPoint3(std::numeric_limits<float>::quiet_NaN(), 0, 0));
+        index.QueryNearest(RE::NiPoint3(5, 0, 0), 6.0f, 10, out);
+        REQUIRE(out.size() == 1);
+        REQUIRE(out[0].id == 0);
+    }
+}
+
+TEST_CASE("HoverSpatialIndex matches brute force", "[interaction][hover][index]") {
+    std::mt19937 rng(4242);
+    std::uniform_real_distribution<float> coord(-200.0f, 200.0f);
+    std::uniform_real_distribution<float> jitter(-3.0f, 3.0f);
+
+    constexpr size_t count = 600;
+    std::vector<RE::NiPoint3> positions(count);
+    for (auto& p : positions) {
+        p = RE::NiPoint3(coord(rng), coord(rng), coord(rng) * 0.1f);
+    }
+
+    HoverSpatialIndex index;
+    index.SetCellSize(12.0f);
+    index.Resize(count);
+
+    std::vector<HoverSpatialIndex::Neighbor> out;
+    for (int frame = 0; frame < 10; ++frame) {
+        // Refit: move every element a little (some cross cell boundaries)
+        for (uint32_t id = 0; id < count; ++id) {
+            positions[id] = positions[id] + RE::NiPoint3(jitter(rng), jitter(rng), jitter(rng));
+            index.SetPosition(id, positions[id]);
+        }
+
+        for (int query = 0; query < 20; ++query) {
+            RE::NiPoint3 center(coord(rng), coord(rng), coord(rng) * 0.1f);
+            index.QueryNearest(center, 12.0f, count, out);
+            RequireSameNeighbors(out, BruteForceNearest(positions, center, 12.0f, count));
+
+            index.QueryNearest(center, 30.0f, 5, out);
+            RequireSameNeighbors(out, BruteForceNearest(positions, center, 30.0f, 5));
+        }
+    }
+
+    SECTION("Changing cell size keeps results") {
+        index.SetCellSize(3.0f);
+        RE::NiPoint3 center(0, 0, 0);
+        index.QueryNearest(center, 40.0f, count, out);
+        RequireSameNeighbors(out, BruteForceNearest(positions, center, 40.0f, count));
+    }
+}
+
+// ============================================================================
+// Benchmark: dense grid menu, per-hand brute force (as InteractionController used to do:
+// visibility + world position + distance for every element, per hand) vs spatial index
+// (one refit pass + two hand queries). Hidden from the default run - run: 3DUITests "[benchmark]"
+// ============================================================================
+
+TEST_CASE("HoverSpatialIndex vs brute force throughput", "[.][benchmark][hover]") {
+    for (size_t side : {size_t{23}, size_t{32}}) {  // ~500 and ~1000 items
+        IPositionable root;
+        IPositionable row;
+        row.SetParent(&root);
+        std::vector<std::unique_ptr<IPositionable>> items;
+        for (size_t r = 0; r < side; ++r) {
+            for (size_t c = 0; c < side; ++c) {
+                auto item = std::make_unique<IPositionable>();
+                item->SetParent(&row);
+                item->SetLocalPosition(RE::NiPoint3(static_cast<float>(c) * 8.0f, 60.0f, static_cast<float>(r) * 8.0f));
+                items.push_back(std::move(item));
+            }
+        }
+        const size_t count = items.size();
+        const RE::NiPoint3 hands[] = {RE::NiPoint3(40.0f, 58.0f, 40.0f), RE::NiPoint3(100.0f, 61.0f, 90.0f)};
+        constexpr float threshold = 10.0f;
+
+        HoverSpatialIndex index;
+        index.SetCellSize(threshold * 1.01f);
+        index.Resize(count);
+        std::vector<HoverSpatialIndex::Neighbor> out;
+
+        BENCHMARK("Brute force x" + std::to_string(count)) {
+            uint32_t closest = 0;
+            for (const auto& hand : hands) {
+                float closestDist = (std::numeric_limits<float>::max)();
+                for (uint32_t id = 0; id < count; ++id) {
+                    if (!items[id]->IsEffectivelyVisible()) continue;
+                    RE::NiPoint3 pos = items[id]->GetWorldPosition();
+                    float dx = pos.x - hand.x, dy = pos.y - hand.y, dz = pos.z - hand.z;
+                    float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+                    if (dist < threshold && dist < closestDist) {
+                        closestDist = dist;
+                        closest = id;
+                    }
+                }
+            }
+            return closest;
+        };
+
+        BENCHMARK("Spatial index x" + std::to_string(count)) {
+            for (uint32_t id = 0; id < count; ++id) {
+                index.SetPosition(id, items[id]->GetWorldPosition());
+            }
+            uint32_t closest = 0;
+            for (const auto& hand : hands) {
+                index.QueryNearest(hand, threshold * 1.01f, count, out);
+                for (const auto& candidate : out) {
+                    if (items[candidate.id]->IsEffectivelyVisible() && candidate.distance < threshold) {
+                        closest = candidate.id;
+                        break;
+                    }
+                }
+            }
+            return closest;
+        };
+
+        auto moveMenu = [&]() {
+            root.SetLocalPosition(root.GetLocalPosition() + RE::NiPoint3(0.5f, 0.0f, 0.0f));
+            row.InvalidateWorldTransform();
+            for (auto& item : items) item->InvalidateWorldTransform();  // Base nodes don't propagate
+        };
+
+        BENCHMARK("Brute force (menu moving) x" + std::to_string(count)) {
+            moveMenu();
+            uint32_t closest = 0;
+            for (const auto& hand : hands) {
+                float closestDist = (std::numeric_limits<float>::max)();
+                for (uint32_t id = 0; id < count; ++id) {
+                    if (!items[id]->IsEffectivelyVisible()) continue;
+                    RE::NiPoint3 pos = items[id]->GetWorldPosition();
+                    float dx = pos.x - hand.x, dy = pos.y - hand.y, dz = pos.z - hand.z;
+                    float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+                    if (dist < threshold && dist < closestDist) {
+                        closestDist = dist;
+                        closest = id;
+                    }
+                }
+            }
+            return closest;
+        };
+
+        BENCHMARK("Spatial index (menu moving) x" + std::to_string(count)) {
+            moveMenu();
+            for (uint32_t id = 0; id < count; ++id) {
+                index.SetPosition(id, items[id]->GetWorldPosition());
+            }
+            size_t hits = 0;
+            for (const auto& hand : hands) {
+                index.QueryNearest(hand, threshold * 1.01f, count, out);
+                hits += out.size();
+            }
+            return hits;
+        };
+    }
+}
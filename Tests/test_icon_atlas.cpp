@@ -0,0 +1,188 @@
+#include <catch2/catch_all.hpp>
+
+#include "projectile/IconAtlasLayout.h"
+
+#include <string>
+#include <vector>
+
+using namespace Projectile;
+using Catch::Approx;
+
+// ============================================================================
+// Icon Atlas Packing Tests
+// ============================================================================
+
+namespace {
+    bool Overlaps(const AtlasRect& a, const AtlasRect& b) {
+        return a.x < b.x + b.width && b.x < a.x + a.width &&
+               a.y < b.y + b.height && b.y < a.y + a.height;
+    }
+
+    InternedString IconPath(int id) {
+        return InternedString("textures\\atlas_test\\icon" + std::to_string(id) + ".dds");
+    }
+
+    constexpr uint32_t BC3 = 77;
+    constexpr uint32_t BC1 = 71;
+}
+
+TEST_CASE("AtlasRectAllocator packs without overlap inside the page", "[atlas]") {
+    AtlasRectAllocator allocator(512, 512, 4, 4);
+    std::vector<AtlasRect> rects;
+
+    // Mixed icon sizes until the page is full
+    uint32_t sizes[] = {64, 32, 128, 48, 64, 96, 16};
+    for (int i = 0;; ++i) {
+        uint32_t w = sizes[i % 7];
+        uint32_t h = sizes[(i + 3) % 7];
+        auto rect = allocator.Allocate(w, h);
+        if (!rect) {
+            break;
+        }
+        REQUIRE(rect->width == w);
+        REQUIRE(rect->height == h);
+        REQUIRE(rect->x % 4 == 0);
+        REQUIRE(rect->y % 4 == 0);
+        REQUIRE(rect->x + rect->width <= 512);
+        REQUIRE(rect->y + rect->height <= 512);
+        rects.push_back(*rect);
+    }
+
+    REQUIRE(rects.size() > 20);
+    for (size_t i = 0; i < rects.size(); ++i) {
+        for (size_t j = i + 1; j < rects.size(); ++j) {
+            REQUIRE_FALSE(Overlaps(rects[i], rects[j]));
+        }
+    }
+    REQUIRE(allocator.GetOccupancy() > 0.5f);
+}
+
+TEST_CASE("AtlasRectAllocator fills a page of equal icons exactly", "[atlas]") {
+    // 60px icons + 4px gutter = 64px cells, 8x8 on a 512 page
+    AtlasRectAllocator allocator(512, 512, 4, 4);
+    for (int i = 0; i < 64; ++i) {
+        REQUIRE(allocator.Allocate(60, 60));
+    }
+    REQUIRE_FALSE(allocator.Allocate(60, 60));
+
+    allocator.Reset();
+    REQUIRE(allocator.GetUsedArea() == 0);
+    REQUIRE(allocator.Allocate(60, 60)->x == 0);
+}
+
+TEST_CASE("AtlasRectAllocator rejects what can't fit", "[atlas]") {
+    AtlasRectAllocator allocator(256, 256, 4, 4);
+    REQUIRE_FALSE(allocator.Allocate(0, 10));
+    REQUIRE_FALSE(allocator.Allocate(300, 10));
+    REQUIRE(allocator.Allocate(256, 256));  // Gutter clipped at the page edge
+    REQUIRE_FALSE(allocator.Allocate(4, 4));
+}
+
+TEST_CASE("AtlasUV maps a rect onto icon mesh UVs", "[atlas]") {
+    // Whole page, no inset beyond half a texel: matches the default full-texture UVs
+    AtlasUV full = AtlasUV::ForRect({0, 0, 1024, 1024}, 1024, 1024);
+    REQUIRE(full.scaleX == Approx(0.5f).margin(1e-3));
+    REQUIRE(full.offsetX == Approx(0.25f).margin(1e-3));
+
+    // meshUV -0.5 and 1.5 land half a texel inside the rect
+    AtlasRect rect{256, 512, 128, 64};
+    AtlasUV uv = AtlasUV::ForRect(rect, 1024, 1024);
+    REQUIRE(-0.5f * uv.scaleX + uv.offsetX == Approx(256.5f / 1024));
+    REQUIRE(1.5f * uv.scaleX + uv.offsetX == Approx(383.5f / 1024));
+    REQUIRE(-0.5f * uv.scaleY + uv.offsetY == Approx(512.5f / 1024));
+    REQUIRE(1.5f * uv.scaleY + uv.offsetY == Approx(575.5f / 1024));
+}
+
+TEST_CASE("IconAtlasLayout groups icons by format and reuses placements", "[atlas]") {
+    IconAtlasLayout::Settings settings;
+    settings.pageSize = 256;
+    settings.maxPages = 3;
+    settings.maxIconSize = 128;
+    settings.mipLevels = 1;
+    IconAtlasLayout layout;
+    layout.SetSettings(settings);
+
+    auto a = layout.Place(IconPath(1), 124, 124, BC3);
+    REQUIRE(a);
+    REQUIRE(a->newPage);
+
+    auto again = layout.Place(IconPath(1), 124, 124, BC3);
+    REQUIRE(again->page == a->page);
+    REQUIRE(again->rect.x == a->rect.x);
+    REQUIRE_FALSE(again->newPage);
+    REQUIRE(layout.Find(IconPath(1)));
+
+    // Another format gets its own page
+    auto b = layout.Place(IconPath(2), 64, 64, BC1);
+    REQUIRE(b->page != a->page);
+    REQUIRE(layout.GetPageFormat(b->page) == BC1);
+
+    // Too large stays standalone
+    REQUIRE_FALSE(layout.Place(IconPath(3), 256, 256, BC3));
+    REQUIRE_FALSE(layout.Find(IconPath(3)));
+
+    SECTION("A full page opens the next one until the page limit") {
+        // Four 124px icons fill a 256 page
+        for (int i = 10; i < 13; ++i) {
+            REQUIRE(layout.Place(IconPath(i), 124, 124, BC3)->page == a->page);
+        }
+        auto overflow = layout.Place(IconPath(13), 124, 124, BC3);
+        REQUIRE(overflow->newPage);
+        REQUIRE(layout.GetPageCount() == 3);
+
+        for (int i = 14; i < 17; ++i) {
+            REQUIRE(layout.Place(IconPath(i), 124, 124, BC3));
+        }
+        REQUIRE_FALSE(layout.Place(IconPath(17), 124, 124, BC3));
+        REQUIRE(layout.GetIconCount() == 9);
+    }
+}
+
+TEST_CASE("IconAtlasLayout keeps every page mip block-aligned", "[atlas]") {
+    IconAtlasLayout::Settings settings;
+    settings.pageSize = 512;
+    settings.mipLevels = 4;
+    IconAtlasLayout layout;
+    layout.SetSettings(settings);
+
+    std::vector<AtlasRect> rects;
+    uint32_t sizes[] = {64, 32, 128, 48, 96};
+    for (int i = 0; i < 5; ++i) {
+        auto placement = layout.Place(IconPath(100 + i), sizes[i], sizes[(i + 2) % 5], BC3);
+        REQUIRE(placement);
+        rects.push_back(placement->rect);
+    }
+
+    for (const auto& rect : rects) {
+        for (uint32_t mip = 0; mip < settings.mipLevels; ++mip) {
+            REQUIRE((rect.x >> mip) % 4 == 0);
+            REQUIRE((rect.y >> mip) % 4 == 0);
+        }
+    }
+
+    // A texel of gutter between neighbours survives down to the last mip
+    uint32_t lastMip = settings.mipLevels - 1;
+    for (size_t i = 0; i < rects.size(); ++i) {
+        for (size_t j = 0; j < rects.size(); ++j) {
+            AtlasRect grown = rects[i];
+            grown.width += 1u << lastMip;
+            grown.height += 1u << lastMip;
+            if (i != j) {
+                REQUIRE_FALSE(Overlaps(grown, rects[j]));
+            }
+        }
+    }
+}
+
+TEST_CASE("IconAtlasLayout clamps the page mip chain to the page size", "[atlas]") {
+    IconAtlasLayout::Settings settings;
+    settings.pageSize = 256;
+    settings.mipLevels = 12;
+    IconAtlasLayout layout;
+    layout.SetSettings(settings);
+    REQUIRE(IconAtlasLayout::GetAlignment(layout.GetSettings().mipLevels) <= 256);
+
+    settings.mipLevels = 0;
+    layout.SetSettings(settings);
+    REQUIRE(layout.GetSettings().mipLevels == 1);
+}
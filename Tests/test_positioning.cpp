@@ -158,6 +158,111 @@ TEST_CASE("World Transform Computation", "[positioning][transform]") {
     }
 }
 
+// ============================================================================
+// Scene Graph World Transform Cache Tests
+// ============================================================================
+
+TEST_CASE("IPositionable World Transform Cache", "[positioning][transform][cache]") {
+    IPositionable root;
+    IPositionable child;
+    child.SetParent(&root);
+
+    root.SetLocalPosition(RE::NiPoint3(100, 0, 0));
+    root.SetLocalScale(2.0f);
+    child.SetLocalPosition(RE::NiPoint3(10, 0, 0));
+
+    SECTION("World transform composes parent chain") {
+        auto pos = child.GetWorldPosition();
+        REQUIRE(pos.x == Catch::Approx(110.0f));
+        REQUIRE(child.GetWorldScale() == Catch::Approx(2.0f));
+        REQUIRE_FALSE(child.IsWorldTransformDirty());
+    }
+
+    SECTION("Setting a local transform dirties the node") {
+        child.GetWorldPosition();
+        child.SetLocalPosition(RE::NiPoint3(20, 0, 0));
+        REQUIRE(child.IsWorldTransformDirty());
+        REQUIRE(child.GetWorldPosition().x == Catch::Approx(120.0f));
+    }
+
+    SECTION("Parent rotation is picked up after invalidation") {
+        REQUIRE(child.GetWorldPosition().x == Catch::Approx(110.0f));
+
+        // 90 degrees yaw: local +X maps to world +Y
+        root.SetLocalRotation(EulerToMatrix(RE::NiPoint3(0, 0, 1.5707963f)));
+        child.InvalidateWorldTransform();  // Base nodes don't track children
+
+        auto pos = child.GetWorldPosition();
+        REQUIRE(pos.x == Catch::Approx(100.0f).margin(0.001f));
+        REQUIRE(std::abs(pos.y) == Catch::Approx(10.0f));
+    }
+
+    SECTION("Setting an unchanged local transform keeps the cache") {
+        child.GetWorldPosition();
+        child.SetLocalPosition(RE::NiPoint3(10, 0, 0));
+        child.SetLocalScale(1.0f);
+        child.SetLocalRotation(IdentityMatrix());
+        REQUIRE_FALSE(child.IsWorldTransformDirty());
+    }
+
+    SECTION("World transform changes are reported once") {
+        REQUIRE(child.ConsumeWorldTransformChange());  // Initial state counts as a change
+        child.GetWorldPosition();
+        REQUIRE_FALSE(child.ConsumeWorldTransformChange());
+
+        child.SetLocalPosition(RE::NiPoint3(30, 0, 0));
+        child.GetWorldPosition();  // Another reader clearing the dirty flag doesn't hide the change
+        REQUIRE(child.ConsumeWorldTransformChange());
+        REQUIRE_FALSE(child.ConsumeWorldTransformChange());
+    }
+
+    SECTION("Reparenting invalidates the cache") {
+        child.GetWorldPosition();
+        child.SetParent(nullptr);
+        REQUIRE(child.IsWorldTransformDirty());
+        REQUIRE(child.GetWorldPosition().x == Catch::Approx(10.0f));
+    }
+}
+
+TEST_CASE("IPositionable wakes resting ancestors", "[positioning][rest]") {
+    // Stand-in for a resting container: counts the wakes that reach it
+    struct CountingContainer : IPositionable {
+        int wakes = 0;
+        void WakeUp() override {
+            ++wakes;
+            IPositionable::WakeUp();
+        }
+    };
+
+    CountingContainer outer;
+    CountingContainer inner;
+    IPositionable leaf;
+    inner.SetParent(&outer);
+    leaf.SetParent(&inner);
+    outer.wakes = 0;
+    inner.wakes = 0;
+
+    REQUIRE_FALSE(leaf.IsAtRest());  // Unknown node types never rest
+
+    SECTION("Changing a local transform wakes every ancestor") {
+        leaf.SetLocalPosition(RE::NiPoint3(1, 0, 0));
+        REQUIRE(inner.wakes == 1);
+        REQUIRE(outer.wakes == 1);
+
+        leaf.SetLocalScale(2.0f);
+        leaf.SetLocalRotation(EulerToMatrix(RE::NiPoint3(0, 0, 0.5f)));
+        REQUIRE(inner.wakes == 3);
+    }
+
+    SECTION("Re-applying the same transform doesn't wake anyone") {
+        leaf.SetLocalPosition(RE::NiPoint3(0, 0, 0));
+        leaf.SetLocalScale(1.0f);
+        leaf.SetLocalRotation(IdentityMatrix());
+        REQUIRE(inner.wakes == 0);
+        REQUIRE(outer.wakes == 0);
+    }
+}
+
 // ============================================================================
 // Anchor::RotatePoint Tests
 // ============================================================================
@@ -205,6 +310,71 @@ TEST_CASE("Anchor::RotatePoint", "[positioning][transform]") {
     }
 }
 
+// ============================================================================
+// Quaternion Helper Tests
+// ============================================================================
+
+namespace {
+    void RequireMatricesClose(const RE::NiMatrix3& a, const RE::NiMatrix3& b) {
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                REQUIRE(a.entry[r][c] == Catch::Approx(b.entry[r][c]).margin(0.0001f));
+            }
+        }
+    }
+}
+
+TEST_CASE("Quaternion helpers", "[positioning][transform][quaternion]") {
+    SECTION("Identity matrix maps to identity quaternion") {
+        auto q = MatrixToQuaternion(IdentityMatrix());
+        REQUIRE(q.w == Catch::Approx(1.0f));
+        REQUIRE(q.x == Catch::Approx(0.0f).margin(0.0001f));
+        REQUIRE(q.y == Catch::Approx(0.0f).margin(0.0001f));
+        REQUIRE(q.z == Catch::Approx(0.0f).margin(0.0001f));
+    }
+
+    SECTION("Matrix round-trips through quaternion") {
+        // Includes a near-180 degree yaw to exercise the non-trace branches
+        const RE::NiPoint3 eulers[] = {
+            {0.3f, -0.7f, 1.2f},
+            {1.4f, 0.2f, -2.9f},
+            {0.0f, 0.0f, 3.1f},
+            {-0.5f, 3.0f, 0.1f}
+        };
+        for (const auto& euler : eulers) {
+            RE::NiMatrix3 mat = EulerToMatrix(euler);
+            RequireMatricesClose(QuaternionToMatrix(MatrixToQuaternion(mat)), mat);
+        }
+    }
+
+    SECTION("Slerp endpoints and midpoint") {
+        auto a = MatrixToQuaternion(IdentityMatrix());
+        auto b = MatrixToQuaternion(EulerToMatrix(RE::NiPoint3(0.0f, 0.0f, 1.5f)));
+
+        RequireMatricesClose(QuaternionToMatrix(SlerpQuaternion(a, b, 0.0f)), IdentityMatrix());
+        RequireMatricesClose(QuaternionToMatrix(SlerpQuaternion(a, b, 1.0f)),
+                             EulerToMatrix(RE::NiPoint3(0.0f, 0.0f, 1.5f)));
+        RequireMatricesClose(QuaternionToMatrix(SlerpQuaternion(a, b, 0.5f)),
+                             EulerToMatrix(RE::NiPoint3(0.0f, 0.0f, 0.75f)));
+    }
+
+    SECTION("Slerp takes the shortest arc when quaternion signs differ") {
+        auto a = MatrixToQuaternion(IdentityMatrix());
+        auto b = MatrixToQuaternion(EulerToMatrix(RE::NiPoint3(0.0f, 0.0f, 0.4f)));
+        RE::NiQuaternion negB(-b.w, -b.x, -b.y, -b.z);  // Same rotation as b
+
+        RequireMatricesClose(QuaternionToMatrix(SlerpQuaternion(a, negB, 0.5f)),
+                             EulerToMatrix(RE::NiPoint3(0.0f, 0.0f, 0.2f)));
+    }
+
+    SECTION("Nlerp result is normalized") {
+        auto a = MatrixToQuaternion(EulerToMatrix(RE::NiPoint3(0.2f, 0.1f, 0.0f)));
+        auto b = MatrixToQuaternion(EulerToMatrix(RE::NiPoint3(-0.4f, 0.9f, 2.0f)));
+        auto q = NlerpQuaternion(a, b, 0.3f);
+        REQUIRE(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z == Catch::Approx(1.0f));
+    }
+}
+
 // ============================================================================
 // ObjectRefHandle Tests (for anchor by handle functionality)
 // ============================================================================
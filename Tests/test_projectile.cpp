@@ -7,6 +7,8 @@
 // Note: ControlledProjectile.h excluded - depends on ProjectileSubsystem
 #include "util/UUID.h"
 
+#include <thread>
+
 using namespace Projectile;
 using namespace Util;
 
@@ -56,6 +58,69 @@ TEST_CASE("ProjectileTransform", "[projectile]") {
     }
 }
 
+// ============================================================================
+// TransformMailbox Tests
+// ============================================================================
+
+TEST_CASE("TransformMailbox", "[projectile][mailbox]") {
+    SECTION("Default read is identity transform") {
+        TransformMailbox mailbox;
+        auto t = mailbox.Read();
+        REQUIRE(t.position.x == 0.0f);
+        REQUIRE(t.scale == 1.0f);
+        REQUIRE(IsIdentityMatrix(t.rotation));
+        REQUIRE(mailbox.GetPublishCount() == 0);
+    }
+
+    SECTION("Read returns latest published transform") {
+        TransformMailbox mailbox;
+        ProjectileTransform t;
+        t.position = RE::NiPoint3(1, 2, 3);
+        t.rotation.entry[0][1] = 0.5f;
+        t.scale = 2.0f;
+        mailbox.Publish(t);
+
+        auto result = mailbox.Read();
+        REQUIRE(result.position.y == 2.0f);
+        REQUIRE(result.rotation.entry[0][1] == 0.5f);
+        REQUIRE(result.scale == 2.0f);
+        REQUIRE(mailbox.GetPublishCount() == 1);
+    }
+
+    SECTION("Concurrent reader never observes a torn transform") {
+        TransformMailbox mailbox;
+        std::atomic<bool> done{false};
+
+        std::thread writer([&]() {
+            for (int i = 1; i <= 20000; ++i) {
+                float v = static_cast<float>(i);
+                ProjectileTransform t;
+                t.position = RE::NiPoint3(v, v, v);
+                for (auto& row : t.rotation.entry) {
+                    for (auto& e : row) e = v;
+                }
+                t.scale = v;
+                mailbox.Publish(t);
+            }
+            done = true;
+        });
+
+        bool torn = false;
+        while (!done) {
+            auto t = mailbox.Read();
+            float v = t.scale;
+            if (v == 1.0f) continue;  // Initial identity value
+            if (t.position.x != v || t.position.z != v || t.rotation.entry[2][2] != v) {
+                torn = true;
+            }
+        }
+        writer.join();
+
+        REQUIRE_FALSE(torn);
+        REQUIRE(mailbox.Read().scale == 20000.0f);
+    }
+}
+
 // ============================================================================
 // GameProjectile Tests (Real Implementation)
 // ============================================================================
@@ -138,6 +203,44 @@ TEST_CASE("GameProjectile", "[projectile][game]") {
         gp.Unbind();
         REQUIRE_FALSE(gp.IsBound());
     }
+
+    SECTION("Parked projectile is held still and hidden") {
+        RE::Projectile proj;
+        RE::NiNode node;
+        proj.Set3D(&node);
+        proj.GetVelocity() = RE::NiPoint3(4, 5, 6);
+        proj.GetProjectileRuntimeData().velocity = RE::NiPoint3(1, 1, 1);
+
+        GameProjectile::HoldParked(&proj);
+        REQUIRE(proj.GetVelocity() == RE::NiPoint3(0, 0, 0));
+        REQUIRE(proj.GetProjectileRuntimeData().velocity == RE::NiPoint3(0, 0, 0));
+        REQUIRE(node.local.scale < 0.001f);
+
+        GameProjectile::HoldParked(nullptr);  // No-op
+    }
+
+    SECTION("Hook applies to the projectile it is handed") {
+        RE::Projectile proj;
+        RE::NiNode node;
+        proj.Set3D(&node);
+
+        GameProjectile gp;
+        gp.BindToProjectile(&proj);
+        REQUIRE(gp.IsBoundTo(&proj));
+        REQUIRE_FALSE(gp.IsBoundTo(nullptr));
+
+        ProjectileTransform t;
+        t.position = RE::NiPoint3(7, 8, 9);
+        t.scale = 2.0f;
+        gp.SetTransform(t);
+        gp.ApplyTransform(&proj);
+        REQUIRE(proj.GetPosition() == RE::NiPoint3(7, 8, 9));
+        REQUIRE(node.local.translate == RE::NiPoint3(7, 8, 9));
+        REQUIRE(node.local.scale == 2.0f);
+
+        gp.Unbind();
+        REQUIRE_FALSE(gp.IsBoundTo(&proj));
+    }
 }
 
 // ============================================================================
@@ -0,0 +1,73 @@
+#include <catch2/catch_all.hpp>
+
+#include "util/StringTable.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Util::InternedString;
+using Util::StringTable;
+
+// ============================================================================
+// StringTable / InternedString Tests
+// ============================================================================
+
+TEST_CASE("InternedString shares one copy per distinct string", "[strings]") {
+    InternedString a("meshes\\test\\shared.nif");
+    InternedString b(std::string("meshes\\test\\shared.nif"));
+    InternedString c("meshes\\test\\other.nif");
+
+    REQUIRE(a == b);
+    REQUIRE(a.GetId() == b.GetId());
+    REQUIRE(a != c);
+    REQUIRE(a.c_str() == b.c_str());  // Same storage
+    REQUIRE(a == "meshes\\test\\shared.nif");
+    REQUIRE(std::string(c.c_str()) == "meshes\\test\\other.nif");
+    REQUIRE(c.size() == std::string("meshes\\test\\other.nif").size());
+
+    size_t count = StringTable::GetSingleton().GetCount();
+    InternedString again("meshes\\test\\other.nif");
+    REQUIRE(StringTable::GetSingleton().GetCount() == count);
+    REQUIRE(InternedString::Hash{}(again) == InternedString::Hash{}(c));
+}
+
+TEST_CASE("InternedString empty string is ID 0", "[strings]") {
+    InternedString empty;
+    REQUIRE(empty.empty());
+    REQUIRE(empty.GetId() == 0);
+    REQUIRE(empty == "");
+    REQUIRE(std::string(empty.c_str()).empty());
+    REQUIRE(InternedString("") == empty);
+    REQUIRE(InternedString(static_cast<const char*>(nullptr)) == empty);
+}
+
+TEST_CASE("StringTable interns concurrently while readers resolve IDs", "[strings]") {
+    // Enough strings to spill over the first two chunks
+    constexpr int COUNT = 5000;
+    std::vector<std::vector<uint32_t>> ids(4, std::vector<uint32_t>(COUNT));
+    std::atomic<bool> mismatch{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < COUNT; ++i) {
+                std::string str = "concurrent\\item" + std::to_string(i) + ".dds";
+                InternedString interned(str);
+                ids[t][i] = interned.GetId();
+                if (interned.view() != str) {
+                    mismatch = true;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE_FALSE(mismatch.load());
+    for (int t = 1; t < 4; ++t) {
+        REQUIRE(ids[t] == ids[0]);
+    }
+}
@@ -0,0 +1,185 @@
+#include <catch2/catch_all.hpp>
+
+#include "projectile/TextLayout.h"
+
+#include <string>
+#include <vector>
+
+using namespace Projectile;
+using Catch::Approx;
+
+// ============================================================================
+// Text Layout Tests
+// ============================================================================
+
+namespace {
+    // Digits are 0.5 cells wide, letters 0.8, space 0.3; '#' is missing from the atlas
+    GlyphMetrics FakeMetrics(wchar_t ch) {
+        static const TextAssets::UVCoord s_digitUVs[10] = {
+            {0, 0}, {1, 0}, {2, 0}, {3, 0}, {4, 0}, {5, 0}, {6, 0}, {7, 0}, {8, 0}, {9, 0}
+        };
+        static const TextAssets::UVCoord s_letterUV(0, 1);
+
+        if (ch >= L'0' && ch <= L'9') {
+            return {0.5f, &s_digitUVs[ch - L'0']};
+        }
+        if (ch == L' ' || ch == L'\t') {
+            return {0.3f, nullptr};
+        }
+        if (ch == L'#') {
+            return {0.0f, nullptr};
+        }
+        return {0.8f, &s_letterUV};
+    }
+
+    // Advance of a digit
+    constexpr float DIGIT_STEP = TextAssets::BASE_LETTER_DISTANCE * (0.5f + TextAssets::CHAR_GAP);
+
+    TextLayoutParams Params(TextAlignment alignment) {
+        TextLayoutParams params;
+        params.alignment = alignment;
+        return params;
+    }
+
+    // Apply a layout to fresh nodes and return the update count for the next one
+    size_t CountUpdates(const TextLayout& from, const TextLayout& to, size_t nodeCount,
+                        std::vector<GlyphNodeUpdate>& updates)
+    {
+        std::vector<GlyphNodeState> states(nodeCount);
+        PlanGlyphNodeUpdates(from, states, updates);
+        updates.clear();
+        PlanGlyphNodeUpdates(to, states, updates);
+        return updates.size();
+    }
+}
+
+TEST_CASE("TextLayout aligns each line on its glyphs", "[text]") {
+    std::wstring text = L"12";
+
+    auto center = TextLayout::Compute(text, Params(TextAlignment::Center), &FakeMetrics);
+    REQUIRE(center.glyphs.size() == 2);
+    REQUIRE(center.glyphs[0].x == Approx(-DIGIT_STEP / 2));
+    REQUIRE(center.glyphs[1].x == Approx(DIGIT_STEP / 2));
+
+    auto left = TextLayout::Compute(text, Params(TextAlignment::Left), &FakeMetrics);
+    REQUIRE(left.glyphs[0].x == Approx(0.0f));
+    REQUIRE(left.glyphs[1].x == Approx(DIGIT_STEP));
+
+    auto right = TextLayout::Compute(text, Params(TextAlignment::Right), &FakeMetrics);
+    REQUIRE(right.glyphs[0].x == Approx(-DIGIT_STEP));
+    REQUIRE(right.glyphs[1].x == Approx(0.0f).margin(1e-4));
+
+    // Bounds span the glyphs' left edges plus the last glyph's width
+    REQUIRE(left.bounds.minX == Approx(0.0f));
+    REQUIRE(left.bounds.maxX == Approx(DIGIT_STEP + TextAssets::BASE_LETTER_DISTANCE * 0.5f));
+    REQUIRE(left.bounds.height == Approx(100.0f));
+}
+
+TEST_CASE("TextLayout skips whitespace and stacks lines", "[text]") {
+    TextLayoutParams params = Params(TextAlignment::Left);
+    params.lineSpacing = 1.5f;
+    auto layout = TextLayout::Compute(L"1 2\n3#\n\n4", params, &FakeMetrics);
+
+    // Only non-whitespace characters get glyphs, the missing one hidden
+    REQUIRE(layout.glyphs.size() == 5);
+    REQUIRE(layout.glyphs[1].ch == L'2');
+    REQUIRE(layout.glyphs[1].x == Approx(DIGIT_STEP + TextAssets::BASE_LETTER_DISTANCE * 0.4f));
+    REQUIRE(layout.glyphs[3].ch == L'#');
+    REQUIRE_FALSE(layout.glyphs[3].visible);
+    REQUIRE(layout.glyphs[2].uv.col == 3);
+
+    // Empty lines still advance
+    REQUIRE(layout.glyphs[0].y == Approx(0.0f));
+    REQUIRE(layout.glyphs[2].y == Approx(-150.0f));
+    REQUIRE(layout.glyphs[4].y == Approx(-450.0f));
+    REQUIRE(layout.bounds.maxY == Approx(50.0f));
+    REQUIRE(layout.bounds.minY == Approx(-500.0f));
+
+    REQUIRE(TextLayout::Compute(L"", params, &FakeMetrics).glyphs.empty());
+    REQUIRE(TextLayout::Compute(L" \n ", params, &FakeMetrics).bounds.IsEmpty());
+}
+
+TEST_CASE("TextLayoutCache shares layouts per text and parameters", "[text]") {
+    TextLayoutCache cache(&FakeMetrics, 2);
+
+    auto a = cache.Get(L"Gold", Params(TextAlignment::Center));
+    auto again = cache.Get(L"Gold", Params(TextAlignment::Center));
+    REQUIRE(a == again);
+
+    auto leftA = cache.Get(L"Gold", Params(TextAlignment::Left));
+    REQUIRE(leftA != a);
+
+    auto stats = cache.GetStats();
+    REQUIRE(stats.hits == 1);
+    REQUIRE(stats.misses == 2);
+    REQUIRE(stats.entries == 2);
+
+    // "Gold"/Center was used least recently - a third entry evicts it
+    cache.Get(L"Weight", Params(TextAlignment::Center));
+    REQUIRE(cache.GetStats().evictions == 1);
+    REQUIRE(cache.Get(L"Gold", Params(TextAlignment::Left)) == leftA);
+
+    // Evicted layouts stay valid for whoever holds them
+    REQUIRE(a->glyphs.size() == 4);
+    REQUIRE(cache.Get(L"Gold", Params(TextAlignment::Center)) != a);
+
+    cache.Clear();
+    REQUIRE(cache.GetStats().entries == 0);
+}
+
+TEST_CASE("PlanGlyphNodeUpdates rewrites only changed glyphs", "[text]") {
+    auto params = Params(TextAlignment::Center);
+    std::vector<GlyphNodeUpdate> updates;
+
+    SECTION("Fresh nodes are fully written, surplus nodes hidden") {
+        auto layout = TextLayout::Compute(L"12", params, &FakeMetrics);
+        std::vector<GlyphNodeState> states(4);
+        PlanGlyphNodeUpdates(layout, states, updates);
+
+        REQUIRE(updates.size() == 4);
+        uint8_t all = GlyphNodeUpdate::Show | GlyphNodeUpdate::Move | GlyphNodeUpdate::SetUV;
+        REQUIRE(updates[0].ops == all);
+        REQUIRE(updates[1].ops == all);
+        REQUIRE(updates[2].ops == GlyphNodeUpdate::Hide);
+        REQUIRE(updates[3].ops == GlyphNodeUpdate::Hide);
+        REQUIRE(states[1].x == Approx(layout.glyphs[1].x));
+        REQUIRE(states[1].uv.col == 2);
+    }
+
+    SECTION("Same text needs no updates") {
+        auto layout = TextLayout::Compute(L"Gold 12", params, &FakeMetrics);
+        REQUIRE(CountUpdates(layout, layout, 8, updates) == 0);
+    }
+
+    SECTION("A ticking counter rewrites one UV") {
+        auto before = TextLayout::Compute(L"12", params, &FakeMetrics);
+        auto after = TextLayout::Compute(L"13", params, &FakeMetrics);
+        REQUIRE(CountUpdates(before, after, 4, updates) == 1);
+        REQUIRE(updates[0].node == 1);
+        REQUIRE(updates[0].ops == GlyphNodeUpdate::SetUV);
+    }
+
+    SECTION("Growing text moves the shifted glyphs and shows the new one") {
+        auto before = TextLayout::Compute(L"9", params, &FakeMetrics);
+        auto after = TextLayout::Compute(L"10", params, &FakeMetrics);
+        REQUIRE(CountUpdates(before, after, 2, updates) == 2);
+        REQUIRE(updates[0].ops == (GlyphNodeUpdate::Move | GlyphNodeUpdate::SetUV));
+        REQUIRE(updates[1].ops == (GlyphNodeUpdate::Show | GlyphNodeUpdate::Move | GlyphNodeUpdate::SetUV));
+    }
+
+    SECTION("Shrinking text hides the freed nodes") {
+        auto before = TextLayout::Compute(L"100", params, &FakeMetrics);
+        auto after = TextLayout::Compute(L"", params, &FakeMetrics);
+        REQUIRE(CountUpdates(before, after, 3, updates) == 3);
+        for (const auto& update : updates) {
+            REQUIRE(update.ops == GlyphNodeUpdate::Hide);
+        }
+    }
+
+    SECTION("Glyphs beyond the node count are dropped") {
+        auto layout = TextLayout::Compute(L"12345", params, &FakeMetrics);
+        std::vector<GlyphNodeState> states(3);
+        PlanGlyphNodeUpdates(layout, states, updates);
+        REQUIRE(updates.size() == 3);
+    }
+}
@@ -0,0 +1,128 @@
+#include <catch2/catch_all.hpp>
+
+#include "projectile/TextureCache.h"
+
+#include <memory>
+#include <string>
+
+using namespace Projectile;
+
+// ============================================================================
+// TextureCache Tests
+// ============================================================================
+
+namespace {
+    // Stand-in for NiPointer<NiTexture>: shared handle, empty when not found
+    struct FakeTexture {
+        int id = 0;
+    };
+    using FakeTexturePtr = std::shared_ptr<FakeTexture>;
+    using FakeCache = TextureCache<FakeTexturePtr>;
+
+    FakeTexturePtr MakeTexture(int id) { return std::make_shared<FakeTexture>(FakeTexture{id}); }
+
+    InternedString Path(int id) { return InternedString("textures\\cache_test\\icon" + std::to_string(id) + ".dds"); }
+}
+
+TEST_CASE("TextureCache evicts least recently used past the budget", "[textures]") {
+    FakeCache cache(300);
+    cache.Insert(Path(1), MakeTexture(1), 100);
+    cache.Insert(Path(2), MakeTexture(2), 100);
+    cache.Insert(Path(3), MakeTexture(3), 100);
+    REQUIRE(cache.GetBytes() == 300);
+
+    // Touch 1 so 2 is least recently used
+    REQUIRE(cache.Find(Path(1))->id == 1);
+    cache.Insert(Path(4), MakeTexture(4), 100);
+
+    REQUIRE(cache.Contains(Path(1)));
+    REQUIRE_FALSE(cache.Contains(Path(2)));
+    REQUIRE(cache.Contains(Path(3)));
+    REQUIRE(cache.Contains(Path(4)));
+    REQUIRE(cache.GetBytes() == 300);
+
+    auto stats = cache.GetStats();
+    REQUIRE(stats.evictions == 1);
+    REQUIRE(stats.evictedBytes == 100);
+    REQUIRE(stats.peakBytes == 400);
+    REQUIRE(stats.entries == 3);
+}
+
+TEST_CASE("TextureCache counts hits and misses", "[textures]") {
+    FakeCache cache;
+    cache.Insert(Path(1), MakeTexture(1), 10);
+
+    REQUIRE(cache.Find(Path(1)));
+    REQUIRE_FALSE(cache.Find(Path(2)));
+    REQUIRE_FALSE(cache.Find(Path(2), false));
+
+    auto stats = cache.GetStats();
+    REQUIRE(stats.hits == 1);
+    REQUIRE(stats.misses == 1);
+}
+
+TEST_CASE("TextureCache never evicts pinned textures", "[textures]") {
+    FakeCache cache(200);
+    cache.Pin(Path(1));  // Pinned before it loads
+    cache.Insert(Path(1), MakeTexture(1), 100);
+    cache.Insert(Path(2), MakeTexture(2), 100);
+    cache.Insert(Path(3), MakeTexture(3), 100);
+
+    REQUIRE(cache.Contains(Path(1)));
+    REQUIRE_FALSE(cache.Contains(Path(2)));
+    REQUIRE(cache.GetStats().pinnedEntries == 1);
+
+    SECTION("Unpinning lets it go once over budget") {
+        cache.SetBudget(50);
+        REQUIRE(cache.Contains(Path(1)));  // Pinned - cache stays over budget
+        REQUIRE_FALSE(cache.Contains(Path(3)));
+        REQUIRE(cache.GetBytes() == 100);
+
+        cache.Unpin(Path(1));
+        REQUIRE(cache.Size() == 0);
+        REQUIRE(cache.GetBytes() == 0);
+    }
+
+    SECTION("Pins nest") {
+        cache.Pin(Path(1));
+        cache.Unpin(Path(1));
+        REQUIRE(cache.IsPinned(Path(1)));
+        cache.Unpin(Path(1));
+        REQUIRE_FALSE(cache.IsPinned(Path(1)));
+    }
+
+    SECTION("Clear keeps pinned textures") {
+        cache.Clear();
+        REQUIRE(cache.Size() == 1);
+        REQUIRE(cache.Find(Path(1))->id == 1);
+        REQUIRE(cache.GetBytes() == 100);
+    }
+}
+
+TEST_CASE("TextureCache keeps a texture larger than the budget until replaced", "[textures]") {
+    FakeCache cache(100);
+    cache.Insert(Path(1), MakeTexture(1), 50);
+    cache.Insert(Path(2), MakeTexture(2), 500);
+    REQUIRE(cache.Contains(Path(2)));
+    REQUIRE_FALSE(cache.Contains(Path(1)));
+
+    // Replacing an entry re-accounts its size
+    cache.Insert(Path(2), MakeTexture(22), 80);
+    REQUIRE(cache.GetBytes() == 80);
+    REQUIRE(cache.Find(Path(2))->id == 22);
+}
+
+TEST_CASE("EstimateTextureBytes sizes common icon formats", "[textures]") {
+    constexpr uint32_t BC1_UNORM = 71;
+    constexpr uint32_t BC3_UNORM = 77;
+    constexpr uint32_t R8G8B8A8_UNORM = 28;
+
+    REQUIRE(EstimateTextureBytes(256, 256, 1, 1, R8G8B8A8_UNORM) == 256 * 256 * 4);
+    REQUIRE(EstimateTextureBytes(256, 256, 1, 1, BC3_UNORM) == 256 * 256);
+    REQUIRE(EstimateTextureBytes(256, 256, 1, 1, BC1_UNORM) == 256 * 256 / 2);
+
+    // Full mip chain: 4x4 down to 1x1 still takes a whole block per level
+    REQUIRE(EstimateTextureBytes(4, 4, 3, 1, BC1_UNORM) == 3 * 8);
+    REQUIRE(EstimateTextureBytes(256, 256, 9, 1, R8G8B8A8_UNORM) > 256 * 256 * 4);
+    REQUIRE(EstimateTextureBytes(64, 64, 1, 6, R8G8B8A8_UNORM) == 6 * 64 * 64 * 4);
+}
@@ -0,0 +1,94 @@
+#include <catch2/catch_all.hpp>
+
+#include "projectile/TextureRequestQueue.h"
+
+#include <vector>
+
+using namespace Projectile;
+
+// ============================================================================
+// TextureRequestQueue Tests
+// ============================================================================
+
+namespace {
+    std::vector<TextureRequestQueue::Key> DrainKeys(TextureRequestQueue& queue) {
+        std::vector<TextureRequestQueue::Key> keys;
+        TextureRequestQueue::Key key;
+        TextureRequestQueue::Clock::duration waited;
+        while (queue.Pop(key, waited)) {
+            keys.push_back(key);
+        }
+        return keys;
+    }
+}
+
+TEST_CASE("TextureRequestQueue pops most urgent first, FIFO among equals", "[textures]") {
+    TextureRequestQueue queue;
+    queue.Push(1, 1, 5.0f);
+    queue.Push(2, 2, 1.0f);
+    queue.Push(3, 3, 5.0f);
+    queue.Push(4, 4, 0.0f);
+
+    REQUIRE(queue.Size() == 4);
+    REQUIRE(DrainKeys(queue) == std::vector<TextureRequestQueue::Key>{4, 2, 1, 3});
+    REQUIRE(queue.Empty());
+}
+
+TEST_CASE("TextureRequestQueue visible icons go before hidden ones", "[textures]") {
+    float nearVisible = TextureRequestQueue::MakePriority(true, 50.0f);
+    float farVisible = TextureRequestQueue::MakePriority(true, 50000.0f);
+    float nearHidden = TextureRequestQueue::MakePriority(false, 10.0f);
+
+    REQUIRE(nearVisible < farVisible);
+    REQUIRE(farVisible < nearHidden);
+}
+
+TEST_CASE("TextureRequestQueue merges requests for the same texture", "[textures]") {
+    TextureRequestQueue queue;
+    queue.Push(1, 1, 10.0f);
+    queue.Push(2, 2, 5.0f);
+    queue.Push(3, 3, 20.0f);
+    queue.Push(3, 4, 1.0f);  // Raises texture 3 to most urgent
+
+    REQUIRE(queue.Size() == 3);
+    REQUIRE(DrainKeys(queue) == std::vector<TextureRequestQueue::Key>{3, 2, 1});
+}
+
+TEST_CASE("TextureRequestQueue drops loads nobody wants", "[textures]") {
+    TextureRequestQueue queue;
+    constexpr uint64_t a = 1, b = 2;
+    queue.Push(1, a, 0.0f);
+    queue.Push(1, b, 0.0f);
+    queue.Push(2, 3, 1.0f);
+
+    SECTION("Load stays while any request is live") {
+        REQUIRE_FALSE(queue.Cancel(a));
+        REQUIRE(queue.Contains(1));
+        REQUIRE(DrainKeys(queue) == std::vector<TextureRequestQueue::Key>{1, 2});
+    }
+
+    SECTION("Cancelling every request drops the load") {
+        REQUIRE_FALSE(queue.Cancel(a));
+        REQUIRE(queue.Cancel(b));
+        REQUIRE_FALSE(queue.Contains(1));
+        REQUIRE(queue.GetDroppedCount() == 1);
+        REQUIRE(DrainKeys(queue) == std::vector<TextureRequestQueue::Key>{2});
+    }
+
+    SECTION("Cancelling after the pop is ignored") {
+        TextureRequestQueue::Key key;
+        TextureRequestQueue::Clock::duration waited;
+        REQUIRE(queue.Pop(key, waited));
+        REQUIRE(key == 1);
+        REQUIRE_FALSE(queue.Cancel(a));
+        REQUIRE_FALSE(queue.Cancel(b));
+        REQUIRE(queue.GetDroppedCount() == 0);
+    }
+
+    SECTION("A re-request after dropping queues fresh") {
+        queue.Cancel(a);
+        queue.Cancel(b);
+        queue.Push(1, 4, 2.0f);
+        REQUIRE(DrainKeys(queue) == std::vector<TextureRequestQueue::Key>{2, 1});
+    }
+}
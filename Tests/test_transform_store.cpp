@@ -0,0 +1,455 @@
+#include <catch2/catch_all.hpp>
+
+#include "projectile/IPositionable.h"
+#include "projectile/SmoothingKernels.h"
+#include "projectile/TransformStore.h"
+#include "projectile/TransformSmoother.h"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Projectile;
+
+// ============================================================================
+// TransformStore Tests
+// ============================================================================
+
+namespace {
+    ProjectileTransform MakeTransform(float x, float y, float z, float scale) {
+        ProjectileTransform t;
+        t.position = RE::NiPoint3(x, y, z);
+        t.scale = scale;
+        return t;
+    }
+}
+
+TEST_CASE("TransformStore slot lifecycle", "[transform][store]") {
+    TransformStore store;
+
+    SECTION("Allocate returns live handles") {
+        auto a = store.Allocate();
+        auto b = store.Allocate();
+        REQUIRE(a.IsValid());
+        REQUIRE(store.IsAlive(a));
+        REQUIRE(store.IsAlive(b));
+        REQUIRE(store.GetLiveCount() == 2);
+    }
+
+    SECTION("Released handle becomes stale even after slot reuse") {
+        auto a = store.Allocate();
+        store.Release(a);
+        REQUIRE_FALSE(store.IsAlive(a));
+
+        auto b = store.Allocate();
+        REQUIRE(b.index == a.index);
+        REQUIRE(store.IsAlive(b));
+        REQUIRE_FALSE(store.IsAlive(a));
+
+        // Stale handle writes are ignored
+        store.SetCurrent(a, MakeTransform(1, 2, 3, 1));
+        REQUIRE(store.GetCurrent(b).position.x == 0.0f);
+    }
+
+    SECTION("Swap-remove keeps other slots intact") {
+        auto a = store.Allocate();
+        auto b = store.Allocate();
+        auto c = store.Allocate();
+        store.SetCurrent(a, MakeTransform(1, 0, 0, 1));
+        store.SetCurrent(b, MakeTransform(2, 0, 0, 1));
+        store.SetCurrent(c, MakeTransform(3, 0, 0, 1));
+
+        store.Release(a);
+
+        REQUIRE(store.GetLiveCount() == 2);
+        REQUIRE(store.GetCurrent(b).position.x == 2.0f);
+        REQUIRE(store.GetCurrent(c).position.x == 3.0f);
+    }
+
+    SECTION("Invalid handle is never alive") {
+        REQUIRE_FALSE(store.IsAlive(TransformHandle{}));
+    }
+}
+
+TEST_CASE("TransformStore matches TransformSmoother", "[transform][store]") {
+    TransformStore store;
+    auto handle = store.Allocate();
+    TransformSmoother smoother;
+
+    store.SetSpeed(handle, 8.0f);
+    smoother.SetSpeed(8.0f);
+
+    ProjectileTransform start = MakeTransform(0, 0, 0, 1.0f);
+    ProjectileTransform target = MakeTransform(100, -50, 25, 2.0f);
+    target.rotation.entry[0][1] = 0.5f;
+
+    store.SetCurrent(handle, start);
+    smoother.SetCurrent(start);
+
+    SECTION("Bit-identical results over several frames") {
+        for (int frame = 0; frame < 30; ++frame) {
+            store.Retarget(handle, target);
+            store.Update(0.016f);
+            smoother.SetTarget(target);
+            smoother.Update(0.016f);
+
+            auto a = store.GetCurrent(handle);
+            const auto& b = smoother.GetCurrent();
+            REQUIRE(a.position.x == b.position.x);
+            REQUIRE(a.position.y == b.position.y);
+            REQUIRE(a.position.z == b.position.z);
+            REQUIRE(a.scale == b.scale);
+            REQUIRE(a.rotation.entry[0][1] == b.rotation.entry[0][1]);
+        }
+    }
+
+    SECTION("Slots not retargeted this frame are not advanced") {
+        store.Retarget(handle, target);
+        store.Update(0.016f);
+        float afterFirst = store.GetCurrent(handle).position.x;
+
+        store.Update(0.016f);  // No Retarget - owner was not updated (e.g. hidden)
+        REQUIRE(store.GetCurrent(handle).position.x == afterFirst);
+    }
+
+    SECTION("Elapsed time smooths over the owner's accumulated delta") {
+        // Owner skipped two frames (scheduler) and catches up with all of their time
+        store.Retarget(handle, target, nullptr, 0.048f);
+        store.Update(0.016f);
+        smoother.SetTarget(target);
+        smoother.Update(0.048f);
+
+        auto a = store.GetCurrent(handle);
+        const auto& b = smoother.GetCurrent();
+        REQUIRE(a.position.x == Catch::Approx(b.position.x));
+        REQUIRE(a.scale == Catch::Approx(b.scale));
+    }
+
+    SECTION("Instant mode applies target immediately") {
+        store.SetMode(handle, TransitionMode::Instant);
+        store.Retarget(handle, target);
+        REQUIRE(store.GetCurrent(handle).position.x == 100.0f);
+        REQUIRE_FALSE(store.IsTransitioning(handle));
+    }
+
+    SECTION("Invalid deltaTime does not corrupt state") {
+        store.Retarget(handle, target);
+        store.Update(std::numeric_limits<float>::quiet_NaN());
+        REQUIRE(store.GetCurrent(handle).position.x == 0.0f);
+    }
+}
+
+TEST_CASE("TransformStore publishes to bound output", "[transform][store]") {
+    TransformStore store;
+    auto handle = store.Allocate();
+    GameProjectile output;
+    store.SetMode(handle, TransitionMode::Instant);
+
+    SECTION("Output receives current transform on Update") {
+        store.SetOutput(handle, &output);
+        store.Retarget(handle, MakeTransform(5, 6, 7, 1.5f));
+        store.Update(0.016f);
+        REQUIRE(output.GetTargetTransform().position.y == 6.0f);
+        REQUIRE(output.GetTargetTransform().scale == 1.5f);
+    }
+
+    SECTION("Cleared output receives nothing") {
+        store.SetOutput(handle, &output);
+        store.SetOutput(handle, nullptr);
+        store.Retarget(handle, MakeTransform(5, 6, 7, 1.5f));
+        store.Update(0.016f);
+        REQUIRE(output.GetTargetTransform().position.y == 0.0f);
+    }
+}
+
+TEST_CASE("Slerp transition mode", "[transform][store][slerp]") {
+    ProjectileTransform start = MakeTransform(0, 0, 0, 1.0f);
+    ProjectileTransform target = MakeTransform(10, 0, 0, 1.0f);
+    target.rotation = EulerToMatrix(RE::NiPoint3(0.0f, 0.0f, 2.0f));
+
+    SECTION("TransformSmoother eases rotation toward target") {
+        TransformSmoother smoother;
+        smoother.SetMode(TransitionMode::Slerp);
+        smoother.SetCurrent(start);
+        smoother.SetTarget(target);
+        REQUIRE(smoother.IsTransitioning());
+
+        smoother.Update(0.016f);
+        float yaw = MatrixToEuler(smoother.GetCurrent().rotation).z;
+        REQUIRE(yaw > 0.0f);
+        REQUIRE(yaw < 2.0f);
+
+        // Converges on the target
+        for (int frame = 0; frame < 200; ++frame) {
+            smoother.Update(0.016f);
+        }
+        REQUIRE(MatrixToEuler(smoother.GetCurrent().rotation).z == Catch::Approx(2.0f).margin(0.001f));
+    }
+
+    SECTION("Lerp mode still snaps rotation") {
+        TransformSmoother smoother;
+        smoother.SetCurrent(start);
+        smoother.SetTarget(target);
+        smoother.Update(0.016f);
+        REQUIRE(MatrixToEuler(smoother.GetCurrent().rotation).z == Catch::Approx(2.0f));
+    }
+
+    SECTION("TransformStore matches TransformSmoother") {
+        TransformStore store;
+        auto handle = store.Allocate();
+        store.SetMode(handle, TransitionMode::Slerp);
+        TransformSmoother smoother;
+        smoother.SetMode(TransitionMode::Slerp);
+
+        store.SetCurrent(handle, start);
+        smoother.SetCurrent(start);
+
+        for (int frame = 0; frame < 30; ++frame) {
+            store.Retarget(handle, target);
+            store.Update(0.016f);
+            smoother.SetTarget(target);
+            smoother.Update(0.016f);
+
+            auto a = store.GetCurrent(handle);
+            const auto& b = smoother.GetCurrent();
+            REQUIRE(a.position.x == b.position.x);
+            for (int r = 0; r < 3; ++r) {
+                for (int c = 0; c < 3; ++c) {
+                    REQUIRE(a.rotation.entry[r][c] == b.rotation.entry[r][c]);
+                }
+            }
+        }
+    }
+
+    SECTION("A changed target rotation is picked up mid-transition") {
+        ProjectileTransform turned = target;
+        turned.rotation = EulerToMatrix(RE::NiPoint3(0.0f, 0.0f, -1.0f));
+
+        TransformStore store;
+        auto handle = store.Allocate();
+        store.SetMode(handle, TransitionMode::Slerp);
+        store.SetCurrent(handle, start);
+        TransformSmoother smoother;
+        smoother.SetMode(TransitionMode::Slerp);
+        smoother.SetCurrent(start);
+
+        for (int frame = 0; frame < 200; ++frame) {
+            const auto& frameTarget = frame < 3 ? target : turned;
+            store.Retarget(handle, frameTarget);
+            store.Update(0.016f);
+            smoother.SetTarget(frameTarget);
+            smoother.Update(0.016f);
+        }
+        REQUIRE(MatrixToEuler(store.GetCurrent(handle).rotation).z == Catch::Approx(-1.0f).margin(0.001f));
+        REQUIRE(MatrixToEuler(smoother.GetCurrent().rotation).z == Catch::Approx(-1.0f).margin(0.001f));
+    }
+}
+
+TEST_CASE("Converged transitions come to rest", "[transform][store][rest]") {
+    ProjectileTransform target = MakeTransform(10, -20, 5, 1.5f);
+
+    SECTION("TransformSmoother snaps to target and stops transitioning") {
+        TransformSmoother smoother;
+        smoother.SetTarget(target);
+        int frames = 0;
+        while (smoother.IsTransitioning() && frames < 1000) {
+            smoother.Update(0.016f);
+            ++frames;
+        }
+        REQUIRE_FALSE(smoother.IsTransitioning());
+        REQUIRE(frames > 1);
+        REQUIRE(smoother.GetCurrent().position.x == 10.0f);
+        REQUIRE(smoother.GetCurrent().scale == 1.5f);
+    }
+
+    SECTION("TransformStore slot converges like TransformSmoother") {
+        TransformStore store;
+        auto handle = store.Allocate();
+        TransformSmoother smoother;
+
+        int storeFrames = 0;
+        do {
+            store.Retarget(handle, target);
+            store.Update(0.016f);
+            ++storeFrames;
+        } while (store.IsTransitioning(handle) && storeFrames < 1000);
+
+        int smootherFrames = 0;
+        do {
+            smoother.SetTarget(target);
+            smoother.Update(0.016f);
+            ++smootherFrames;
+        } while (smoother.IsTransitioning() && smootherFrames < 1000);
+
+        REQUIRE(storeFrames == smootherFrames);
+        REQUIRE(store.GetCurrent(handle).position.y == -20.0f);
+    }
+
+    SECTION("A converged slot publishes nothing until retargeted") {
+        TransformStore store;
+        auto handle = store.Allocate();
+        GameProjectile output;
+        store.SetOutput(handle, &output);
+        store.SetMode(handle, TransitionMode::Instant);
+        store.Retarget(handle, target);
+        store.Update(0.016f);
+
+        REQUIRE(output.GetTargetTransform().position.x == 10.0f);
+
+        output.SetTransform(MakeTransform(0, 0, 0, 1.0f));  // Marker
+        store.Update(0.016f);  // Owner at rest - no Retarget this frame
+        REQUIRE(output.GetTargetTransform().position.x == 0.0f);
+    }
+}
+
+// ============================================================================
+// SmoothingKernels: SIMD paths must match the scalar path bit-for-bit
+// ============================================================================
+
+namespace {
+    std::vector<SmoothingKernels::SimdLevel> SupportedSimdLevels() {
+        using SmoothingKernels::SimdLevel;
+        std::vector<SimdLevel> levels = {SimdLevel::Scalar};
+        SimdLevel best = SmoothingKernels::DetectSimdLevel();
+        if (best >= SimdLevel::SSE2) levels.push_back(SimdLevel::SSE2);
+        if (best >= SimdLevel::AVX2) levels.push_back(SimdLevel::AVX2);
+        return levels;
+    }
+
+    bool BitEqual(float a, float b) {
+        return std::memcmp(&a, &b, sizeof(float)) == 0;
+    }
+}
+
+TEST_CASE("SmoothingKernels LerpMasked paths agree", "[transform][simd]") {
+    using SmoothingKernels::SimdLevel;
+
+    // Odd count exercises both full SIMD blocks and the scalar remainder
+    constexpr size_t count = 1003;
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> value(-1000.0f, 1000.0f);
+    std::uniform_real_distribution<float> factor(0.0f, 1.0f);
+
+    std::vector<float> current(count), target(count), factors(count);
+    std::vector<uint32_t> mask(count);
+    for (size_t i = 0; i < count; ++i) {
+        current[i] = value(rng);
+        target[i] = value(rng);
+        factors[i] = factor(rng);
+        mask[i] = (rng() % 3 == 0) ? 0u : 0xFFFFFFFFu;
+    }
+
+    std::vector<float> expected = current;
+    SmoothingKernels::LerpMasked(expected.data(), target.data(), factors.data(), mask.data(),
+                                 count, SimdLevel::Scalar);
+
+    for (SimdLevel level : SupportedSimdLevels()) {
+        DYNAMIC_SECTION("Level " << SmoothingKernels::ToString(level)) {
+            std::vector<float> actual = current;
+            SmoothingKernels::LerpMasked(actual.data(), target.data(), factors.data(), mask.data(),
+                                         count, level);
+            for (size_t i = 0; i < count; ++i) {
+                REQUIRE(BitEqual(actual[i], expected[i]));
+                if (!mask[i]) {
+                    REQUIRE(BitEqual(actual[i], current[i]));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("TransformStore SIMD levels match TransformSmoother", "[transform][store][simd]") {
+    using SmoothingKernels::SimdLevel;
+
+    constexpr size_t count = 37;
+    const float speeds[] = {13.0f, 13.0f, 8.0f, 20.0f};
+
+    for (SimdLevel level : SupportedSimdLevels()) {
+        DYNAMIC_SECTION("Level " << SmoothingKernels::ToString(level)) {
+            TransformStore store;
+            store.SetSimdLevel(level);
+            std::vector<TransformHandle> handles;
+            std::vector<TransformSmoother> smoothers(count);
+
+            for (size_t i = 0; i < count; ++i) {
+                handles.push_back(store.Allocate());
+                float speed = speeds[i % 4];
+                store.SetSpeed(handles.back(), speed);
+                smoothers[i].SetSpeed(speed);
+            }
+
+            for (int frame = 0; frame < 20; ++frame) {
+                for (size_t i = 0; i < count; ++i) {
+                    // Some elements skip frames (hidden) - they must not advance
+                    if ((i + frame) % 5 == 0) continue;
+                    auto target = MakeTransform(static_cast<float>(i) * 10.0f, -static_cast<float>(frame),
+                                                50.0f, 1.0f + static_cast<float>(i % 3));
+                    store.Retarget(handles[i], target);
+                    smoothers[i].SetTarget(target);
+                    smoothers[i].Update(0.011f);
+                }
+                store.Update(0.011f);
+
+                for (size_t i = 0; i < count; ++i) {
+                    auto a = store.GetCurrent(handles[i]);
+                    const auto& b = smoothers[i].GetCurrent();
+                    REQUIRE(BitEqual(a.position.x, b.position.x));
+                    REQUIRE(BitEqual(a.position.y, b.position.y));
+                    REQUIRE(BitEqual(a.position.z, b.position.z));
+                    REQUIRE(BitEqual(a.scale, b.scale));
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Benchmarks: per-object smoothers (AoS, heap-scattered) vs TransformStore (SoA)
+// Hidden from the default run - run: 3DUITests "[benchmark]"
+// ============================================================================
+
+TEST_CASE("TransformStore vs TransformSmoother throughput", "[.][benchmark][transform]") {
+    for (size_t count : {size_t{1000}, size_t{10000}}) {
+        ProjectileTransform target = MakeTransform(100, 50, 25, 2.0f);
+
+        // AoS: one heap-allocated smoother per element, as ControlledProjectile used to own
+        std::vector<std::unique_ptr<TransformSmoother>> smoothers;
+        smoothers.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            auto smoother = std::make_unique<TransformSmoother>();
+            smoother->SetTarget(target);
+            smoothers.push_back(std::move(smoother));
+        }
+
+        TransformStore store;
+        std::vector<TransformHandle> handles;
+        handles.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            handles.push_back(store.Allocate());
+            store.Retarget(handles.back(), target);
+        }
+
+        BENCHMARK("TransformSmoother x" + std::to_string(count)) {
+            for (auto& smoother : smoothers) {
+                smoother->Update(0.016f);
+            }
+            return smoothers.front()->GetCurrent().position.x;
+        };
+
+        BENCHMARK("TransformStore x" + std::to_string(count)) {
+            store.SmoothActive(0.016f);
+            return store.GetCurrent(handles.front()).position.x;
+        };
+
+        auto detected = store.GetSimdLevel();
+        store.SetSimdLevel(SmoothingKernels::SimdLevel::Scalar);
+        BENCHMARK("TransformStore (Scalar) x" + std::to_string(count)) {
+            store.SmoothActive(0.016f);
+            return store.GetCurrent(handles.front()).position.x;
+        };
+        store.SetSimdLevel(detected);
+    }
+}
@@ -0,0 +1,85 @@
+#include <catch2/catch_all.hpp>
+
+#include "projectile/WorkStealingPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace Projectile;
+using namespace std::chrono_literals;
+
+// ============================================================================
+// WorkStealingPool Tests
+// ============================================================================
+
+TEST_CASE("WorkStealingPool runs every task exactly once", "[pool]") {
+    WorkStealingPool pool;
+    size_t workers = GENERATE(0, 1, 3);
+    pool.Start(workers);
+    REQUIRE(pool.GetWorkerCount() == workers);
+
+    // Repeated jobs reuse the same threads
+    for (int job = 0; job < 50; ++job) {
+        std::vector<std::atomic<int>> hits(37);
+        pool.ParallelFor(hits.size(), [&](size_t i) {
+            hits[i].fetch_add(1, std::memory_order_relaxed);
+        });
+        for (auto& hit : hits) {
+            REQUIRE(hit.load() == 1);
+        }
+    }
+
+    SECTION("Empty jobs return immediately") {
+        bool ran = false;
+        pool.ParallelFor(0, [&](size_t) { ran = true; });
+        REQUIRE_FALSE(ran);
+    }
+}
+
+TEST_CASE("WorkStealingPool without workers runs on the caller", "[pool]") {
+    WorkStealingPool pool;
+    pool.Start(0);
+
+    auto caller = std::this_thread::get_id();
+    bool allOnCaller = true;
+    pool.ParallelFor(8, [&](size_t) {
+        allOnCaller = allOnCaller && std::this_thread::get_id() == caller;
+    });
+    REQUIRE(allOnCaller);
+}
+
+TEST_CASE("WorkStealingPool steals from a busy queue", "[pool]") {
+    WorkStealingPool pool;
+    pool.Start(1);
+
+    // Even tasks are dealt to the worker and are slow, odd ones to the caller and are fast,
+    // so the caller runs out of work first and takes over part of the worker's queue
+    std::atomic<int> done{0};
+    pool.ParallelFor(20, [&](size_t i) {
+        if (i % 2 == 0) {
+            std::this_thread::sleep_for(2ms);
+        }
+        done.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    REQUIRE(done.load() == 20);
+    REQUIRE(pool.GetStolenCount() > 0);
+}
+
+TEST_CASE("WorkStealingPool restarts with a different size", "[pool]") {
+    WorkStealingPool pool;
+    pool.Start(2);
+    pool.Start(1);
+    REQUIRE(pool.GetWorkerCount() == 1);
+
+    std::atomic<int> done{0};
+    pool.ParallelFor(10, [&](size_t) { done.fetch_add(1, std::memory_order_relaxed); });
+    REQUIRE(done.load() == 10);
+
+    pool.Stop();
+    REQUIRE(pool.GetWorkerCount() == 0);
+    pool.ParallelFor(3, [&](size_t) { done.fetch_add(1, std::memory_order_relaxed); });
+    REQUIRE(done.load() == 13);
+}
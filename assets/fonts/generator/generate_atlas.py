@@ -9,6 +9,7 @@ Output is a PNG file that is converted to DDS using texconv.
 import sys
 import csv
 import shutil
+import struct
 import subprocess
 from pathlib import Path
 from PIL import Image, ImageDraw, ImageFont
@@ -41,6 +42,9 @@ BASELINE_RATIO = 0.75  # Baseline at 75% from top of cell
 OUTPUT_PNG = "text_atlas_main.png"
 OUTPUT_DDS = "text_atlas_main.dds"
 OUTPUT_CSV = "text_atlas_main_mapping.csv"
+OUTPUT_BIN = "text_atlas_main_mapping.bin"  # Precompiled metrics - see GlyphMetricsTable.h
+OUTPUT_KERNING = "text_atlas_main_kerning.csv"  # Pair kerning - see KerningTable in FontRegistry.h
+KERNING_MIN = 0.005  # Smallest adjustment (in width ratio units) worth writing
 TEXCONV_PATH = "texconv"  # Assumes texconv is in PATH
 DDS_FORMAT = "BC3_UNORM"
 
@@ -196,6 +200,50 @@ def save_csv_mapping(mapping_data):
     print(f"Saved mapping to: {csv_path}")
 
 
+def save_binary_mapping(mapping_data):
+    """Save the same metrics in the binary layout GlyphMetricsTable::ReadBinary expects"""
+    bin_path = Path(__file__).parent / OUTPUT_BIN
+
+    # Later rows for the same codepoint win, as when the plugin parses the CSV
+    glyphs = {}
+    for entry in mapping_data:
+        codepoint = int(entry['Unicode'][2:], 16)
+        glyphs[codepoint] = (int(entry['Row']), int(entry['Col']), float(entry['WidthRatio']))
+
+    with open(bin_path, 'wb') as f:
+        f.write(struct.pack('<4sII', b'3DGM', 1, len(glyphs)))
+        for codepoint in sorted(glyphs):
+            row, col, width_ratio = glyphs[codepoint]
+            f.write(struct.pack('<IHHf', codepoint, row, col, width_ratio))
+
+    print(f"Saved binary mapping to: {bin_path}")
+
+
+def save_kerning(characters):
+    """Save the font's pair kerning, in the width ratio units the mapping uses"""
+    kerning_path = Path(__file__).parent / OUTPUT_KERNING
+    font = ImageFont.truetype(FONT_PATH, FONT_SIZE)
+
+    glyphs = [char for char in characters if not char.isspace()]
+    advances = {char: font.getlength(char) for char in glyphs}
+
+    pairs = []
+    for left in glyphs:
+        for right in glyphs:
+            # The pair's advance differs from the sum of its glyphs' by the font's kerning
+            adjust = (font.getlength(left + right) - advances[left] - advances[right]) / CELL_SIZE
+            if abs(adjust) >= KERNING_MIN:
+                pairs.append((ord(left), ord(right), round(adjust, 4)))
+
+    with open(kerning_path, 'w', newline='', encoding='utf-8') as f:
+        writer = csv.writer(f)
+        writer.writerow(['Left', 'Right', 'Adjust'])
+        for left, right, adjust in pairs:
+            writer.writerow([f"U+{left:04X}", f"U+{right:04X}", adjust])
+
+    print(f"Saved {len(pairs)} kerning pairs to: {kerning_path}")
+
+
 def convert_to_dds(png_path):
     """Convert PNG to DDS using texconv"""
     output_dir = Path(__file__).parent
@@ -235,14 +283,16 @@ def deploy_files():
     DEPLOY_CSV_DIR.mkdir(parents=True, exist_ok=True)
     DEPLOY_TEXTURE_DIR.mkdir(parents=True, exist_ok=True)
 
-    # Copy CSV
-    src_csv = script_dir / OUTPUT_CSV
-    dst_csv = DEPLOY_CSV_DIR / OUTPUT_CSV
-    if src_csv.exists():
-        shutil.copy2(src_csv, dst_csv)
-        print(f"Copied CSV to: {dst_csv}")
-    else:
-        print(f"WARNING: CSV not found: {src_csv}")
+    # Copy CSV and binary metrics (copy2 keeps mtimes; the binary was written after the CSV,
+    # so the plugin sees it as current) and kerning
+    for name in (OUTPUT_CSV, OUTPUT_BIN, OUTPUT_KERNING):
+        src = script_dir / name
+        dst = DEPLOY_CSV_DIR / name
+        if src.exists():
+            shutil.copy2(src, dst)
+            print(f"Copied metrics to: {dst}")
+        else:
+            print(f"WARNING: Metrics not found: {src}")
 
     # Copy DDS texture
     src_dds = script_dir / OUTPUT_DDS
@@ -280,6 +330,8 @@ def main():
 
     # Save CSV mapping
     save_csv_mapping(mapping_data)
+    save_binary_mapping(mapping_data)
+    save_kerning(characters)
 
     # Convert to DDS
     convert_to_dds(output_path)
@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+"""
+Writes the icon atlas page carriers (textures/3DUI/atlas/pageNN.dds).
+
+IconAtlas shows each runtime atlas page through its own NiSourceTexture, loaded from
+one of these paths and then repointed at the page. Their pixels are never shown, so
+each is a 4x4 transparent BGRA texture; they only have to exist, one per page.
+"""
+import os
+import struct
+
+PAGE_COUNT = 16  # IconAtlas::MAX_PAGES
+OUT_DIR = os.path.join(os.path.dirname(__file__), "..", "textures", "3DUI", "atlas")
+
+
+def carrier_dds():
+    width = height = 4
+    flags = 0x1 | 0x2 | 0x4 | 0x1000 | 0x8  # CAPS | HEIGHT | WIDTH | PIXELFORMAT | PITCH
+    pixel_format = struct.pack("<II4sIIIII", 32, 0x41, b"\0\0\0\0", 32,  # RGB | ALPHAPIXELS
+                               0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000)
+    header = struct.pack("<IIIIIII", 124, flags, height, width, width * 4, 0, 1)
+    header += b"\0" * 44 + pixel_format + struct.pack("<IIIII", 0x1000, 0, 0, 0, 0)  # TEXTURE caps
+    return b"DDS " + header + b"\0" * (width * height * 4)
+
+
+def main():
+    os.makedirs(OUT_DIR, exist_ok=True)
+    data = carrier_dds()
+    for page in range(PAGE_COUNT):
+        with open(os.path.join(OUT_DIR, f"page{page:02}.dds"), "wb") as f:
+            f.write(data)
+
+
+if __name__ == "__main__":
+    main()
@@ -11,12 +11,25 @@ set(sources ${sources}
     src/projectile/ControlledProjectile.cpp
     src/projectile/ControlledLight.cpp
     src/projectile/TransformSmoother.cpp
+    src/projectile/TransformStore.cpp
+    src/projectile/SmoothingKernels.cpp
     src/projectile/ProjectileSubsystem.cpp
     src/projectile/ProjectileHook.cpp
     src/projectile/ProjectileDriver.cpp
+    src/projectile/HoverSpatialIndex.cpp
+    src/projectile/FrameProfiler.cpp
+    src/projectile/FrameScheduler.cpp
+    src/projectile/WorkStealingPool.cpp
     src/projectile/TextAssets.cpp
+    src/projectile/TextLayout.cpp
+    src/projectile/GlyphMetricsTable.cpp
+    src/projectile/FontRegistry.cpp
     src/projectile/TextureManipulator.cpp
     src/projectile/AsyncTextureLoader.cpp
+    src/projectile/TextureRequestQueue.cpp
+    src/projectile/TextureCache.cpp
+    src/projectile/IconAtlasLayout.cpp
+    src/projectile/IconAtlas.cpp
     src/projectile/Drivers/RadialProjectileDriver.cpp
     src/projectile/Drivers/HalfWheelProjectileDriver.cpp
     src/projectile/Drivers/ColumnGridProjectileDriver.cpp
@@ -26,6 +26,33 @@ logLevel=debug
 [Haptics]
 ; Globally disable all haptic feedback (0=enabled, 1=disabled)
 globallyDisableHapticFeedback=0
+
+[Performance]
+; Time budget in microseconds for menu updates per frame (0=unlimited)
+; Menus that don't fit are deferred to the next frame; hovered/grabbed menus always update
+frameBudgetMicroseconds=0
+; Menus farther than this from the player (game units) update every farMenuUpdateInterval frames (0=off)
+farMenuDistance=3000
+farMenuUpdateInterval=2
+; Hidden menus update every N frames
+hiddenMenuUpdateInterval=10
+; Worker threads that compute menu layouts in parallel (-1=auto: some on 8+ core CPUs, 0=off)
+layoutWorkerThreads=-1
+; Pre-launched hidden projectiles kept ready per model in use, so menus appear the frame they open (0=off)
+; Each one holds on to its projectile form while parked; the pool is emptied when forms run out
+warmPoolSize=0
+; Worker threads loading icon textures in the background; visible icons nearest the HMD load first (min 1)
+textureLoaderThreads=2
+; Megabytes of loaded icon textures kept cached; least recently shown icons are evicted first (0=unbounded)
+; Icons on screen are never evicted
+textureCacheBudgetMB=128
+; Pack icons onto shared 2048x2048 atlas pages at runtime, up to this many pages (0=off, max 16)
+; Cuts texture binds for big menus; icons over 512px, with odd sizes or without mipmaps keep their own texture
+iconAtlasMaxPages=0
+
+[Diagnostics]
+; Log p50/p95/p99 frame times per menu every N seconds (0=off)
+profilerReportIntervalSeconds=0
 )";
 
     // ===== Low-level INI readers using Windows API =====
@@ -51,6 +78,30 @@ globallyDisableHapticFeedback=0
         }
     }
 
+    static bool GetConfigOptionInt(const char* section, const char* key, int* out) {
+        std::string data = GetConfigOption(section, key);
+        if (data.empty()) return false;
+        try {
+            *out = std::stoi(data);
+            return true;
+        } catch (...) {
+            spdlog::warn("Config: Failed to parse int for {}/{}", section, key);
+            return false;
+        }
+    }
+
+    static bool GetConfigOptionFloat(const char* section, const char* key, float* out) {
+        std::string data = GetConfigOption(section, key);
+        if (data.empty()) return false;
+        try {
+            *out = std::stof(data);
+            return true;
+        } catch (...) {
+            spdlog::warn("Config: Failed to parse float for {}/{}", section, key);
+            return false;
+        }
+    }
+
     static spdlog::level::level_enum ParseLogLevel(const std::string& levelStr) {
         if (levelStr == "trace") return spdlog::level::trace;
         if (levelStr == "debug") return spdlog::level::debug;
@@ -141,6 +192,44 @@ globallyDisableHapticFeedback=0
                 options.globallyDisableHapticFeedback ? "true" : "false");
         }
 
+        // Performance
+        if (GetConfigOptionInt("Performance", "frameBudgetMicroseconds", &options.frameBudgetMicroseconds)) {
+            spdlog::info("Config: [Performance] frameBudgetMicroseconds = {}", options.frameBudgetMicroseconds);
+        }
+        if (GetConfigOptionFloat("Performance", "farMenuDistance", &options.farMenuDistance)) {
+            spdlog::info("Config: [Performance] farMenuDistance = {}", options.farMenuDistance);
+        }
+        if (GetConfigOptionInt("Performance", "farMenuUpdateInterval", &options.farMenuUpdateInterval)) {
+            spdlog::info("Config: [Performance] farMenuUpdateInterval = {}", options.farMenuUpdateInterval);
+        }
+        if (GetConfigOptionInt("Performance", "hiddenMenuUpdateInterval", &options.hiddenMenuUpdateInterval)) {
+            spdlog::info("Config: [Performance] hiddenMenuUpdateInterval = {}", options.hiddenMenuUpdateInterval);
+        }
+        if (GetConfigOptionInt("Performance", "layoutWorkerThreads", &options.layoutWorkerThreads)) {
+            spdlog::info("Config: [Performance] layoutWorkerThreads = {}", options.layoutWorkerThreads);
+        }
+        if (GetConfigOptionInt("Performance", "warmPoolSize", &options.warmPoolSize)) {
+            spdlog::info("Config: [Performance] warmPoolSize = {}", options.warmPoolSize);
+        }
+        if (GetConfigOptionInt("Performance", "textureLoaderThreads", &options.textureLoaderThreads)) {
+            spdlog::info("Config: [Performance] textureLoaderThreads = {}", options.textureLoaderThreads);
+        }
+        if (GetConfigOptionInt("Performance", "textureCacheBudgetMB", &options.textureCacheBudgetMB)) {
+            spdlog::info("Config: [Performance] textureCacheBudgetMB = {}", options.textureCacheBudgetMB);
+        }
+        if (GetConfigOptionInt("Performance", "iconAtlasMaxPages", &options.iconAtlasMaxPages)) {
+            spdlog::info("Config: [Performance] iconAtlasMaxPages = {}", options.iconAtlasMaxPages);
+        }
+
+        // Diagnostics
+        if (!GetConfigOptionInt("Diagnostics", "profilerReportIntervalSeconds", &options.profilerReportIntervalSeconds)) {
+            spdlog::debug("Config: profilerReportIntervalSeconds not found, using default {}",
+                options.profilerReportIntervalSeconds);
+        } else {
+            spdlog::info("Config: [Diagnostics] profilerReportIntervalSeconds = {}",
+                options.profilerReportIntervalSeconds);
+        }
+
         spdlog::info("Config: Loaded successfully");
         return true;
     }
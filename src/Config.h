@@ -10,6 +10,20 @@ namespace Config {
 
         // ===== Haptics =====
         bool globallyDisableHapticFeedback = false;  // Disable all haptic feedback
+
+        // ===== Performance =====
+        int frameBudgetMicroseconds = 0;    // Time budget for menu updates per frame (0 = unlimited)
+        float farMenuDistance = 3000.0f;    // Menus farther than this from the player update at a reduced rate (0 = off)
+        int farMenuUpdateInterval = 2;      // Far menus update every N frames
+        int hiddenMenuUpdateInterval = 10;  // Hidden menus update every N frames
+        int layoutWorkerThreads = -1;       // Parallel layout workers (-1 = auto, 0 = main thread only)
+        int warmPoolSize = 0;               // Pre-launched hidden projectiles kept per model in use (0 = off)
+        int textureLoaderThreads = 2;       // Worker threads loading icon textures from disk (min 1)
+        int textureCacheBudgetMB = 128;     // Memory kept for loaded icon textures, LRU evicted (0 = unbounded)
+        int iconAtlasMaxPages = 0;          // 2048x2048 pages icons are packed onto at runtime (0 = off)
+
+        // ===== Diagnostics =====
+        int profilerReportIntervalSeconds = 0;  // Log per-menu frame time percentiles every N seconds (0 = off)
     };
 
     extern Options options;
@@ -63,6 +63,9 @@ public:
     // Check if the anchor is still valid (node exists and is in scene graph)
     bool IsValid() const;
 
+    // True when the anchor resolves through a reference handle lookup (not a direct node)
+    bool UsesHandle() const { return !m_directNode && static_cast<bool>(m_refHandle); }
+
     // Resolve anchor to NiAVObject* (returns nullptr if no anchor or invalid)
     RE::NiAVObject* ResolveNode() const;
 
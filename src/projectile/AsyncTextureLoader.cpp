@@ -1,5 +1,7 @@
 #include "AsyncTextureLoader.h"
 #include "../log.h"
+#include <d3d11.h>
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <sstream>
@@ -9,6 +11,23 @@ namespace Projectile {
 // Placeholder texture path - transparent texture for visual consistency while loading
 static constexpr const char* PLACEHOLDER_TEXTURE_PATH = "textures\\VRDressup\\transparent.dds";
 
+// Charged for textures whose renderer data can't be read (a 256x256 RGBA icon)
+static constexpr size_t FALLBACK_TEXTURE_BYTES = 256 * 256 * 4;
+
+// Estimated GPU memory of a loaded texture, from its D3D11 description
+static size_t GetTextureBytes(RE::NiTexture* texture) {
+    auto* source = netimmerse_cast<RE::NiSourceTexture*>(texture);
+    auto* rendererTexture = source ? source->rendererTexture : nullptr;
+    if (!rendererTexture || !rendererTexture->texture) {
+        return FALLBACK_TEXTURE_BYTES;
+    }
+
+    D3D11_TEXTURE2D_DESC desc{};
+    reinterpret_cast<ID3D11Texture2D*>(rendererTexture->texture)->GetDesc(&desc);
+    return EstimateTextureBytes(desc.Width, desc.Height, desc.MipLevels, desc.ArraySize,
+        static_cast<uint32_t>(desc.Format));
+}
+
 AsyncTextureLoader::AsyncTextureLoader() = default;
 
 AsyncTextureLoader::~AsyncTextureLoader() {
@@ -24,7 +43,7 @@ AsyncTextureLoader& AsyncTextureLoader::GetInstance() {
 // Lifecycle
 // =============================================================================
 
-void AsyncTextureLoader::Start() {
+void AsyncTextureLoader::Start(size_t workerCount) {
     if (m_running.load()) {
         spdlog::warn("AsyncTextureLoader::Start - Already running");
         return;
@@ -33,9 +52,12 @@ void AsyncTextureLoader::Start() {
     m_shutdown.store(false);
     m_running.store(true);
 
-    m_workerThread = std::thread(&AsyncTextureLoader::WorkerThreadFunc, this);
+    workerCount = (std::max)(workerCount, size_t{1});
+    for (size_t i = 0; i < workerCount; ++i) {
+        m_workerThreads.emplace_back(&AsyncTextureLoader::WorkerThreadFunc, this);
+    }
 
-    spdlog::info("AsyncTextureLoader: Started worker thread");
+    spdlog::info("AsyncTextureLoader: Started {} worker thread(s)", workerCount);
     spdlog::trace("AsyncTextureLoader: State after start running={} pending={} completed={} cache={}",
         m_running.load(), GetPendingCount(), GetCompletedCount(), GetCacheSize());
 }
@@ -51,19 +73,22 @@ void AsyncTextureLoader::Shutdown() {
     m_shutdown.store(true);
     m_running.store(false);
 
-    // Wake up worker thread so it can exit
+    // Wake up worker threads so they can exit
     m_workAvailable.notify_all();
 
-    // Wait for worker to finish
-    if (m_workerThread.joinable()) {
-        m_workerThread.join();
+    // Wait for workers to finish
+    for (auto& worker : m_workerThreads) {
+        if (worker.joinable()) {
+            worker.join();
+        }
     }
+    m_workerThreads.clear();
 
     // Clear queues
     {
         std::lock_guard<std::mutex> lock(m_loadQueueMutex);
-        while (!m_loadQueue.empty()) m_loadQueue.pop();
-        m_pendingSet.clear();
+        m_loadQueue = TextureRequestQueue();
+        m_loadingSet.clear();
     }
     {
         std::lock_guard<std::mutex> lock(m_completedQueueMutex);
@@ -90,29 +115,35 @@ void AsyncTextureLoader::WorkerThreadFunc() {
     }
 
     while (!m_shutdown.load()) {
-        std::string texturePath;
+        InternedString texturePath;
 
         // Wait for work or shutdown signal
         {
             std::unique_lock<std::mutex> lock(m_loadQueueMutex);
             m_workAvailable.wait(lock, [this] {
-                return m_shutdown.load() || !m_loadQueue.empty();
+                return m_shutdown.load() || !m_loadQueue.Empty();
             });
 
             if (m_shutdown.load()) {
                 break;
             }
 
-            if (m_loadQueue.empty()) {
+            TextureRequestQueue::Key key;
+            TextureRequestQueue::Clock::duration waited;
+            if (!m_loadQueue.Pop(key, waited)) {
                 continue;
             }
+            texturePath = InternedString::FromId(key);
+            // Note: Keep in m_loadingSet until load completes
+            m_loadingSet.insert(texturePath);
 
-            texturePath = m_loadQueue.front();
-            m_loadQueue.pop();
-            // Note: Keep in m_pendingSet until load completes
+            double waitedMs = std::chrono::duration<double, std::milli>(waited).count();
+            m_totalQueueWaitMs += waitedMs;
+            m_stats.maxQueueWaitMs = (std::max)(m_stats.maxQueueWaitMs, waitedMs);
+            ++m_loadsStarted;
 
-            spdlog::trace("AsyncTextureLoader: [Worker] Dequeued '{}' (queue={} pending={})",
-                texturePath, m_loadQueue.size(), m_pendingSet.size());
+            spdlog::trace("AsyncTextureLoader: [Worker] Dequeued '{}' after {:.1f}ms (queue={} loading={})",
+                texturePath.view(), waitedMs, m_loadQueue.Size(), m_loadingSet.size());
         }
 
         // Load texture (this is the slow part - disk I/O)
@@ -120,46 +151,51 @@ void AsyncTextureLoader::WorkerThreadFunc() {
         result.path = texturePath;
         result.success = false;
 
-        spdlog::debug("AsyncTextureLoader: [Worker] Loading texture '{}'...", texturePath);
+        spdlog::debug("AsyncTextureLoader: [Worker] Loading texture '{}'...", texturePath.view());
+        auto loadStart = std::chrono::steady_clock::now();
 
         try {
-            std::uint32_t width = 0;
-            std::uint32_t height = 0;
-       
-
                 RE::NiPointer<RE::NiTexture> texture;
                 RE::BSShaderManager::GetTexture(texturePath.c_str(), true, texture, false);
 
                 if (texture) {
                     result.texture = texture;
+                    result.bytes = GetTextureBytes(texture.get());
                     result.success = true;
-                    spdlog::debug("AsyncTextureLoader: [Worker] SUCCESS loading '{}' (tex={})",
-                        texturePath, static_cast<const void*>(texture.get()));
+                    spdlog::debug("AsyncTextureLoader: [Worker] SUCCESS loading '{}' (tex={}, {} bytes)",
+                        texturePath.view(), static_cast<const void*>(texture.get()), result.bytes);
                 } else {
                     spdlog::warn("AsyncTextureLoader: [Worker] FAILED to load '{}' (GetTexture returned null)",
-                        texturePath);
+                        texturePath.view());
                 }
           
         } catch (const std::exception& e) {
             spdlog::error("AsyncTextureLoader: [Worker] EXCEPTION loading '{}': {}",
-                texturePath, e.what());
+                texturePath.view(), e.what());
         } catch (...) {
             spdlog::error("AsyncTextureLoader: [Worker] UNKNOWN EXCEPTION loading '{}'",
-                texturePath);
+                texturePath.view());
         }
 
+        double loadMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - loadStart).count();
+        bool success = result.success;
+
         // Queue result for main thread
         {
             std::lock_guard<std::mutex> lock(m_completedQueueMutex);
             m_completedQueue.push(std::move(result));
         }
 
-        // Remove from pending set
+        // Remove from loading set
         {
             std::lock_guard<std::mutex> lock(m_loadQueueMutex);
-            m_pendingSet.erase(texturePath);
-            spdlog::trace("AsyncTextureLoader: [Worker] Completed '{}' (pending now={})",
-                texturePath, m_pendingSet.size());
+            m_loadingSet.erase(texturePath);
+            ++(success ? m_stats.loaded : m_stats.failed);
+            m_totalLoadMs += loadMs;
+            m_stats.maxLoadMs = (std::max)(m_stats.maxLoadMs, loadMs);
+            spdlog::trace("AsyncTextureLoader: [Worker] Completed '{}' in {:.1f}ms (loading now={})",
+                texturePath.view(), loadMs, m_loadingSet.size());
         }
     }
 
@@ -176,27 +212,30 @@ void AsyncTextureLoader::WorkerThreadFunc() {
 // =============================================================================
 
 RE::NiPointer<RE::NiTexture> AsyncTextureLoader::RequestTexture(
-    const std::string& texturePath,
-    TextureReadyCallback onReady)
+    InternedString texturePath,
+    TextureReadyCallback onReady,
+    float priority,
+    TextureRequestToken* token)
 {
     spdlog::trace("AsyncTextureLoader::RequestTexture - '{}' (callback={})",
-        texturePath, onReady ? "yes" : "no");
+        texturePath.view(), onReady ? "yes" : "no");
 
     // 1. Check cache first (fast path)
+    RE::NiPointer<RE::NiTexture> cached;
     {
         std::lock_guard<std::mutex> lock(m_cacheMutex);
-        auto cacheIt = m_cache.find(texturePath);
-        if (cacheIt != m_cache.end()) {
-            spdlog::trace("AsyncTextureLoader::RequestTexture - Cache HIT '{}' (tex={})",
-                texturePath, static_cast<const void*>(cacheIt->second.get()));
-            // Already loaded - return immediately
-            if (onReady) {
-                spdlog::trace("AsyncTextureLoader::RequestTexture - Firing callback inline for cached '{}'",
-                    texturePath);
-                onReady(cacheIt->second);
-            }
-            return cacheIt->second;
+        cached = m_cache.Find(texturePath);
+    }
+    if (cached) {
+        spdlog::trace("AsyncTextureLoader::RequestTexture - Cache HIT '{}' (tex={})",
+            texturePath.view(), static_cast<const void*>(cached.get()));
+        // Already loaded - return immediately
+        if (onReady) {
+            spdlog::trace("AsyncTextureLoader::RequestTexture - Firing callback inline for cached '{}'",
+                texturePath.view());
+            onReady(cached);
         }
+        return cached;
     }
 
     // 2. Check if already queued/loading
@@ -205,56 +244,97 @@ RE::NiPointer<RE::NiTexture> AsyncTextureLoader::RequestTexture(
     // The worker thread also calls BSShaderManager::GetTexture() then acquires m_loadQueueMutex,
     // so holding m_loadQueueMutex while calling game functions creates a deadlock risk.
     bool alreadyPending = false;
+    uint64_t requestId = 0;
     {
         std::lock_guard<std::mutex> lock(m_loadQueueMutex);
-        if (m_pendingSet.find(texturePath) != m_pendingSet.end()) {
-            spdlog::trace("AsyncTextureLoader::RequestTexture - Already pending '{}'", texturePath);
+        requestId = m_nextRequestId++;
+        ++m_stats.requested;
+
+        if (m_loadingSet.contains(texturePath)) {
+            // A worker is loading it - just wait for the result
+            spdlog::trace("AsyncTextureLoader::RequestTexture - Already loading '{}'", texturePath.view());
             alreadyPending = true;
-            // Already pending - just add callback
-            if (onReady) {
-                std::lock_guard<std::mutex> cbLock(m_callbacksMutex);
-                m_callbacks[texturePath].push_back(onReady);
-                spdlog::trace("AsyncTextureLoader::RequestTexture - Added callback (pending callbacks={} for '{}')",
-                    m_callbacks[texturePath].size(), texturePath);
-            }
         } else {
-            // 3. Queue for loading
-            m_loadQueue.push(texturePath);
-            m_pendingSet.insert(texturePath);
-            spdlog::trace("AsyncTextureLoader::RequestTexture - Queued '{}' (queue={} pending={})",
-                texturePath, m_loadQueue.size(), m_pendingSet.size());
+            // 3. Queue for loading (or join the queued load, raising its priority)
+            alreadyPending = m_loadQueue.Contains(texturePath.GetId());
+            m_loadQueue.Push(texturePath.GetId(), requestId, priority);
+            spdlog::trace("AsyncTextureLoader::RequestTexture - {} '{}' priority={} (queue={} loading={})",
+                alreadyPending ? "Joined" : "Queued", texturePath.view(), priority,
+                m_loadQueue.Size(), m_loadingSet.size());
+        }
+
+        // Add callback if provided
+        if (onReady) {
+            std::lock_guard<std::mutex> cbLock(m_callbacksMutex);
+            auto& callbacks = m_callbacks[texturePath];
+            callbacks.push_back({requestId, std::move(onReady)});
+            spdlog::trace("AsyncTextureLoader::RequestTexture - Added callback (callbacks={} for '{}')",
+                callbacks.size(), texturePath.view());
         }
     }
 
-    // Return placeholder for already-pending textures (outside lock to avoid deadlock)
-    if (alreadyPending) {
-        return GetPlaceholder();
+    if (token) {
+        token->path = texturePath;
+        token->id = requestId;
     }
 
-    // Add callback if provided
-    if (onReady) {
-        std::lock_guard<std::mutex> cbLock(m_callbacksMutex);
-        m_callbacks[texturePath].push_back(onReady);
-        spdlog::trace("AsyncTextureLoader::RequestTexture - Added callback (callbacks={} for '{}')",
-            m_callbacks[texturePath].size(), texturePath);
+    if (!alreadyPending) {
+        // Wake up a worker thread
+        m_workAvailable.notify_one();
+        spdlog::debug("AsyncTextureLoader: Queued '{}' for async loading", texturePath.view());
     }
 
-    // Wake up worker thread
-    m_workAvailable.notify_one();
+    // Placeholder is fetched outside the lock to avoid deadlock
+    return GetPlaceholder();
+}
 
-    spdlog::debug("AsyncTextureLoader: Queued '{}' for async loading", texturePath);
+void AsyncTextureLoader::Cancel(TextureRequestToken& token) {
+    if (!token.IsValid()) {
+        return;
+    }
 
-    return GetPlaceholder();
+    bool dropped = false;
+    bool removedCallback = false;
+    {
+        std::lock_guard<std::mutex> lock(m_loadQueueMutex);
+        dropped = m_loadQueue.Cancel(token.id);
+
+        std::lock_guard<std::mutex> cbLock(m_callbacksMutex);
+        auto it = m_callbacks.find(token.path);
+        if (it != m_callbacks.end()) {
+            auto& callbacks = it->second;
+            auto removed = std::remove_if(callbacks.begin(), callbacks.end(),
+                [&](const PendingCallback& pending) { return pending.requestId == token.id; });
+            removedCallback = removed != callbacks.end();
+            callbacks.erase(removed, callbacks.end());
+            if (callbacks.empty()) {
+                m_callbacks.erase(it);
+            }
+        }
+
+        // Spent tokens (callback already fired) don't count
+        if (dropped || removedCallback) {
+            ++m_stats.cancelled;
+        }
+        if (dropped) {
+            ++m_stats.dropped;
+        }
+    }
+
+    if (dropped) {
+        spdlog::trace("AsyncTextureLoader::Cancel - Dropped queued load '{}'", token.path.view());
+    }
+    token = TextureRequestToken();
 }
 
-bool AsyncTextureLoader::IsTextureReady(const std::string& texturePath) const {
+bool AsyncTextureLoader::IsTextureReady(InternedString texturePath) const {
     std::lock_guard<std::mutex> lock(m_cacheMutex);
-    return m_cache.find(texturePath) != m_cache.end();
+    return m_cache.Contains(texturePath);
 }
 
-bool AsyncTextureLoader::IsTextureLoading(const std::string& texturePath) const {
+bool AsyncTextureLoader::IsTextureLoading(InternedString texturePath) const {
     std::lock_guard<std::mutex> lock(m_loadQueueMutex);
-    return m_pendingSet.find(texturePath) != m_pendingSet.end();
+    return m_loadQueue.Contains(texturePath.GetId()) || m_loadingSet.contains(texturePath);
 }
 
 // =============================================================================
@@ -279,15 +359,15 @@ size_t AsyncTextureLoader::ProcessCompletedLoads() {
         }
 
         spdlog::trace("AsyncTextureLoader: [Main] Processing '{}' (success={}, tex={})",
-            result.path, result.success,
+            result.path.view(), result.success,
             static_cast<const void*>(result.texture.get()));
 
         // Add to cache
         if (result.success && result.texture) {
             std::lock_guard<std::mutex> lock(m_cacheMutex);
-            m_cache[result.path] = result.texture;
-            spdlog::debug("AsyncTextureLoader: [Main] Cached '{}' ({} total cached)",
-                result.path, m_cache.size());
+            m_cache.Insert(result.path, result.texture, result.bytes);
+            spdlog::debug("AsyncTextureLoader: [Main] Cached '{}' ({} total cached, {} bytes)",
+                result.path.view(), m_cache.Size(), m_cache.GetBytes());
         }
 
         // Fire callbacks (always, even on failure - callback receives nullptr)
@@ -305,7 +385,7 @@ size_t AsyncTextureLoader::ProcessCompletedLoads() {
 
 size_t AsyncTextureLoader::GetPendingCount() const {
     std::lock_guard<std::mutex> lock(m_loadQueueMutex);
-    return m_pendingSet.size();
+    return m_loadQueue.Size() + m_loadingSet.size();
 }
 
 size_t AsyncTextureLoader::GetCompletedCount() const {
@@ -313,14 +393,28 @@ size_t AsyncTextureLoader::GetCompletedCount() const {
     return m_completedQueue.size();
 }
 
+AsyncTextureLoader::Stats AsyncTextureLoader::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_loadQueueMutex);
+    Stats stats = m_stats;
+    stats.queued = m_loadQueue.Size();
+    if (m_loadsStarted > 0) {
+        stats.meanQueueWaitMs = m_totalQueueWaitMs / static_cast<double>(m_loadsStarted);
+    }
+    uint64_t finished = m_stats.loaded + m_stats.failed;
+    if (finished > 0) {
+        stats.meanLoadMs = m_totalLoadMs / static_cast<double>(finished);
+    }
+    return stats;
+}
+
 // =============================================================================
 // Preloading
 // =============================================================================
 
-void AsyncTextureLoader::PreloadTextures(const std::vector<std::string>& texturePaths) {
+void AsyncTextureLoader::PreloadTextures(const std::vector<InternedString>& texturePaths) {
     for (const auto& path : texturePaths) {
-        // RequestTexture without callback just queues the load
-        RequestTexture(path, nullptr);
+        // RequestTexture without callback just queues the load, behind anything on screen
+        RequestTexture(path, nullptr, TextureRequestQueue::MakePriority(false, 0.0f));
     }
     spdlog::info("AsyncTextureLoader: Queued {} textures for preload", texturePaths.size());
 }
@@ -331,23 +425,40 @@ void AsyncTextureLoader::PreloadTextures(const std::vector<std::string>& texture
 
 void AsyncTextureLoader::ClearCache() {
     std::lock_guard<std::mutex> lock(m_cacheMutex);
-    size_t count = m_cache.size();
-    m_cache.clear();
-    spdlog::info("AsyncTextureLoader: Cleared cache ({} textures)", count);
+    size_t count = m_cache.Size();
+    m_cache.Clear();
+    spdlog::info("AsyncTextureLoader: Cleared cache ({} textures, {} pinned kept)", count, m_cache.Size());
+}
+
+void AsyncTextureLoader::SetCacheBudget(size_t budgetBytes) {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    m_cache.SetBudget(budgetBytes);
+    spdlog::info("AsyncTextureLoader: Cache budget {} bytes", budgetBytes);
+}
+
+void AsyncTextureLoader::PinTexture(InternedString texturePath) {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    m_cache.Pin(texturePath);
+}
+
+void AsyncTextureLoader::UnpinTexture(InternedString texturePath) {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    m_cache.Unpin(texturePath);
 }
 
 size_t AsyncTextureLoader::GetCacheSize() const {
     std::lock_guard<std::mutex> lock(m_cacheMutex);
-    return m_cache.size();
+    return m_cache.Size();
 }
 
-RE::NiPointer<RE::NiTexture> AsyncTextureLoader::GetCachedTexture(const std::string& texturePath) const {
+AsyncTextureLoader::CacheStats AsyncTextureLoader::GetCacheStats() const {
     std::lock_guard<std::mutex> lock(m_cacheMutex);
-    auto it = m_cache.find(texturePath);
-    if (it != m_cache.end()) {
-        return it->second;
-    }
-    return nullptr;
+    return m_cache.GetStats();
+}
+
+RE::NiPointer<RE::NiTexture> AsyncTextureLoader::GetCachedTexture(InternedString texturePath) {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    return m_cache.Find(texturePath, false);
 }
 
 // =============================================================================
@@ -387,8 +498,8 @@ RE::NiPointer<RE::NiTexture> AsyncTextureLoader::GetPlaceholder() {
     return m_placeholder;
 }
 
-void AsyncTextureLoader::FireCallbacks(const std::string& texturePath, RE::NiPointer<RE::NiTexture> texture) {
-    std::vector<TextureReadyCallback> callbacks;
+void AsyncTextureLoader::FireCallbacks(InternedString texturePath, RE::NiPointer<RE::NiTexture> texture) {
+    std::vector<PendingCallback> callbacks;
 
     // Extract callbacks (thread-safe)
     {
@@ -402,27 +513,27 @@ void AsyncTextureLoader::FireCallbacks(const std::string& texturePath, RE::NiPoi
 
     if (!callbacks.empty()) {
         spdlog::trace("AsyncTextureLoader: Firing {} callbacks for '{}' (tex={})",
-            callbacks.size(), texturePath, static_cast<const void*>(texture.get()));
+            callbacks.size(), texturePath.view(), static_cast<const void*>(texture.get()));
     }
 
     // Fire callbacks (outside lock)
-    for (auto& callback : callbacks) {
-        if (callback) {
+    for (auto& pending : callbacks) {
+        if (pending.callback) {
             try {
-                callback(texture);
+                pending.callback(texture);
             } catch (const std::exception& e) {
                 spdlog::error("AsyncTextureLoader: Callback exception for '{}': {}",
-                    texturePath, e.what());
+                    texturePath.view(), e.what());
             } catch (...) {
                 spdlog::error("AsyncTextureLoader: Unknown callback exception for '{}'",
-                    texturePath);
+                    texturePath.view());
             }
         }
     }
 
     if (!callbacks.empty()) {
         spdlog::trace("AsyncTextureLoader: Fired {} callbacks for '{}'",
-            callbacks.size(), texturePath);
+            callbacks.size(), texturePath.view());
     }
 }
 
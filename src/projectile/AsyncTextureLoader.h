@@ -1,6 +1,10 @@
 #pragma once
 
 #include "RE/Skyrim.h"
+#include "../util/StringTable.h"
+#include "TextureCache.h"
+#include "TextureRequestQueue.h"
+#include <chrono>
 #include <queue>
 #include <unordered_map>
 #include <unordered_set>
@@ -20,11 +24,15 @@ using TextureReadyCallback = std::function<void(RE::NiPointer<RE::NiTexture>)>;
 
 // =============================================================================
 // AsyncTextureLoader
-// Provides non-blocking texture loading using a dedicated worker thread.
+// Provides non-blocking texture loading using a small pool of worker threads.
 //
 // Design:
 // - RequestTexture() returns immediately with placeholder or cached texture
-// - Worker thread calls BSShaderManager::GetTexture() asynchronously
+// - Loads wait in a TextureRequestQueue: most urgent priority first (visible icons nearest
+//   the HMD), and dropped once every request for them has been cancelled
+// - Loaded textures live in a byte-budgeted LRU TextureCache; textures pinned by live
+//   projectiles are never evicted
+// - Worker threads call BSShaderManager::GetTexture() asynchronously
 // - ProcessCompletedLoads() (main thread) swaps in loaded textures and fires callbacks
 //
 // Thread Safety:
@@ -41,10 +49,10 @@ public:
     // Lifecycle
     // =========================================================================
 
-    // Start the worker thread (call once during plugin init)
-    void Start();
+    // Start the worker threads (call once during plugin init)
+    void Start(size_t workerCount = 2);
 
-    // Stop the worker thread and cleanup (call during shutdown)
+    // Stop the worker threads and cleanup (call during shutdown)
     void Shutdown();
 
     // Check if the loader is running
@@ -59,15 +67,24 @@ public:
     //   - Cached texture if available (instant)
     //   - Placeholder texture if load is pending/queued
     // Optional callback fires on main thread when real texture is ready
+    // Paths are interned - all queues, caches and callbacks are keyed by string ID
+    // priority: lower loads first (see TextureRequestQueue::MakePriority)
+    // token: if given and the load is pending, receives a handle for Cancel()
     RE::NiPointer<RE::NiTexture> RequestTexture(
-        const std::string& texturePath,
-        TextureReadyCallback onReady = nullptr);
+        InternedString texturePath,
+        TextureReadyCallback onReady = nullptr,
+        float priority = 0.0f,
+        TextureRequestToken* token = nullptr);
+
+    // Cancel a pending request: its callback won't fire, and the load is dropped if
+    // nothing else still wants it. Resets the token. Safe to call on spent tokens.
+    void Cancel(TextureRequestToken& token);
 
     // Check if a texture is fully loaded (in cache)
-    bool IsTextureReady(const std::string& texturePath) const;
+    bool IsTextureReady(InternedString texturePath) const;
 
     // Check if a texture is currently loading or queued
-    bool IsTextureLoading(const std::string& texturePath) const;
+    bool IsTextureLoading(InternedString texturePath) const;
 
     // =========================================================================
     // Frame Processing (call from main Update loop)
@@ -84,25 +101,50 @@ public:
     // Get number of completed loads waiting to be processed
     size_t GetCompletedCount() const;
 
+    // Lifetime totals, for the profiler report
+    struct Stats {
+        uint64_t requested = 0;   // Requests that missed the cache
+        uint64_t loaded = 0;
+        uint64_t failed = 0;
+        uint64_t cancelled = 0;   // Requests cancelled through their token
+        uint64_t dropped = 0;     // Queued loads dropped because all their requests were cancelled
+        size_t queued = 0;        // Loads waiting for a worker right now
+        double meanQueueWaitMs = 0.0;
+        double maxQueueWaitMs = 0.0;
+        double meanLoadMs = 0.0;
+        double maxLoadMs = 0.0;
+    };
+    Stats GetStats() const;
+
     // =========================================================================
     // Preloading (for known textures - non-blocking)
     // =========================================================================
 
     // Queue multiple textures for preloading
-    void PreloadTextures(const std::vector<std::string>& texturePaths);
+    void PreloadTextures(const std::vector<InternedString>& texturePaths);
 
     // =========================================================================
     // Cache Management
     // =========================================================================
 
-    // Clear all cached textures (frees memory, does NOT stop pending loads)
+    // Clear all unpinned cached textures (frees memory, does NOT stop pending loads)
     void ClearCache();
 
+    // Cache memory budget in bytes (0 = unbounded); least recently used textures go first
+    void SetCacheBudget(size_t budgetBytes);
+
+    // Keep a texture cached while something displays it (pins nest, may precede the load)
+    void PinTexture(InternedString texturePath);
+    void UnpinTexture(InternedString texturePath);
+
     // Get cache statistics
     size_t GetCacheSize() const;
+    using CacheStats = TextureCache<RE::NiPointer<RE::NiTexture>>::Stats;
+    CacheStats GetCacheStats() const;
 
     // Direct cache access (for texture that's already loaded)
-    RE::NiPointer<RE::NiTexture> GetCachedTexture(const std::string& texturePath) const;
+    // A miss here isn't counted - RequestTexture() counts it when it queues the load
+    RE::NiPointer<RE::NiTexture> GetCachedTexture(InternedString texturePath);
 
 private:
     AsyncTextureLoader();
@@ -112,11 +154,18 @@ private:
 
     // Result of an async texture load
     struct LoadResult {
-        std::string path;
+        InternedString path;
         RE::NiPointer<RE::NiTexture> texture;  // nullptr on failure
+        size_t bytes = 0;                      // Estimated GPU memory
         bool success;
     };
 
+    // A callback waiting for its texture, tagged with its request ID for Cancel()
+    struct PendingCallback {
+        uint64_t requestId;
+        TextureReadyCallback callback;
+    };
+
     // Worker thread function
     void WorkerThreadFunc();
 
@@ -124,28 +173,35 @@ private:
     RE::NiPointer<RE::NiTexture> GetPlaceholder();
 
     // Internal: Fire callbacks for a loaded texture (must be on main thread)
-    void FireCallbacks(const std::string& texturePath, RE::NiPointer<RE::NiTexture> texture);
+    void FireCallbacks(InternedString texturePath, RE::NiPointer<RE::NiTexture> texture);
 
     // =========================================================================
     // State
     // =========================================================================
 
     // Loaded texture cache (accessed from main thread after load completes)
-    std::unordered_map<std::string, RE::NiPointer<RE::NiTexture>> m_cache;
+    TextureCache<RE::NiPointer<RE::NiTexture>> m_cache;
     mutable std::mutex m_cacheMutex;
 
-    // Request queue: main thread -> worker thread
-    std::queue<std::string> m_loadQueue;
-    std::unordered_set<std::string> m_pendingSet;  // Fast lookup for queued/loading
+    // Request queue: main thread -> worker threads
+    TextureRequestQueue m_loadQueue;
+    std::unordered_set<InternedString, InternedString::Hash> m_loadingSet;  // Popped by a worker, not yet completed
+    uint64_t m_nextRequestId = 1;
     mutable std::mutex m_loadQueueMutex;
     std::condition_variable m_workAvailable;
 
+    // Statistics (guarded by m_loadQueueMutex)
+    Stats m_stats;
+    uint64_t m_loadsStarted = 0;
+    double m_totalQueueWaitMs = 0.0;
+    double m_totalLoadMs = 0.0;
+
     // Completed queue: worker thread -> main thread
     std::queue<LoadResult> m_completedQueue;
     mutable std::mutex m_completedQueueMutex;
 
     // Callbacks waiting for texture load completion
-    std::unordered_map<std::string, std::vector<TextureReadyCallback>> m_callbacks;
+    std::unordered_map<InternedString, std::vector<PendingCallback>, InternedString::Hash> m_callbacks;
     std::mutex m_callbacksMutex;
 
     // Placeholder texture (lazy-initialized, thread-safe)
@@ -153,8 +209,8 @@ private:
     std::mutex m_placeholderMutex;
     std::atomic<bool> m_placeholderInitialized{false};
 
-    // Worker thread
-    std::thread m_workerThread;
+    // Worker threads
+    std::vector<std::thread> m_workerThreads;
     std::atomic<bool> m_running{false};
     std::atomic<bool> m_shutdown{false};
 };
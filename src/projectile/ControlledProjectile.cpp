@@ -9,10 +9,24 @@
 
 namespace Projectile {
 
+namespace {
+    // Shared mesh for texture-based items (the texture goes on its "Picture" node)
+    InternedString GetTextureModelPath() {
+        static const InternedString s_path("meshes\\3DUI\\icon_template.nif");
+        return s_path;
+    }
+}
+
+ControlledProjectile::ControlledProjectile()
+    : m_transformHandle(TransformStore::GetSingleton().Allocate())
+{
+}
+
 ControlledProjectile::~ControlledProjectile() {
     if (m_valid) {
         Destroy();
     }
+    TransformStore::GetSingleton().Release(m_transformHandle);
 }
 
 ControlledProjectile::ControlledProjectile(ControlledProjectile&& other) noexcept
@@ -39,7 +53,7 @@ ControlledProjectile::ControlledProjectile(ControlledProjectile&& other) noexcep
     , m_formIndex(other.m_formIndex)
     , m_valid(other.m_valid)
     , m_billboardMode(other.m_billboardMode)
-    , m_smoother(std::move(other.m_smoother))
+    , m_transformHandle(other.m_transformHandle)
     , m_gameProjectile(std::move(other.m_gameProjectile))
     // Use exchange() for atomics to atomically transfer ownership and invalidate source
     , m_bindState(other.m_bindState.exchange(BindState::Unbound))
@@ -57,7 +71,7 @@ ControlledProjectile::ControlledProjectile(ControlledProjectile&& other) noexcep
     other.m_uuid = UUID::Invalid();
     other.m_formIndex = -1;
     other.m_valid = false;
-    other.m_smoother.Reset();
+    other.m_transformHandle = TransformStore::GetSingleton().Allocate();
     // Note: atomics already invalidated via exchange() above
     other.m_hoverScale = 1.0f;
     other.m_lastHeading = 0.0f;
@@ -65,6 +79,10 @@ ControlledProjectile::ControlledProjectile(ControlledProjectile&& other) noexcep
     other.m_labelTextScale = 1.0f;
     other.m_labelTextVisible = true;
     other.m_labelOffset = {0, 0, -10.0f};
+
+    // GameProjectile moved - point our slot's output at the new address
+    TransformStore::GetSingleton().SetOutput(m_transformHandle,
+        m_gameProjectile.IsBound() ? &m_gameProjectile : nullptr);
 }
 
 ControlledProjectile& ControlledProjectile::operator=(ControlledProjectile&& other) noexcept {
@@ -96,7 +114,7 @@ ControlledProjectile& ControlledProjectile::operator=(ControlledProjectile&& oth
         m_formIndex = other.m_formIndex;
         m_valid = other.m_valid;
         m_billboardMode = other.m_billboardMode;
-        m_smoother = std::move(other.m_smoother);
+        std::swap(m_transformHandle, other.m_transformHandle);
         m_gameProjectile = std::move(other.m_gameProjectile);
         // Use exchange() for atomics to atomically transfer ownership and invalidate source
         m_bindState.store(other.m_bindState.exchange(BindState::Unbound));
@@ -114,7 +132,7 @@ ControlledProjectile& ControlledProjectile::operator=(ControlledProjectile&& oth
         other.m_uuid = UUID::Invalid();
         other.m_formIndex = -1;
         other.m_valid = false;
-        other.m_smoother.Reset();
+        TransformStore::GetSingleton().Reset(other.m_transformHandle);
         // Note: atomics already invalidated via exchange() above
         other.m_hoverScale = 1.0f;
         other.m_lastHeading = 0.0f;
@@ -122,6 +140,10 @@ ControlledProjectile& ControlledProjectile::operator=(ControlledProjectile&& oth
         other.m_labelTextScale = 1.0f;
         other.m_labelTextVisible = true;
         other.m_labelOffset = {0, 0, -10.0f};
+
+        // GameProjectile moved - point our slot's output at the new address
+        TransformStore::GetSingleton().SetOutput(m_transformHandle,
+            m_gameProjectile.IsBound() ? &m_gameProjectile : nullptr);
     }
     return *this;
 }
@@ -131,10 +153,10 @@ bool ControlledProjectile::IsValid() const {
 }
 
 RE::NiPoint3 ControlledProjectile::GetPosition() const {
-    return m_smoother.GetCurrent().position;
+    return TransformStore::GetSingleton().GetCurrent(m_transformHandle).position;
 }
 
-RE::NiPoint3 ControlledProjectile::GetWorldPosition() const {
+RE::NiPoint3 ControlledProjectile::ComputeWorldPosition() const {
     // Scene graph: WorldPos = Parent.WorldPos + Parent.WorldRot x LocalPos
     // This ensures parent rotation affects our position in world space
     RE::NiPoint3 localPos = GetLocalPosition();
@@ -146,7 +168,7 @@ RE::NiPoint3 ControlledProjectile::GetWorldPosition() const {
     return localPos;
 }
 
-float ControlledProjectile::GetWorldScale() const {
+float ControlledProjectile::ComputeWorldScale() const {
     // Multiply local scale by parent's world scale if we have a parent
     // Then apply baseScale (user-defined), scaleCorrection (from bounds), and hover scale as final multipliers
     // Final scale = parentWorldScale * localScale * baseScale * scaleCorrection * hoverScale
@@ -154,9 +176,9 @@ float ControlledProjectile::GetWorldScale() const {
     return parentScale * m_baseScale * m_scaleCorrection * m_hoverScale;
 }
 
-RE::NiMatrix3 ControlledProjectile::GetWorldRotation() const {
+RE::NiMatrix3 ControlledProjectile::ComputeWorldRotation() const {
     // Get base world rotation from parent chain
-    RE::NiMatrix3 worldRot = IPositionable::GetWorldRotation();
+    RE::NiMatrix3 worldRot = IPositionable::ComputeWorldRotation();
 
     // Apply rotation correction if any component is non-zero
     // Correction is applied in model space (rightmost in multiplication chain)
@@ -183,7 +205,7 @@ void ControlledProjectile::SetRotation(const RE::NiPoint3& rot) {
     RE::NiMatrix3 rotMatrix = EulerToMatrix(rot);
 
     // Use target to preserve lerp destination
-    ProjectileTransform transform = m_smoother.GetTarget();
+    ProjectileTransform transform = TransformStore::GetSingleton().GetTarget(m_transformHandle);
     transform.rotation = rotMatrix;
     SetTransform(transform);
 }
@@ -194,16 +216,39 @@ void ControlledProjectile::SetRotation(float pitch, float roll, float yaw) {
 
 RE::NiPoint3 ControlledProjectile::GetRotation() const {
     // Convert rotation matrix back to Euler angles for API compatibility
-    return MatrixToEuler(m_smoother.GetCurrent().rotation);
+    return MatrixToEuler(TransformStore::GetSingleton().GetCurrent(m_transformHandle).rotation);
+}
+
+void ControlledProjectile::InvalidateWorldTransform() {
+    if (m_worldDirty) {
+        return;  // Background and label are already dirty
+    }
+    IPositionable::InvalidateWorldTransform();
+    if (m_background) {
+        m_background->InvalidateWorldTransform();
+    }
+    if (m_labelTextDriver) {
+        m_labelTextDriver->InvalidateWorldTransform();
+    }
 }
 
 void ControlledProjectile::SetLocalScale(float scale) {
+    if (scale == m_localScale) {
+        return;  // Unchanged - don't wake from rest
+    }
     m_localScale = scale;
+    InvalidateWorldTransform();
+    WakeUp();
     // Actual application happens in Update() via GetWorldScale()
 }
 
 void ControlledProjectile::SetHoverScale(float scale) {
+    if (scale == m_hoverScale) {
+        return;
+    }
     m_hoverScale = scale;
+    InvalidateWorldTransform();
+    WakeUp();
     // Actual application happens in Update() via GetWorldScale()
 }
 
@@ -212,22 +257,25 @@ void ControlledProjectile::SetTransform(const ProjectileTransform& transform) {
         return;
     }
 
+    auto& store = TransformStore::GetSingleton();
+
     // If starting a new transition, initialize from current game position
-    if (m_smoother.GetMode() == TransitionMode::Lerp && !m_smoother.IsTransitioning()) {
-        m_smoother.SetCurrent(m_gameProjectile.GetTargetTransform());
+    if (IsSmoothedMode(store.GetMode(m_transformHandle)) && !store.IsTransitioning(m_transformHandle)) {
+        store.SetCurrent(m_transformHandle, m_gameProjectile.GetTargetTransform());
     }
 
-    // Set target (smoother handles instant vs lerp mode)
-    m_smoother.SetTarget(transform);
+    // Set target (store handles instant vs lerp mode)
+    store.SetTarget(m_transformHandle, transform);
+    WakeUp();
 
     // In instant mode, apply immediately
-    if (m_smoother.GetMode() == TransitionMode::Instant) {
-        m_gameProjectile.SetTransform(m_smoother.GetCurrent());
+    if (store.GetMode(m_transformHandle) == TransitionMode::Instant) {
+        m_gameProjectile.SetTransform(store.GetCurrent(m_transformHandle));
     }
 }
 
 ProjectileTransform ControlledProjectile::GetTransform() const {
-    return m_smoother.GetCurrent();
+    return TransformStore::GetSingleton().GetCurrent(m_transformHandle);
 }
 
 bool ControlledProjectile::OnEvent(InputEvent& event) {
@@ -296,6 +344,7 @@ void ControlledProjectile::SetVisible(bool visible) {
 
     // Update user intent
     m_localVisible = visible;
+    WakeUp();
 
     // Handle show request
     if (visible) {
@@ -400,11 +449,16 @@ void ControlledProjectile::UnbindProjectile() {
         ++m_fireGeneration;
 
         // Cache current transform before releasing
+        auto& store = TransformStore::GetSingleton();
         if (m_gameProjectile.IsBound()) {
-            m_smoother.SetCurrent(m_gameProjectile.GetTargetTransform());
+            store.SetCurrent(m_transformHandle, m_gameProjectile.GetTargetTransform());
         }
+        store.SetOutput(m_transformHandle, nullptr);
 
         // Unbind and mark for deletion
+        if (m_subsystem) {
+            m_subsystem->UnindexBoundProjectile(m_gameProjectile.GetProjectile());
+        }
         m_gameProjectile.MarkForDeletion();
         m_gameProjectile.Unbind();
 
@@ -452,20 +506,18 @@ void ControlledProjectile::RebindProjectile() {
     }
 
     // Re-acquire a form for our model
-    std::string modelPath = !m_texturePath.empty()
-        ? "meshes\\3DUI\\icon_template.nif"
-        : m_modelPath;
+    InternedString modelPath = !m_texturePath.empty() ? GetTextureModelPath() : m_modelPath;
     auto acquireStart = std::chrono::high_resolution_clock::now();
     int newFormIndex = m_subsystem->AcquireForm(modelPath);
     auto acquireEnd = std::chrono::high_resolution_clock::now();
     auto acquireTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(acquireEnd - acquireStart).count();
     if (acquireTimeUs > 200) {
         spdlog::trace("[REBIND] {} AcquireForm took {}us (model='{}')",
-            m_uuid.ToString(), acquireTimeUs, modelPath);
+            m_uuid.ToString(), acquireTimeUs, modelPath.view());
     }
     if (newFormIndex < 0) {
         spdlog::warn("[Visibility] {} RebindProjectile: no form for '{}'",
-            m_uuid.ToString(), modelPath);
+            m_uuid.ToString(), modelPath.view());
         spdlog::trace("[BindState] {} Firing -> Unbound (no form)", m_uuid.ToString());
         m_bindState.store(BindState::Unbound);  // Revert state
         return;
@@ -506,6 +558,41 @@ void ControlledProjectile::RebindProjectile() {
 
 void ControlledProjectile::SetBillboardMode(BillboardMode mode) {
     m_billboardMode = mode;
+    m_hasBillboardTarget = false;  // Solve against the new target on the next Update()
+    WakeUp();
+}
+
+bool ControlledProjectile::IsAtRest() const {
+    if (!m_atRest || TransformStore::GetSingleton().IsTransitioning(m_transformHandle)) {
+        return false;
+    }
+
+    // Firing waits for the spawn callback; Unbound while shown means Update() rebinds
+    switch (m_bindState.load()) {
+        case BindState::Bound:
+            if (m_gameProjectile.NeedsTextureSet()) {
+                return false;  // ApplyPendingTexture() retries every frame
+            }
+            break;
+        case BindState::Unbound:
+            if (m_localVisible && IsEffectivelyVisible()) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+
+    if (m_background) {
+        bool pendingInit = !m_background->IsValid() && m_localVisible && IsEffectivelyVisible();
+        if (pendingInit || (m_background->IsValid() && !m_background->IsAtRest())) {
+            return false;
+        }
+    }
+    if (m_labelTextDriver && m_labelTextVisible && !m_labelTextDriver->IsAtRest()) {
+        return false;
+    }
+    return true;
 }
 
 void ControlledProjectile::Update(float deltaTime) {
@@ -524,26 +611,35 @@ void ControlledProjectile::Update(float deltaTime) {
         state = m_bindState.load();  // Refresh state after potential transition
     }
 
-    // Update billboard first - this sets our local rotation
-    UpdateBillboard();
+    // Update billboard first - this sets our local rotation. Our own position or parent
+    // rotation changing moves the facing too, so those force a solve.
+    bool inputsChanged = ConsumeWorldTransformChange();
+    UpdateBillboard(inputsChanged);
+    inputsChanged = ConsumeWorldTransformChange() || inputsChanged;
 
-    // Compute world transform from scene graph hierarchy
-    ProjectileTransform transform = m_smoother.GetTarget();
-    transform.position = GetWorldPosition();
-    transform.scale = GetWorldScale();
+    // At rest: no input of our world transform changed since the last retarget and the
+    // store slot has converged (and snapped to its target), so there is nothing to do.
+    // Any local setter, parent/anchor move or facing change invalidates us and wakes us up.
+    auto& store = TransformStore::GetSingleton();
+    m_atRest = !inputsChanged && !store.IsTransitioning(m_transformHandle);
 
-    // Get world rotation matrix from scene graph
-    // This composes parent rotation with our local (billboard) rotation
-    transform.rotation = GetWorldRotation();
+    if (!m_atRest) {
+        // Compute world transform from scene graph hierarchy
+        ProjectileTransform transform;
+        transform.position = GetWorldPosition();
+        transform.scale = GetWorldScale();
 
-    // If starting a new transition and we have a bound game projectile, initialize from current game position
-    if (state == BindState::Bound && m_smoother.GetMode() == TransitionMode::Lerp && !m_smoother.IsTransitioning()) {
-        m_smoother.SetCurrent(m_gameProjectile.GetTargetTransform());
-    }
-    m_smoother.SetTarget(transform);
+        // Get world rotation matrix from scene graph
+        // This composes parent rotation with our local (billboard) rotation
+        transform.rotation = GetWorldRotation();
 
-    // Apply transition smoothing and update game projectile (if bound)
-    UpdateTransition(deltaTime);
+        // Retarget our store slot. If starting a new transition and we have a bound game projectile,
+        // the store initializes from the current game position. Smoothing and publishing to the
+        // game projectile happen in TransformStore::Update() once all drivers have updated.
+        const ProjectileTransform* startFrom =
+            (state == BindState::Bound) ? &m_gameProjectile.GetTargetTransform() : nullptr;
+        store.Retarget(m_transformHandle, transform, startFrom, deltaTime);
+    }
 
     // Apply pending texture from main thread (texture loading is not thread-safe)
     // This was previously called from ApplyTransform() on hook threads, causing crashes
@@ -568,25 +664,6 @@ void ControlledProjectile::Update(float deltaTime) {
     }
 }
 
-void ControlledProjectile::UpdateTransition(float deltaTime) {
-    if (!IsValid()) {
-        return;
-    }
-
-    // Update smoother (may be no-op in Instant mode)
-    // Always update even when not bound so position is ready when shown
-    m_smoother.Update(deltaTime);
-
-    // Only apply to game projectile if Bound
-    // (Firing state means async bind is still pending)
-    if (m_bindState.load() == BindState::Bound && m_gameProjectile.IsBound()) {
-        // Store the desired transform - actual application happens on main thread
-        // via ProjectileSubsystem::OnProjectileUpdate() which is called from the game hook.
-        // This ensures we never modify game data from the VR compositor thread.
-        m_gameProjectile.SetTransform(m_smoother.GetCurrent());
-    }
-}
-
 void ControlledProjectile::Destroy() {
     if (!m_valid || !m_subsystem) {
         return;
@@ -607,6 +684,8 @@ void ControlledProjectile::Destroy() {
     }
 
     // Mark for deletion and unbind
+    TransformStore::GetSingleton().SetOutput(m_transformHandle, nullptr);
+    m_subsystem->UnindexBoundProjectile(m_gameProjectile.GetProjectile());
     m_gameProjectile.MarkForDeletion();
     m_gameProjectile.Unbind();
 
@@ -665,14 +744,12 @@ void ControlledProjectile::Initialize() {
     }
 
     // Determine effective model path
-    std::string modelPath = !m_texturePath.empty()
-        ? "meshes\\3DUI\\icon_template.nif"
-        : m_modelPath;
+    InternedString modelPath = !m_texturePath.empty() ? GetTextureModelPath() : m_modelPath;
 
     // Acquire a form for this model
     m_formIndex = m_subsystem->AcquireForm(modelPath);
     if (m_formIndex < 0) {
-        spdlog::error("ControlledProjectile::Initialize - Failed to acquire form for '{}'", modelPath);
+        spdlog::error("ControlledProjectile::Initialize - Failed to acquire form for '{}'", modelPath.view());
         return;
     }
 
@@ -743,14 +820,19 @@ void ControlledProjectile::BindToProjectile(RE::Projectile* proj, uint64_t gener
 
     // We now own the Bound state - complete the bind
     m_gameProjectile.BindToProjectile(proj);
+    if (m_subsystem) {
+        m_subsystem->IndexBoundProjectile(m_gameProjectile.GetProjectile(), this);
+    }
 
     // Ensure visibility is set (may have been false from previous hide)
     m_gameProjectile.SetVisible(true);
 
     // Immediately apply correct transform to prevent first-frame flash
     // Set current = target so projectile appears at intended position with no lerp
-    m_smoother.SetCurrent(m_smoother.GetTarget());
-    m_gameProjectile.SetTransform(m_smoother.GetCurrent());
+    auto& store = TransformStore::GetSingleton();
+    store.SetCurrent(m_transformHandle, store.GetTarget(m_transformHandle));
+    m_gameProjectile.SetTransform(store.GetCurrent(m_transformHandle));
+    store.SetOutput(m_transformHandle, &m_gameProjectile);
     m_gameProjectile.ApplyTransform();
 
     spdlog::trace("[Visibility] {} BindToProjectile: bound successfully (gen={})",
@@ -797,7 +879,7 @@ void ControlledProjectile::ClearBackground() {
     }
 }
 
-void ControlledProjectile::UpdateBillboard() {
+void ControlledProjectile::UpdateBillboard(bool force) {
     if (!IsValid() || m_billboardMode == BillboardMode::None) {
         return;
     }
@@ -815,6 +897,14 @@ void ControlledProjectile::UpdateBillboard() {
             return;
     }
 
+    // Nothing moved since the last solve - its rotation still stands. Compared against the
+    // target of that solve (not last frame's), so slow drift still triggers one eventually.
+    if (!force && m_hasBillboardTarget && NearlyEqual(targetPos, m_billboardTarget, REST_POSITION_EPSILON)) {
+        return;
+    }
+    m_billboardTarget = targetPos;
+    m_hasBillboardTarget = true;
+
     // Get current world position (from scene graph)
     RE::NiPoint3 currentPos = GetWorldPosition();
 
@@ -834,13 +924,17 @@ void ControlledProjectile::UpdateBillboard() {
     // Convert world rotation to local rotation
     // WorldRot = ParentWorldRot x LocalRot
     // Therefore: LocalRot = Inverse(ParentWorldRot) x DesiredWorldRot
+    RE::NiMatrix3 localRotation = desiredWorldRotation;
     if (m_parent) {
         RE::NiMatrix3 parentWorldRot = m_parent->GetWorldRotation();
         RE::NiMatrix3 parentInverse = InverseRotationMatrix(parentWorldRot);
-        SetLocalRotation(MultiplyMatrices(parentInverse, desiredWorldRotation));
-    } else {
-        // No parent - local rotation IS world rotation
-        SetLocalRotation(desiredWorldRotation);
+        localRotation = MultiplyMatrices(parentInverse, desiredWorldRotation);
+    }
+    // else: no parent - local rotation IS world rotation
+
+    // Ignore sub-epsilon jitter so a static element can stay at rest
+    if (!NearlyEqual(localRotation, m_localRotation, REST_ROTATION_EPSILON)) {
+        SetLocalRotation(localRotation);
     }
 }
 
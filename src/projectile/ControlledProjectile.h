@@ -1,8 +1,10 @@
 #pragma once
 
+#include "../util/StringTable.h"
 #include "../util/UUID.h"
 #include "GameProjectile.h"
 #include "TransformSmoother.h"
+#include "TransformStore.h"
 #include "IPositionable.h"
 #include <atomic>
 #include <functional>
@@ -40,7 +42,7 @@ class ControlledProjectile : public IPositionable, public std::enable_shared_fro
     friend class ProjectileSubsystem;  // Allow subsystem to access m_formIndex for spawning
 
 public:
-    ControlledProjectile() = default;
+    ControlledProjectile();
     ~ControlledProjectile();
 
     // Move-only (handles are unique)
@@ -57,26 +59,28 @@ public:
     const UUID& GetUUID() const { return m_uuid; }
 
     // === Visual Configuration (formerly WidgetItem) ===
-    void SetModelPath(const std::string& path) { m_modelPath = path; }
-    const std::string& GetModelPath() const { return m_modelPath; }
+    // Paths and colors are interned: items sharing a mesh or texture share one copy.
+    // Tooltip and label are free-form text, so they stay owned.
+    void SetModelPath(std::string_view path) { m_modelPath = InternedString(path); }
+    InternedString GetModelPath() const { return m_modelPath; }
 
-    void SetTexturePath(const std::string& path) { m_texturePath = path; }
-    const std::string& GetTexturePath() const { return m_texturePath; }
+    void SetTexturePath(std::string_view path) { m_texturePath = InternedString(path); }
+    InternedString GetTexturePath() const { return m_texturePath; }
 
-    void SetBorderColor(const std::string& color) { m_borderColor = color; }
-    const std::string& GetBorderColor() const { return m_borderColor; }
+    void SetBorderColor(std::string_view color) { m_borderColor = InternedString(color); }
+    InternedString GetBorderColor() const { return m_borderColor; }
 
     void SetText(const std::wstring& text) { m_text = text; }
     const std::wstring& GetText() const { return m_text; }
 
-    void SetBaseScale(float scale) { m_baseScale = scale; }
+    void SetBaseScale(float scale) { m_baseScale = scale; InvalidateWorldTransform(); WakeUp(); }
     float GetBaseScale() const { return m_baseScale; }
 
-    void SetScaleCorrection(float correction) { m_scaleCorrection = correction; }
+    void SetScaleCorrection(float correction) { m_scaleCorrection = correction; InvalidateWorldTransform(); WakeUp(); }
     float GetScaleCorrection() const { return m_scaleCorrection; }
 
     // Rotation correction in DEGREES (pitch, roll, yaw) applied in model space
-    void SetRotationCorrection(const RE::NiPoint3& euler) { m_rotationCorrection = euler; }
+    void SetRotationCorrection(const RE::NiPoint3& euler) { m_rotationCorrection = euler; InvalidateWorldTransform(); WakeUp(); }
     const RE::NiPoint3& GetRotationCorrection() const { return m_rotationCorrection; }
 
     // === Behavior Flags ===
@@ -143,12 +147,17 @@ public:
     // === Position Control ===
     // IPositionable override - set local position (relative to parent)
     // Drivers should use this method
-    void SetLocalPosition(const RE::NiPoint3& pos) override { m_localPosition = pos; }
+    void SetLocalPosition(const RE::NiPoint3& pos) override {
+        if (pos == m_localPosition) {
+            return;  // Unchanged - don't wake from rest
+        }
+        m_localPosition = pos;
+        InvalidateWorldTransform();
+        WakeUp();
+    }
 
-    // IPositionable overrides for world transform computation
-    RE::NiPoint3 GetWorldPosition() const override;
-    RE::NiMatrix3 GetWorldRotation() const override;  // Applies rotationCorrection
-    float GetWorldScale() const override;
+    // IPositionable override - also invalidates background and label (they're parented to us)
+    void InvalidateWorldTransform() override;
 
     // Event handling - returns false to let events bubble up
     bool OnEvent(InputEvent& event) override;
@@ -182,22 +191,36 @@ public:
     BillboardMode GetBillboardMode() const { return m_billboardMode; }
 
     // === Transition Mode ===
-    void SetTransitionMode(TransitionMode mode) { m_smoother.SetMode(mode); }
+    void SetTransitionMode(TransitionMode mode) { TransformStore::GetSingleton().SetMode(m_transformHandle, mode); }
 
     // Smoothing speed for Lerp mode (higher = more responsive, 10 = snappy, 2 = floaty)
-    void SetSmoothingSpeed(float speed) { m_smoother.SetSpeed(speed); }
+    void SetSmoothingSpeed(float speed) { TransformStore::GetSingleton().SetSpeed(m_transformHandle, speed); }
 
     // Seed the smoother with a transform (sets both current and target)
     // Call this before firing to ensure projectile spawns at correct position
     void SeedTransform(const ProjectileTransform& transform) {
-        m_smoother.SetCurrent(transform);
-        m_smoother.SetTarget(transform);
+        auto& store = TransformStore::GetSingleton();
+        store.SetCurrent(m_transformHandle, transform);
+        store.SetTarget(m_transformHandle, transform);
     }
 
+    // Handle to this projectile's slot in the TransformStore (smoother state)
+    TransformHandle GetTransformHandle() const { return m_transformHandle; }
+
     // Main update function (IPositionable override)
-    // Computes world transform from hierarchy, handles billboard rotation and transition smoothing
+    // Computes world transform from hierarchy and billboard rotation, then retargets our
+    // TransformStore slot. Smoothing and publishing to the game projectile happen in the
+    // store's batch TransformStore::Update() once all drivers have updated.
+    // Skipped while at rest (see IsAtRest).
     void Update(float deltaTime) override;
 
+    // At rest: nothing feeding our world transform (local transform, parent chain, anchor,
+    // billboard facing) changed since the last retarget and our smoothing has converged,
+    // so the game projectile already holds the final transform and Update() skips the retarget.
+    // Also requires no pending bind, texture, background or label work, so the driver may skip
+    // our Update() entirely (it watches the billboard targets itself, see ProjectileDriver).
+    bool IsAtRest() const override;
+
     // === Lifecycle ===
     // Destroy this projectile and release resources
     void Destroy();
@@ -217,10 +240,18 @@ public:
     GameProjectile& GetGameProjectile() { return m_gameProjectile; }
     const GameProjectile& GetGameProjectile() const { return m_gameProjectile; }
 
+protected:
+    // IPositionable overrides for world transform computation
+    RE::NiPoint3 ComputeWorldPosition() const override;
+    RE::NiMatrix3 ComputeWorldRotation() const override;  // Applies rotationCorrection
+    float ComputeWorldScale() const override;
+
 private:
     // Internal update helpers
-    void UpdateBillboard();
-    void UpdateTransition(float deltaTime);
+    // Only touches local rotation when facing changed beyond epsilon. Skips the solve while
+    // the billboard target hasn't moved past REST_POSITION_EPSILON since the last one,
+    // unless force (our own world transform inputs changed)
+    void UpdateBillboard(bool force);
     RE::NiPoint3 GetPosition() const;  // Returns smoother's current position
 
     // Resource management helpers
@@ -234,9 +265,9 @@ private:
     UUID m_uuid;
 
     // Visual configuration (formerly WidgetItem)
-    std::string m_modelPath;
-    std::string m_texturePath;
-    std::string m_borderColor;
+    InternedString m_modelPath;
+    InternedString m_texturePath;
+    InternedString m_borderColor;
     std::wstring m_text;
     float m_baseScale = 1.0f;
     float m_scaleCorrection = 1.0f;
@@ -261,7 +292,7 @@ private:
     int m_formIndex = -1;           // Which FormManager form this projectile uses
     bool m_valid = false;
     BillboardMode m_billboardMode = BillboardMode::YawOnly;  // Default to YawOnly
-    TransformSmoother m_smoother;
+    TransformHandle m_transformHandle;  // Smoother state lives in TransformStore (SoA)
     GameProjectile m_gameProjectile;  // Directly owned, no pool
 
     // Atomic binding state for lock-free thread safety
@@ -272,6 +303,12 @@ private:
     // Note: base scale uses m_localScale from IPositionable
     float m_hoverScale = 1.0f;   // Set via SetHoverScale()
 
+    bool m_atRest = false;       // Last Update() skipped the retarget (see IsAtRest())
+
+    // Billboard target (HMD or player) used by the last billboard solve
+    RE::NiPoint3 m_billboardTarget;
+    bool m_hasBillboardTarget = false;
+
     // Track last heading for billboard continuity (prevents 180-degree flips)
     float m_lastHeading = 0.0f;
 
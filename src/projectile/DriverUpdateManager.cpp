@@ -4,7 +4,13 @@
 #include "../MenuChecker.h"
 #include "../projectile/ProjectileSubsystem.h"
 #include "../projectile/AsyncTextureLoader.h"
+#include "../projectile/IconAtlas.h"
+#include "../projectile/Drivers/TextDriver.h"
+#include "../projectile/FrameProfiler.h"
+#include "../projectile/TransformStore.h"
 #include "../log.h"
+#include "../util/VRNodes.h"
+#include "../Config.h"
 #include <algorithm>
 #include <thread>
 #include <sstream>
@@ -50,8 +56,29 @@ void DriverUpdateManager::Initialize(Projectile::ProjectileSubsystem* projectile
     m_projectileSubsystem = projectileSubsystem;
     m_hasLastUpdateTime = false;
 
-    // Start async texture loader worker thread
-    Projectile::AsyncTextureLoader::GetInstance().Start();
+    // Frame budget scheduler settings ([Performance] in the INI)
+    const auto& options = Config::options;
+    FrameScheduler::Settings settings;
+    settings.budgetUs = static_cast<uint32_t>((std::max)(options.frameBudgetMicroseconds, 0));
+    settings.farInterval = static_cast<uint32_t>((std::max)(options.farMenuUpdateInterval, 1));
+    settings.hiddenInterval = static_cast<uint32_t>((std::max)(options.hiddenMenuUpdateInterval, 1));
+    m_scheduler.SetSettings(settings);
+    m_farMenuDistance = options.farMenuDistance;
+
+    // Layout compute workers: auto (-1) only spreads out on machines with cores to spare
+    int layoutWorkers = options.layoutWorkerThreads;
+    if (layoutWorkers < 0) {
+        unsigned int cores = std::thread::hardware_concurrency();
+        layoutWorkers = (cores >= 8) ? static_cast<int>((std::min)(cores / 4, 3u)) : 0;
+    }
+    m_layoutPool.Start(static_cast<size_t>(layoutWorkers));
+    spdlog::info("DriverUpdateManager: {} layout worker thread(s)", layoutWorkers);
+
+    // Start async texture loader worker threads
+    auto& textureLoader = Projectile::AsyncTextureLoader::GetInstance();
+    textureLoader.SetCacheBudget(static_cast<size_t>((std::max)(options.textureCacheBudgetMB, 0)) * 1024 * 1024);
+    textureLoader.Start(static_cast<size_t>((std::max)(options.textureLoaderThreads, 1)));
+    Projectile::IconAtlas::GetSingleton().Configure(static_cast<uint32_t>((std::max)(options.iconAtlasMaxPages, 0)));
 
     spdlog::info("DriverUpdateManager initialized (main thread hook mode)");
 }
@@ -63,6 +90,8 @@ void DriverUpdateManager::Shutdown() {
     // Shutdown async texture loader (stops worker thread)
     Projectile::AsyncTextureLoader::GetInstance().Shutdown();
 
+    m_layoutPool.Stop();
+
     // Note: Hook cannot be uninstalled - it remains for the lifetime of the game.
     // This is fine because the hook checks if manager is initialized.
 
@@ -123,44 +152,209 @@ void DriverUpdateManager::Update(float deltaTime) {
             sinceLast.count());
     }
 
+    using Projectile::FrameProfiler;
+    using Projectile::ProfileScope;
+    auto& profiler = FrameProfiler::GetSingleton();
+
     // Process completed async texture loads first (fires callbacks on main thread)
     // This must happen before driver updates so textures are swapped in promptly
-    Projectile::AsyncTextureLoader::GetInstance().ProcessCompletedLoads();
+    {
+        FrameProfiler::Scope scope(ProfileScope::TextureProcessing);
+        Projectile::AsyncTextureLoader::GetInstance().ProcessCompletedLoads();
+    }
 
     // Skip all interaction updates when a game menu is open
     bool menuOpen = MenuChecker::IsGameStopped();
 
-    // THREAD SAFETY: Since we're now on the main thread, we don't strictly need
-    // to copy the vector before iterating. However, keeping the copy is defensive
-    // in case callbacks indirectly cause Register/Unregister during iteration.
-    auto registeredCopy = m_registered;
+    // Classify every root, then let the scheduler pick which are due this frame (most
+    // urgent first). Skipped roots accumulate their delta time for when they next run.
+    RE::NiAVObject* hmd = VRNodes::GetHMD();
+    m_scheduleCandidates.clear();
+    m_scheduleDrivers.clear();
+    for (auto* driver : m_registered) {
+        if (driver) {
+            m_scheduleCandidates.push_back({driver, ClassifyPriority(driver, hmd)});
+            m_scheduleDrivers.push_back(driver);
+        }
+    }
+    const auto& plan = m_scheduler.Plan(m_scheduleCandidates, deltaTime);
+
+    // Admission: pick the due roots that fit this frame's budget. Compute runs for all of
+    // them before any is measured, so the budget is charged with each root's estimated cost.
+    m_admittedRoots.clear();
+    uint64_t projectedUs = 0;
+    for (size_t index : plan) {
+        auto* driver = m_scheduleDrivers[index];
+        float driverDelta = deltaTime;
+        if (!m_scheduler.Admit(driver, projectedUs, driverDelta)) {
+            continue;  // Over budget - deferred, its delta rolls over
+        }
+        projectedUs += static_cast<uint64_t>(m_scheduler.GetEstimatedCost(driver));
+        m_admittedRoots.push_back({index, driverDelta, 0});
+    }
 
-    for (auto* driver : registeredCopy) {
-        if (!driver) continue;
+    // Anchor and facing anchor nodes are game objects: sample them here, on the main thread,
+    // so the compute phase below reads only the snapshots
+    for (const auto& root : m_admittedRoots) {
+        m_scheduleDrivers[root.index]->SnapshotAnchors();
+    }
 
-        // Update driver first (positioning) - always runs for visual consistency
-        driver->Update(deltaTime);
+    // Compute phase: roots are independent trees, so their anchor, facing, layout and
+    // world-transform math runs in parallel on the snapshotted game node positions
+    m_layoutPool.ParallelFor(m_admittedRoots.size(), [this](size_t i) {
+        auto& root = m_admittedRoots[i];
+        auto* driver = m_scheduleDrivers[root.index];
+        FrameProfiler::OwnerScope owner(driver);
+        auto start = std::chrono::steady_clock::now();
+        driver->ComputeLayout(root.deltaTime);
+        root.computeUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    });
+
+    // Commit phase, serial on the main thread. Iterate in place: Register/Unregister calls
+    // made by callbacks during the loop are deferred (see ApplyPendingRegistrations)
+    m_updating = true;
+    for (const auto& root : m_admittedRoots) {
+        auto* driver = m_scheduleDrivers[root.index];
+        if (!driver) continue;  // Unregistered by an earlier root this frame
+
+        // Attribute everything below (layout of sub-drivers included) to this root driver
+        FrameProfiler::OwnerScope owner(driver);
+        auto rootStart = std::chrono::steady_clock::now();
+
+        // Update driver first (positioning)
+        {
+            FrameProfiler::Scope scope(ProfileScope::DriverUpdate);
+            driver->Update(root.deltaTime);
+        }
 
         // Then interaction (hover detection) - skip when menu is open
-        // Interaction controller is owned by the driver
-        if (!menuOpen) {
+        // Interaction controller is owned by the driver. Re-read the slot: the driver may
+        // have been unregistered (destroyed) by its own update.
+        if (!menuOpen && m_scheduleDrivers[root.index]) {
             if (auto* interaction = driver->GetInteractionController()) {
-                interaction->Update(deltaTime);
+                FrameProfiler::Scope scope(ProfileScope::Interaction);
+                interaction->Update(root.deltaTime);
             }
         }
+
+        // Charge compute time too, so the budget estimate stays conservative
+        auto commitUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - rootStart).count();
+        m_scheduler.RecordCost(driver, root.computeUs + static_cast<uint64_t>(commitUs));
+    }
+    m_updating = false;
+    ApplyPendingRegistrations();
+
+    if (m_scheduler.GetDeferredCount() > 0) {
+        spdlog::trace("[DriverMgr] Frame budget: deferred {} root(s) to the next frame",
+            m_scheduler.GetDeferredCount());
     }
 
     // Update tooltip system (must be after interaction updates which set tooltip state)
-    TooltipTextDisplayManager::GetSingleton()->Update(deltaTime);
+    {
+        FrameProfiler::Scope scope(ProfileScope::Tooltip);
+        TooltipTextDisplayManager::GetSingleton()->Update(deltaTime);
+    }
 
-    // [DIAG] Watchdog - detect slow updates
+    // Hand this frame's binds and unbinds to the projectile hook in one index publish
+    if (m_projectileSubsystem) {
+        m_projectileSubsystem->PublishBoundIndex();
+    }
+
+    // Batch smoothing pass over every projectile retargeted this frame, then publish
+    // to bound game projectiles (must run after all driver and tooltip updates)
+    {
+        FrameProfiler::Scope scope(ProfileScope::Smoothing);
+        Projectile::TransformStore::GetSingleton().Update(deltaTime);
+    }
+
+    // Close the profiler frame (drains every thread's samples into the rolling windows)
     auto updateEnd = std::chrono::steady_clock::now();
+    if (profiler.IsEnabled()) {
+        profiler.Record(ProfileScope::Frame, nullptr, updateEnd - updateStart);
+    }
+    profiler.EndFrame();
+
+    // [DIAG] Watchdog - detect slow updates
     auto updateDuration = std::chrono::duration_cast<std::chrono::milliseconds>(updateEnd - updateStart);
     if (updateDuration > std::chrono::milliseconds(100)) {
         spdlog::warn("[WATCHDOG] Update took {}ms (drivers={})",
             updateDuration.count(), m_registered.size());
+        profiler.DumpToLog();
     }
     s_lastUpdateEnd = updateEnd;
+
+    // Periodic frame time report (Diagnostics/profilerReportIntervalSeconds, 0 = off)
+    int reportInterval = Config::options.profilerReportIntervalSeconds;
+    if (reportInterval > 0 && updateEnd - m_lastProfilerReport >= std::chrono::seconds(reportInterval)) {
+        if (m_lastProfilerReport != std::chrono::steady_clock::time_point{}) {
+            profiler.DumpToLog();
+            if (m_projectileSubsystem) {
+                auto spawn = m_projectileSubsystem->GetSpawnStats();
+                spdlog::info("[Profiler] Spawning: {} batches, {}/{} launched, last batch {} (latency mean {:.1f}ms max {:.1f}ms), peak {:.1f}ms",
+                    spawn.batches, spawn.launched, spawn.requests, spawn.lastBatchSize,
+                    spawn.lastBatchMeanLatencyMs, spawn.lastBatchMaxLatencyMs, spawn.peakLatencyMs);
+                auto forms = m_projectileSubsystem->GetFormStats();
+                spdlog::info("[Profiler] Forms: {}/{} in use, {} idle; {} hits, {} misses, {} evictions, {} exhaustions",
+                    m_projectileSubsystem->GetUsedForms(), m_projectileSubsystem->GetTotalForms(),
+                    m_projectileSubsystem->GetIdleForms(), forms.hits, forms.misses, forms.evictions,
+                    forms.exhaustions);
+                auto warm = m_projectileSubsystem->GetWarmPoolStats();
+                if (warm.hits + warm.misses > 0) {
+                    spdlog::info("[Profiler] Warm pool: {} parked, {} hits, {} misses, {} expired",
+                        warm.parked, warm.hits, warm.misses, warm.expired);
+                }
+            }
+            auto textures = Projectile::AsyncTextureLoader::GetInstance().GetStats();
+            if (textures.requested > 0) {
+                spdlog::info("[Profiler] Textures: {} requested, {} loaded, {} failed, {} cancelled ({} loads dropped), {} queued; "
+                    "queue wait mean {:.1f}ms max {:.1f}ms, load mean {:.1f}ms max {:.1f}ms",
+                    textures.requested, textures.loaded, textures.failed, textures.cancelled, textures.dropped,
+                    textures.queued, textures.meanQueueWaitMs, textures.maxQueueWaitMs,
+                    textures.meanLoadMs, textures.maxLoadMs);
+                auto cache = Projectile::AsyncTextureLoader::GetInstance().GetCacheStats();
+                spdlog::info("[Profiler] Texture cache: {} textures ({} pinned), {:.1f}/{:.1f}MB peak; {} hits, {} misses, {} evictions ({:.1f}MB)",
+                    cache.entries, cache.pinnedEntries, cache.bytes / (1024.0 * 1024.0),
+                    cache.peakBytes / (1024.0 * 1024.0), cache.hits, cache.misses, cache.evictions,
+                    cache.evictedBytes / (1024.0 * 1024.0));
+            }
+            auto& atlas = Projectile::IconAtlas::GetSingleton();
+            if (atlas.IsEnabled()) {
+                auto atlasStats = atlas.GetStats();
+                spdlog::info("[Profiler] Icon atlas: {} icons on {} pages ({:.0f}% full), {} standalone",
+                    atlasStats.icons, atlasStats.pages, atlasStats.occupancy * 100.0f, atlasStats.standalone);
+            }
+            auto layoutStats = Projectile::TextDriver::GetLayoutCacheStats();
+            if (layoutStats.hits + layoutStats.misses > 0) {
+                spdlog::info("[Profiler] Text layouts: {} cached; {} hits, {} misses, {} evictions",
+                    layoutStats.entries, layoutStats.hits, layoutStats.misses, layoutStats.evictions);
+            }
+        }
+        m_lastProfilerReport = updateEnd;
+    }
+}
+
+UpdatePriority DriverUpdateManager::ClassifyPriority(Projectile::ProjectileDriver* driver,
+                                                     RE::NiAVObject* hmd) const {
+    if (!driver->IsVisible()) {
+        return UpdatePriority::Hidden;
+    }
+    if (driver->IsGrabbing()) {
+        return UpdatePriority::Interacting;
+    }
+    if (auto* interaction = driver->GetInteractionController()) {
+        if (interaction->IsHandInteracting(true) || interaction->IsHandInteracting(false)) {
+            return UpdatePriority::Interacting;
+        }
+    }
+    if (hmd && m_farMenuDistance > 0.0f) {
+        RE::NiPoint3 offset = driver->GetWorldPosition() - hmd->world.translate;
+        if (offset.Length() > m_farMenuDistance) {
+            return UpdatePriority::Far;
+        }
+    }
+    return UpdatePriority::Normal;
 }
 
 void DriverUpdateManager::Register(Projectile::ProjectileDriver* driver) {
@@ -189,32 +383,83 @@ void DriverUpdateManager::Register(Projectile::ProjectileDriver* driver) {
 
     // Check if already registered
     auto it = std::find(m_registered.begin(), m_registered.end(), driver);
-    if (it != m_registered.end()) {
+    if (it != m_registered.end() ||
+        std::find(m_pendingRegistrations.begin(), m_pendingRegistrations.end(), driver) != m_pendingRegistrations.end()) {
         spdlog::warn("DriverUpdateManager::Register - driver '{}' already registered", driver->GetID());
         return;
     }
 
-    m_registered.push_back(driver);
     s_registeredCount.fetch_add(1, std::memory_order_relaxed);
+    if (m_updating) {
+        // Appending now could reallocate the vector Update() is iterating
+        m_pendingRegistrations.push_back(driver);
+        Projectile::FrameProfiler::GetSingleton().SetOwnerName(driver, driver->GetID());
+        spdlog::trace("[DriverMgr] Register: driver='{}' deferred until end of update", driver->GetID());
+        return;
+    }
+    m_registered.push_back(driver);
+    Projectile::FrameProfiler::GetSingleton().SetOwnerName(driver, driver->GetID());
     spdlog::trace("[DriverMgr] Register: driver='{}' total={}", driver->GetID(), m_registered.size());
 }
 
 void DriverUpdateManager::Unregister(Projectile::ProjectileDriver* driver) {
+    if (!driver) {
+        return;
+    }
+
+    Projectile::FrameProfiler::GetSingleton().ForgetOwner(driver);
+    m_scheduler.Forget(driver);
+
+    auto pending = std::find(m_pendingRegistrations.begin(), m_pendingRegistrations.end(), driver);
+    if (pending != m_pendingRegistrations.end()) {
+        m_pendingRegistrations.erase(pending);
+        s_registeredCount.fetch_sub(1, std::memory_order_relaxed);
+        spdlog::trace("[DriverMgr] Unregister: driver='{}' (was pending)", driver->GetID());
+        return;
+    }
+
     auto it = std::find(m_registered.begin(), m_registered.end(), driver);
     if (it != m_registered.end()) {
-        std::string driverId = driver ? driver->GetID() : "(null)";
-        m_registered.erase(it);
+        std::string driverId = driver->GetID();
+        if (m_updating) {
+            // Vacate the slot so the running loop skips it; compacted after the update
+            *it = nullptr;
+            std::replace(m_scheduleDrivers.begin(), m_scheduleDrivers.end(), driver,
+                static_cast<Projectile::ProjectileDriver*>(nullptr));
+            m_hasVacatedSlots = true;
+        } else {
+            m_registered.erase(it);
+        }
         s_registeredCount.fetch_sub(1, std::memory_order_relaxed);
-        spdlog::trace("[DriverMgr] Unregister: driver='{}' remaining={}", driverId, m_registered.size());
+        spdlog::trace("[DriverMgr] Unregister: driver='{}' remaining={}",
+            driverId, s_registeredCount.load(std::memory_order_relaxed));
     }
 }
 
 void DriverUpdateManager::UnregisterAll() {
-    m_registered.clear();
+    if (m_updating) {
+        std::fill(m_registered.begin(), m_registered.end(), nullptr);
+        std::fill(m_scheduleDrivers.begin(), m_scheduleDrivers.end(), nullptr);
+        m_hasVacatedSlots = true;
+    } else {
+        m_registered.clear();
+    }
+    m_pendingRegistrations.clear();
     s_registeredCount.store(0, std::memory_order_relaxed);
     spdlog::info("DriverUpdateManager: Unregistered all");
 }
 
+void DriverUpdateManager::ApplyPendingRegistrations() {
+    if (m_hasVacatedSlots) {
+        m_registered.erase(std::remove(m_registered.begin(), m_registered.end(), nullptr), m_registered.end());
+        m_hasVacatedSlots = false;
+    }
+    if (!m_pendingRegistrations.empty()) {
+        m_registered.insert(m_registered.end(), m_pendingRegistrations.begin(), m_pendingRegistrations.end());
+        m_pendingRegistrations.clear();
+    }
+}
+
 void DriverUpdateManager::HideAllDrivers() {
     spdlog::trace("[DriverMgr] HideAllDrivers: {} registered drivers", m_registered.size());
 
@@ -2,6 +2,8 @@
 
 #include "../projectile/ProjectileDriver.h"
 #include "InteractionController.h"
+#include "FrameScheduler.h"
+#include "WorkStealingPool.h"
 #include <vector>
 #include <memory>
 #include <chrono>
@@ -30,6 +32,8 @@ public:
     // Register a driver for automatic frame updates.
     // The driver should have its interaction controller set via SetInteractionController().
     // Caller retains ownership. Call Unregister before destroying it.
+    // Safe to call from inside a frame update: registrations take effect after the update
+    // loop, unregistered drivers are skipped immediately.
     void Register(Projectile::ProjectileDriver* driver);
     void Unregister(Projectile::ProjectileDriver* driver);
     void UnregisterAll();
@@ -41,11 +45,14 @@ public:
     // Restore visibility to drivers that were visible before HideAllDrivers was called
     void RestoreVisibleDrivers();
 
-    size_t GetRegisteredCount() const { return m_registered.size(); }
+    size_t GetRegisteredCount() const { return s_registeredCount.load(std::memory_order_relaxed); }
 
     // Install main thread hook (called once during plugin init)
     static bool InstallHook();
 
+    // Frame budget scheduler (settings come from the INI at Initialize)
+    FrameScheduler& GetScheduler() { return m_scheduler; }
+
 private:
     DriverUpdateManager() = default;
     ~DriverUpdateManager() = default;
@@ -70,10 +77,35 @@ private:
     static inline std::atomic<size_t> s_registeredCount{0};
 
     Projectile::ProjectileSubsystem* m_projectileSubsystem = nullptr;
-    std::vector<Projectile::ProjectileDriver*> m_registered;
+    std::vector<Projectile::ProjectileDriver*> m_registered;  // Null slots = unregistered mid-update
+
+    // Scheduling priority of a root driver this frame (hmd may be null)
+    UpdatePriority ClassifyPriority(Projectile::ProjectileDriver* driver, RE::NiAVObject* hmd) const;
+
+    // Deferred registration changes - Update() iterates m_registered in place
+    void ApplyPendingRegistrations();
+    bool m_updating = false;
+    bool m_hasVacatedSlots = false;
+    std::vector<Projectile::ProjectileDriver*> m_pendingRegistrations;
     std::vector<Projectile::ProjectileDriver*> m_hiddenVisibleDrivers;  // Drivers that were visible before HideAllDrivers
     std::chrono::steady_clock::time_point m_lastUpdateTime;
     bool m_hasLastUpdateTime = false;
+    std::chrono::steady_clock::time_point m_lastProfilerReport;  // Periodic FrameProfiler dump
+
+    // Frame budget scheduling (per-frame scratch vectors are reused)
+    FrameScheduler m_scheduler;
+    std::vector<FrameScheduler::Candidate> m_scheduleCandidates;
+    std::vector<Projectile::ProjectileDriver*> m_scheduleDrivers;  // Parallel to candidates, nulled on Unregister
+    float m_farMenuDistance = 0.0f;  // Roots farther than this from the HMD are Far (0 = off)
+
+    // Two-phase root update: parallel compute (layout math), then serial commit
+    struct AdmittedRoot {
+        size_t index;         // Into m_scheduleDrivers
+        float deltaTime;      // Including time rolled over from skipped frames
+        uint64_t computeUs;   // Written by the worker that ran the compute phase
+    };
+    std::vector<AdmittedRoot> m_admittedRoots;
+    Projectile::WorkStealingPool m_layoutPool;
 };
 
 } // namespace Widget
@@ -39,6 +39,7 @@ void ColumnGridProjectileDriver::SetVisible(bool visible) {
 void ColumnGridProjectileDriver::SetFillDirection(P3DUI::VerticalFill verticalFill, P3DUI::HorizontalFill horizontalFill) {
     m_verticalFill = verticalFill;
     m_horizontalFill = horizontalFill;
+    WakeUp();
 }
 
 // =============================================================================
@@ -48,6 +49,7 @@ void ColumnGridProjectileDriver::SetFillDirection(P3DUI::VerticalFill verticalFi
 void ColumnGridProjectileDriver::SetOrigin(P3DUI::VerticalOrigin verticalOrigin, P3DUI::HorizontalOrigin horizontalOrigin) {
     m_verticalOrigin = verticalOrigin;
     m_horizontalOrigin = horizontalOrigin;
+    WakeUp();
 }
 
 // =============================================================================
@@ -172,7 +174,7 @@ void ColumnGridProjectileDriver::ClampScrollOffset() {
 void ColumnGridProjectileDriver::SetScrollOffset(float offset) {
     m_scrollOffset = offset;
     ClampScrollOffset();
-    // Layout will be recomputed on next UpdateLayout call
+    WakeUp();  // Layout will be recomputed on next UpdateLayout call
 }
 
 bool ColumnGridProjectileDriver::IsXVisible(float displayedX) const {
@@ -202,6 +204,7 @@ void ColumnGridProjectileDriver::StartScrolling(bool isLeftHand) {
 
     m_isScrolling = true;
     m_scrollHandIsLeft = isLeftHand;
+    WakeUp();  // Layout follows the hand until EndScrolling
 
     // Capture the driver's rotation at scroll start - use this fixed reference frame
     // throughout the scroll to prevent direction flips when the driver rotates
@@ -223,6 +226,7 @@ void ColumnGridProjectileDriver::EndScrolling() {
     }
 
     m_isScrolling = false;
+    WakeUp();  // Lay out the final (snapped) offset
 
     // Snap to nearest column position if within threshold
     constexpr float SNAP_THRESHOLD = 3.0f;  // Game units
@@ -365,8 +369,8 @@ void ColumnGridProjectileDriver::Update(float deltaTime) {
 }
 
 void ColumnGridProjectileDriver::UpdateLayout(float deltaTime) {
-    // THREAD SAFETY: Copy children before iterating
-    auto children = GetChildrenMutable();  // Copy, not reference
+    // Iterate in place - layout only positions children, it never adds or removes them
+    const auto& children = GetChildren();
     size_t totalItems = children.size();
 
     if (totalItems == 0) {
@@ -533,12 +537,12 @@ void ColumnGridProjectileDriver::UpdateLayout(float deltaTime) {
 
         // Set visibility
         if (shouldBeVisible) {
-            child->SetVisible(true);
+            SetChildVisible(*child, true);
             if (isValidProjectile) {
                 child->SetLocalScale(1.0f);
             }
         } else {
-            child->SetVisible(false);
+            SetChildVisible(*child, false);
             if (isValidProjectile) {
                 child->SetLocalScale(0.0f);
             }
@@ -36,16 +36,16 @@ public:
     // === Layout Configuration ===
 
     // Distance between columns in the X direction (horizontal spacing)
-    void SetColumnSpacing(float spacing) { m_columnSpacing = spacing; }
+    void SetColumnSpacing(float spacing) { m_columnSpacing = spacing; WakeUp(); }
     float GetColumnSpacing() const { return m_columnSpacing; }
 
     // Distance between rows in the Z direction (vertical spacing)
-    void SetRowSpacing(float spacing) { m_rowSpacing = spacing; }
+    void SetRowSpacing(float spacing) { m_rowSpacing = spacing; WakeUp(); }
     float GetRowSpacing() const { return m_rowSpacing; }
 
     // Number of rows per column (default 1)
     // Items wrap to next column after this many rows
-    void SetNumRows(size_t numRows) { m_numRows = std::max<size_t>(1, numRows); }
+    void SetNumRows(size_t numRows) { m_numRows = std::max<size_t>(1, numRows); WakeUp(); }
     size_t GetNumRows() const { return m_numRows; }
 
     // === Fill Direction Configuration ===
@@ -70,7 +70,7 @@ public:
 
     // Visible width in game units (default 50)
     // Items within [-width/2, +width/2] are visible
-    void SetVisibleWidth(float width) { m_visibleWidth = width; }
+    void SetVisibleWidth(float width) { m_visibleWidth = width; WakeUp(); }
     float GetVisibleWidth() const { return m_visibleWidth; }
 
     // Scroll sensitivity: how much X offset per unit of hand movement
@@ -99,6 +99,9 @@ public:
 
 protected:
     void UpdateLayout(float deltaTime) override;
+    // Hand-driven scrolling moves the layout in Update(), so only run it early when idle
+    bool IsLayoutParallelSafe() const override { return !m_isScrolling; }
+    bool IsLayoutIdle() const override { return !m_isScrolling; }
 
     // Override to intercept non-anchor grabs for scrolling
     bool OnEvent(InputEvent& event) override;
@@ -19,6 +19,7 @@ void CurvedRowProjectileDriver::SetForwardDirection(const RE::NiPoint3& directio
         m_forwardDirection.x = direction.x / length;
         m_forwardDirection.y = direction.y / length;
         m_forwardDirection.z = direction.z / length;
+        WakeUp();
     }
 }
 
@@ -103,6 +104,7 @@ bool CurvedRowProjectileDriver::OnEvent(InputEvent& event) {
             m_grabStartAngle = ComputeAngleFromWorldPosition(grabPos);
             m_grabStartBaseOffset = m_baseAngleOffset;
             m_isSlideGrabbing = true;
+            WakeUp();  // Layout follows the hand until GrabEnd
 
             spdlog::info("CurvedRowProjectileDriver::OnEvent - GrabStart slide grab: startAngle={:.2f}, baseOffset={:.2f}",
                 m_grabStartAngle, m_grabStartBaseOffset);
@@ -131,8 +133,8 @@ void CurvedRowProjectileDriver::UpdateLayout(float deltaTime) {
         return;
     }
 
-    // THREAD SAFETY: Copy children before iterating - main thread may modify while VR thread updates
-    auto children = GetChildrenMutable();  // Copy, not reference
+    // Iterate in place - layout only positions children, it never adds or removes them
+    const auto& children = GetChildren();
 
     // Count visible children
     size_t validCount = 0;
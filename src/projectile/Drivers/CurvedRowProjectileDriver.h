@@ -12,16 +12,16 @@ public:
     CurvedRowProjectileDriver();
 
     // === Circle Configuration ===
-    void SetRadius(float radius) { m_radius = radius; }
+    void SetRadius(float radius) { m_radius = radius; WakeUp(); }
     float GetRadius() const { return m_radius; }
 
     // Fraction of full circle where items display (0-1, 1 = complete circle)
     // Used for clamping slide grab range
-    void SetVisibleItemRange(float range) { m_visibleItemRange = std::clamp(range, 0.0f, 1.0f); }
+    void SetVisibleItemRange(float range) { m_visibleItemRange = std::clamp(range, 0.0f, 1.0f); WakeUp(); }
     float GetVisibleItemRange() const { return m_visibleItemRange; }
 
     // Spacing between items in game units (arc length along the circle)
-    void SetItemOffset(float offset) { m_itemOffset = offset; }
+    void SetItemOffset(float offset) { m_itemOffset = offset; WakeUp(); }
     float GetItemOffset() const { return m_itemOffset; }
 
     // Set the forward direction - center of the visible slice (world space)
@@ -39,6 +39,9 @@ public:
 
 protected:
     void UpdateLayout(float deltaTime) override;
+    // Slide grabbing follows the hand, so only run the layout early when idle
+    bool IsLayoutParallelSafe() const override { return !m_isSlideGrabbing; }
+    bool IsLayoutIdle() const override { return !m_isSlideGrabbing; }
 
     // Compute the local position for a projectile at the given angle (relative to center)
     // Returns position in local coordinate space (X-Y plane)
@@ -8,8 +8,8 @@ namespace Projectile {
 // Child drivers automatically inherit world rotation via GetWorldRotation()
 
 void GridProjectileDriver::UpdateLayout(float deltaTime) {
-    // THREAD SAFETY: Copy children before iterating - main thread may modify while VR thread updates
-    auto children = GetChildrenMutable();  // Copy, not reference
+    // Iterate in place - layout only positions children, it never adds or removes them
+    const auto& children = GetChildren();
 
     for (size_t i = 0; i < children.size(); ++i) {
         auto& child = children[i];
@@ -12,7 +12,7 @@ public:
 
     // === Grid Configuration ===
     // Spacing between rows (vertical offset per child)
-    void SetRowSpacing(float spacing) { m_rowSpacing = spacing; }
+    void SetRowSpacing(float spacing) { m_rowSpacing = spacing; WakeUp(); }
     float GetRowSpacing() const { return m_rowSpacing; }
 
     // Note: SetFacingAnchor is inherited from ProjectileDriver
@@ -21,6 +21,7 @@ public:
 
 protected:
     void UpdateLayout(float deltaTime) override;
+    bool IsLayoutParallelSafe() const override { return true; }
 
 private:
     float m_rowSpacing = 30.0f;  // Vertical spacing between rows
@@ -9,8 +9,8 @@
 namespace Projectile {
 
 HalfWheelProjectileDriver::HalfWheelProjectileDriver() {
-    // Default to smooth transitions for ring layout
-    SetTransitionMode(TransitionMode::Lerp);
+    // Default to smooth transitions for ring layout; rotation slerps so facing changes don't pop
+    SetTransitionMode(TransitionMode::Slerp);
     // Note: FacingStrategy is NOT set here - parent driver handles facing
     // via scene graph rotation inheritance. Only root drivers should set facing.
 }
@@ -344,6 +344,7 @@ void HalfWheelProjectileDriver::StartScrolling(bool isLeftHand) {
 
     m_isScrolling = true;
     m_scrollHandIsLeft = isLeftHand;
+    WakeUp();  // Layout follows the hand until EndScrolling
 
     // Capture the driver's rotation at scroll start - use this fixed reference frame
     // throughout the scroll to prevent direction flips when the driver rotates (facing strategy)
@@ -366,6 +367,7 @@ void HalfWheelProjectileDriver::EndScrolling() {
     }
 
     m_isScrolling = false;
+    WakeUp();  // Lay out the final (snapped) offset
 
     // Snap to nearest ideal position if within threshold
     // Ideal positions = scroll offsets where an item is exactly at right edge (displayed angle 0)
@@ -529,8 +531,8 @@ void HalfWheelProjectileDriver::Update(float deltaTime) {
 }
 
 void HalfWheelProjectileDriver::UpdateLayout(float deltaTime) {
-    // THREAD SAFETY: Copy children before iterating - main thread may modify while VR thread updates
-    auto children = GetChildrenMutable();  // Copy, not reference
+    // Iterate in place - layout only positions children, it never adds or removes them
+    const auto& children = GetChildren();
     size_t totalItems = children.size();
 
     if (totalItems == 0) {
@@ -644,13 +646,13 @@ void HalfWheelProjectileDriver::UpdateLayout(float deltaTime) {
         // Set visibility - works even before Initialize() by setting m_localVisible
         // This ensures items that should be hidden don't fire when Initialize() runs
         if (shouldBeVisible) {
-            child->SetVisible(true);
+            SetChildVisible(*child, true);
             // Only set scale on valid projectiles
             if (isValidProjectile) {
                 child->SetLocalScale(1.0f);
             }
         } else {
-            child->SetVisible(false);
+            SetChildVisible(*child, false);
             if (isValidProjectile) {
                 child->SetLocalScale(0.0f);
             }
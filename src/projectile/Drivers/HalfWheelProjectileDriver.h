@@ -25,20 +25,20 @@ public:
 
     // === Ring Configuration ===
     // Target distance between items within a ring (actual distance is adjusted to fill arc evenly)
-    void SetItemSpacing(float spacing) { m_itemSpacing = spacing; }
+    void SetItemSpacing(float spacing) { m_itemSpacing = spacing; WakeUp(); }
     float GetItemSpacing() const { return m_itemSpacing; }
 
     // Distance between concentric rings
-    void SetRowDistance(float distance) { m_rowDistance = distance; }
+    void SetRowDistance(float distance) { m_rowDistance = distance; WakeUp(); }
     float GetRowDistance() const { return m_rowDistance; }
 
     // Ring spacing (alias for row distance - space between rings)
-    void SetRingSpacing(float spacing) { m_rowDistance = spacing; }
+    void SetRingSpacing(float spacing) { m_rowDistance = spacing; WakeUp(); }
     float GetRingSpacing() const { return m_rowDistance; }
 
     // Distance from center to first ring (optional, defaults to m_rowDistance if unset)
     // When set, all rings shift outward: center <firstRingSpacing> ring1 <rowDistance> ring2 ...
-    void SetFirstRingSpacing(float spacing) { m_firstRingSpacing = spacing; }
+    void SetFirstRingSpacing(float spacing) { m_firstRingSpacing = spacing; WakeUp(); }
     float GetFirstRingSpacing() const { return m_firstRingSpacing.value_or(m_rowDistance); }
     bool HasFirstRingSpacing() const { return m_firstRingSpacing.has_value(); }
     void ClearFirstRingSpacing() { m_firstRingSpacing.reset(); }
@@ -46,7 +46,7 @@ public:
     // === Scroll Configuration ===
     // Maximum number of visible rings (0 = unlimited, no scrolling)
     // When set, items beyond MaxRings are hidden and can be scrolled into view.
-    void SetMaxRings(size_t maxRings) { m_maxRings = maxRings; }
+    void SetMaxRings(size_t maxRings) { m_maxRings = maxRings; WakeUp(); }
     size_t GetMaxRings() const { return m_maxRings; }
 
     // Scroll sensitivity: how much rotation (radians) per unit of hand movement
@@ -54,7 +54,7 @@ public:
     float GetScrollSensitivity() const { return m_scrollSensitivity; }
 
     // Legacy compatibility
-    void SetSpacing(float spacing) { m_itemSpacing = spacing; }
+    void SetSpacing(float spacing) { m_itemSpacing = spacing; WakeUp(); }
     float GetSpacing() const { return m_itemSpacing; }
 
     // === Scroll State Query ===
@@ -67,6 +67,9 @@ public:
 
 protected:
     void UpdateLayout(float deltaTime) override;
+    // Hand-driven scrolling moves the layout in Update(), so only run it early when idle
+    bool IsLayoutParallelSafe() const override { return !m_isScrolling; }
+    bool IsLayoutIdle() const override { return !m_isScrolling; }
 
     // Override to intercept non-anchor grabs for scrolling
     bool OnEvent(InputEvent& event) override;
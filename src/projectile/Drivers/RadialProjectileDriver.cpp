@@ -6,8 +6,8 @@
 namespace Projectile {
 
 RadialProjectileDriver::RadialProjectileDriver() {
-    // Default to smooth transitions for ring layout
-    SetTransitionMode(TransitionMode::Lerp);
+    // Default to smooth transitions for ring layout; rotation slerps so facing changes don't pop
+    SetTransitionMode(TransitionMode::Slerp);
     // Note: FacingStrategy is NOT set here - parent driver handles facing
     // via scene graph rotation inheritance. Only root drivers should set facing.
 }
@@ -30,8 +30,8 @@ size_t RadialProjectileDriver::ComputeItemsInRing(size_t ringIndex) const {
 // via GetWorldPosition() which applies parent rotation to local positions
 
 void RadialProjectileDriver::UpdateLayout(float deltaTime) {
-    // THREAD SAFETY: Copy children before iterating - main thread may modify while VR thread updates
-    auto children = GetChildrenMutable();  // Copy, not reference
+    // Iterate in place - layout only positions children, it never adds or removes them
+    const auto& children = GetChildren();
 
     // First pass: count visible items for even distribution calculation
     m_visibleItemCount = 0;
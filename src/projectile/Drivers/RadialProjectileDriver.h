@@ -14,25 +14,26 @@ public:
 
     // === Ring Configuration ===
     // Target distance between items within a ring (actual distance is adjusted to fill circle evenly)
-    void SetItemSpacing(float spacing) { m_itemSpacing = spacing; }
+    void SetItemSpacing(float spacing) { m_itemSpacing = spacing; WakeUp(); }
     float GetItemSpacing() const { return m_itemSpacing; }
 
     // Distance between concentric rings
-    void SetRowDistance(float distance) { m_rowDistance = distance; }
+    void SetRowDistance(float distance) { m_rowDistance = distance; WakeUp(); }
     float GetRowDistance() const { return m_rowDistance; }
 
     // Ring spacing (alias for row distance - space between rings)
-    void SetRingSpacing(float spacing) { m_rowDistance = spacing; }
+    void SetRingSpacing(float spacing) { m_rowDistance = spacing; WakeUp(); }
     float GetRingSpacing() const { return m_rowDistance; }
 
     // Legacy compatibility
-    void SetSpacing(float spacing) { m_itemSpacing = spacing; }
+    void SetSpacing(float spacing) { m_itemSpacing = spacing; WakeUp(); }
     float GetSpacing() const { return m_itemSpacing; }
 
     // Note: SetFacingAnchor, GetFacingAnchor, HasFacingAnchor are inherited from ProjectileDriver
 
 protected:
     void UpdateLayout(float deltaTime) override;
+    bool IsLayoutParallelSafe() const override { return true; }
 
     // Compute the local position for a projectile at the given index (relative to center)
     // Returns position in local coordinate space (X-Y plane)
@@ -64,6 +64,7 @@ protected:
         // No-op: children retain their local positions as set by caller
         // The base Update() still recursively calls child->Update()
     }
+    bool IsLayoutParallelSafe() const override { return true; }
 
     // Override to call event callback after base handling
     bool OnEvent(InputEvent& event) override {
@@ -39,6 +39,7 @@ void RowGridProjectileDriver::SetVisible(bool visible) {
 void RowGridProjectileDriver::SetFillDirection(P3DUI::VerticalFill verticalFill, P3DUI::HorizontalFill horizontalFill) {
     m_verticalFill = verticalFill;
     m_horizontalFill = horizontalFill;
+    WakeUp();
 }
 
 // =============================================================================
@@ -48,6 +49,7 @@ void RowGridProjectileDriver::SetFillDirection(P3DUI::VerticalFill verticalFill,
 void RowGridProjectileDriver::SetOrigin(P3DUI::VerticalOrigin verticalOrigin, P3DUI::HorizontalOrigin horizontalOrigin) {
     m_verticalOrigin = verticalOrigin;
     m_horizontalOrigin = horizontalOrigin;
+    WakeUp();
 }
 
 // =============================================================================
@@ -171,7 +173,7 @@ void RowGridProjectileDriver::ClampScrollOffset() {
 void RowGridProjectileDriver::SetScrollOffset(float offset) {
     m_scrollOffset = offset;
     ClampScrollOffset();
-    // Layout will be recomputed on next UpdateLayout call
+    WakeUp();  // Layout will be recomputed on next UpdateLayout call
 }
 
 bool RowGridProjectileDriver::IsZVisible(float displayedZ) const {
@@ -201,6 +203,7 @@ void RowGridProjectileDriver::StartScrolling(bool isLeftHand) {
 
     m_isScrolling = true;
     m_scrollHandIsLeft = isLeftHand;
+    WakeUp();  // Layout follows the hand until EndScrolling
 
     // Capture the driver's rotation at scroll start - use this fixed reference frame
     // throughout the scroll to prevent direction flips when the driver rotates
@@ -222,6 +225,7 @@ void RowGridProjectileDriver::EndScrolling() {
     }
 
     m_isScrolling = false;
+    WakeUp();  // Lay out the final (snapped) offset
 
     // Snap to nearest row position if within threshold
     constexpr float SNAP_THRESHOLD = 3.0f;  // Game units
@@ -364,8 +368,8 @@ void RowGridProjectileDriver::Update(float deltaTime) {
 }
 
 void RowGridProjectileDriver::UpdateLayout(float deltaTime) {
-    // THREAD SAFETY: Copy children before iterating
-    auto children = GetChildrenMutable();  // Copy, not reference
+    // Iterate in place - layout only positions children, it never adds or removes them
+    const auto& children = GetChildren();
     size_t totalItems = children.size();
 
     if (totalItems == 0) {
@@ -541,12 +545,12 @@ void RowGridProjectileDriver::UpdateLayout(float deltaTime) {
 
         // Set visibility
         if (shouldBeVisible) {
-            child->SetVisible(true);
+            SetChildVisible(*child, true);
             if (isValidProjectile) {
                 child->SetLocalScale(1.0f);
             }
         } else {
-            child->SetVisible(false);
+            SetChildVisible(*child, false);
             if (isValidProjectile) {
                 child->SetLocalScale(0.0f);
             }
@@ -36,16 +36,16 @@ public:
     // === Layout Configuration ===
 
     // Distance between columns in the X direction (horizontal spacing)
-    void SetColumnSpacing(float spacing) { m_columnSpacing = spacing; }
+    void SetColumnSpacing(float spacing) { m_columnSpacing = spacing; WakeUp(); }
     float GetColumnSpacing() const { return m_columnSpacing; }
 
     // Distance between rows in the Z direction (vertical spacing)
-    void SetRowSpacing(float spacing) { m_rowSpacing = spacing; }
+    void SetRowSpacing(float spacing) { m_rowSpacing = spacing; WakeUp(); }
     float GetRowSpacing() const { return m_rowSpacing; }
 
     // Number of columns per row (default 1)
     // Items wrap to next row after this many columns
-    void SetNumColumns(size_t numColumns) { m_numColumns = std::max<size_t>(1, numColumns); }
+    void SetNumColumns(size_t numColumns) { m_numColumns = std::max<size_t>(1, numColumns); WakeUp(); }
     size_t GetNumColumns() const { return m_numColumns; }
 
     // === Fill Direction Configuration ===
@@ -70,7 +70,7 @@ public:
 
     // Visible height in game units (default 50)
     // Items within [-height/2, +height/2] are visible
-    void SetVisibleHeight(float height) { m_visibleHeight = height; }
+    void SetVisibleHeight(float height) { m_visibleHeight = height; WakeUp(); }
     float GetVisibleHeight() const { return m_visibleHeight; }
 
     // Scroll sensitivity: how much Z offset per unit of hand movement
@@ -98,6 +98,9 @@ public:
 
 protected:
     void UpdateLayout(float deltaTime) override;
+    // Hand-driven scrolling moves the layout in Update(), so only run it early when idle
+    bool IsLayoutParallelSafe() const override { return !m_isScrolling; }
+    bool IsLayoutIdle() const override { return !m_isScrolling; }
 
     // Override to intercept non-anchor grabs for scrolling
     bool OnEvent(InputEvent& event) override;
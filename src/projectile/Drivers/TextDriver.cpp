@@ -14,6 +14,48 @@
 
 namespace Projectile {
 
+namespace {
+    // Tooltips and labels cycle through a limited set of strings
+    constexpr size_t LAYOUT_CACHE_CAPACITY = 256;
+
+    // Smallest step the character node pool grows by
+    constexpr size_t MIN_POOL_GROWTH = 16;
+
+    TextLayoutCache& GetLayoutCache() {
+        static TextLayoutCache s_cache(&TextAssets::GetFonts(), LAYOUT_CACHE_CAPACITY);
+        return s_cache;
+    }
+
+    // Font atlases are shared by every text element - each is pinned on first use so it's
+    // never evicted. Main thread only.
+    InternedString GetFontAtlas(FontId font) {
+        static std::vector<InternedString> s_atlases;
+        if (font >= s_atlases.size()) {
+            s_atlases.resize(font + 1);
+        }
+        if (s_atlases[font].empty()) {
+            const auto& fonts = TextAssets::GetFonts();
+            s_atlases[font] = font < fonts.GetFontCount()
+                ? InternedString(fonts.GetFont(font).atlasPath)
+                : InternedString(TextAssets::TEXT_ATLAS_PATH);
+            AsyncTextureLoader::GetInstance().PinTexture(s_atlases[font]);
+        }
+        return s_atlases[font];
+    }
+
+    // Request the atlas if it isn't loaded yet
+    bool IsFontAtlasReady(FontId font) {
+        InternedString atlas = GetFontAtlas(font);
+        auto& asyncLoader = AsyncTextureLoader::GetInstance();
+        if (asyncLoader.IsTextureReady(atlas)) {
+            return true;
+        }
+        asyncLoader.RequestTexture(atlas, nullptr);
+        spdlog::trace("TextDriver::UpdateLayout - Waiting for texture '{}' to load", atlas.c_str());
+        return false;
+    }
+}
+
 // =============================================================================
 // Construction
 // =============================================================================
@@ -23,7 +65,7 @@ TextDriver::TextDriver() {
 }
 
 TextDriver::~TextDriver() {
-    CleanupClonedNodes();
+    DetachNodePool(true);
 }
 
 // =============================================================================
@@ -37,7 +79,6 @@ void TextDriver::SetText(const std::wstring& text) {
 
     m_text = text;
     MarkDirty();
-    m_boundsValid = false;
     m_uvsApplied = false;
 
     std::string narrowText;
@@ -61,7 +102,6 @@ void TextDriver::SetTextScale(float scale) {
     if (m_textScale != scale) {
         m_textScale = scale;
         MarkDirty();
-        m_boundsValid = false;
     }
 }
 
@@ -69,7 +109,18 @@ void TextDriver::SetAlignment(TextAlignment align) {
     if (m_alignment != align) {
         m_alignment = align;
         MarkDirty();
-        m_boundsValid = false;
+    }
+}
+
+void TextDriver::SetFont(std::string_view name) {
+    FontId font = TextAssets::GetFonts().FindFont(name);
+    if (font == FontRegistry::INVALID_FONT) {
+        spdlog::warn("TextDriver::SetFont - Unknown font '{}', using the main font", name);
+        font = TextAssets::MAIN_FONT;
+    }
+    if (m_font != font) {
+        m_font = font;
+        MarkDirty();
     }
 }
 
@@ -79,65 +130,7 @@ void TextDriver::SetAlignment(TextAlignment align) {
 // =============================================================================
 
 TextBounds TextDriver::GetBounds() const {
-    if (m_boundsValid) {
-        return m_cachedBounds;
-    }
-
-    m_cachedBounds = TextBounds{};
-
-    if (m_layout.empty()) {
-        m_boundsValid = true;
-        return m_cachedBounds;
-    }
-
-    float minX = 0.0f;
-    float maxX = 0.0f;
-    float minY = 0.0f;
-    float maxY = 0.0f;
-    bool foundFirst = false;
-
-    float letterDistance = GetLetterDistance();
-    float charHeight = GetCharacterHeight();
-
-    for (const auto& charLayout : m_layout) {
-        if (!charLayout.visible) {
-            continue;
-        }
-
-        // Use per-character width from CSV (xOffset is left edge)
-        float charWidth = letterDistance * charLayout.widthRatio;
-        float charLeft = charLayout.xOffset;
-        float charRight = charLayout.xOffset + charWidth;
-
-        // Y bounds: character's yOffset plus half char height above/below
-        float charTop = charLayout.yOffset + charHeight * 0.5f;
-        float charBottom = charLayout.yOffset - charHeight * 0.5f;
-
-        if (!foundFirst) {
-            minX = charLeft;
-            maxX = charRight;
-            minY = charBottom;
-            maxY = charTop;
-            foundFirst = true;
-        } else {
-            minX = std::min(minX, charLeft);
-            maxX = std::max(maxX, charRight);
-            minY = std::min(minY, charBottom);
-            maxY = std::max(maxY, charTop);
-        }
-    }
-
-    if (foundFirst) {
-        m_cachedBounds.minX = minX;
-        m_cachedBounds.maxX = maxX;
-        m_cachedBounds.width = maxX - minX;
-        m_cachedBounds.minY = minY;
-        m_cachedBounds.maxY = maxY;
-        m_cachedBounds.height = maxY - minY;
-    }
-
-    m_boundsValid = true;
-    return m_cachedBounds;
+    return m_layout ? m_layout->bounds : TextBounds{};
 }
 
 float TextDriver::GetCharacterHeight() const {
@@ -150,6 +143,10 @@ float TextDriver::GetLetterDistance() const {
     return TextAssets::BASE_LETTER_DISTANCE;
 }
 
+TextLayoutCache::Stats TextDriver::GetLayoutCacheStats() {
+    return GetLayoutCache().GetStats();
+}
+
 // =============================================================================
 // Driver Overrides
 // =============================================================================
@@ -160,11 +157,11 @@ void TextDriver::Initialize() {
 }
 
 void TextDriver::SetVisible(bool visible) {
-    // Clean up cloned nodes when hiding - this is safer than cleaning on show
-    // because the renderer will have stopped referencing them by next frame
-    if (!visible && !m_clonedNodes.empty()) {
-        CleanupClonedNodes();
-        m_dirty = true;  // Force re-clone when shown again
+    // Detach pooled nodes when hiding, before our projectile unbinds and its 3D goes away.
+    // They're kept (with their materials) and reattached to the next 3D on show.
+    if (!visible) {
+        DetachNodePool(false);
+        m_dirty = true;  // Rewrite every node when shown again
     }
 
     // Base class propagates visibility to children (including m_textProjectile)
@@ -176,8 +173,8 @@ void TextDriver::SetVisible(bool visible) {
 }
 
 void TextDriver::Clear() {
-    // Clean up cloned nodes before clearing
-    CleanupClonedNodes();
+    // Release pooled nodes before clearing
+    DetachNodePool(true);
 
     // Reset cached pointer - base class will destroy the actual projectile
     m_textProjectile = nullptr;
@@ -188,11 +185,9 @@ void TextDriver::Clear() {
 
 void TextDriver::OnParentHide() {
     // The game projectile's 3D nodes will be destroyed when it unbinds.
-    // Mark dirty so UpdateCharacterNodes() recreates clones when shown again,
+    // Mark dirty so UpdateCharacterNodes() reattaches the pool when shown again,
     // even if SetText() is called with the same text (which early-returns).
-    if (!m_clonedNodes.empty()) {
-        CleanupClonedNodes();
-    }
+    DetachNodePool(false);
     m_dirty = true;
     m_uvsApplied = false;
 
@@ -208,17 +203,22 @@ void TextDriver::UpdateLayout(float deltaTime) {
     EnsureProjectile();
 
     if (m_dirty || !m_uvsApplied) {
-        // Defer character setup until texture is fully loaded
+        // Cached for strings seen before - tooltips and labels mostly are
+        auto layout = GetLayoutCache().Get(m_text, GetLayoutParams());
+
+        // Defer character setup until every atlas the text uses is fully loaded
         // This avoids race conditions with async texture callbacks
-        auto& asyncLoader = AsyncTextureLoader::GetInstance();
-        if (!asyncLoader.IsTextureReady(TextAssets::TEXT_ATLAS_PATH)) {
-            // Request preload if not already loading, then wait for next frame
-            asyncLoader.RequestTexture(TextAssets::TEXT_ATLAS_PATH, nullptr);
-            spdlog::trace("TextDriver::UpdateLayout - Waiting for texture '{}' to load",
-                TextAssets::TEXT_ATLAS_PATH);
+        // The NIF's own nodes are always textured with the main atlas
+        if (!IsFontAtlasReady(TextAssets::MAIN_FONT)) {
             return;
         }
+        for (FontId font : layout->fonts) {
+            if (!IsFontAtlasReady(font)) {
+                return;
+            }
+        }
 
+        m_layout = std::move(layout);
         bool success = UpdateCharacterNodes();
         if (success) {
             m_dirty = false;
@@ -264,104 +264,56 @@ void TextDriver::EnsureProjectile() {
     MarkDirty();
 }
 
-std::vector<TextDriver::CharOffset> TextDriver::ComputeCharacterOffsets() const {
-    std::vector<CharOffset> offsets;
-    if (m_text.empty()) {
-        return offsets;
-    }
-
-    float letterDistance = GetLetterDistance();
-    float lineHeight = GetCharacterHeight() * m_lineSpacing;
+TextLayoutParams TextDriver::GetLayoutParams() const {
+    TextLayoutParams params;
+    params.alignment = m_alignment;
+    params.lineSpacing = m_lineSpacing;
+    params.letterDistance = GetLetterDistance();
+    params.characterHeight = GetCharacterHeight();
+    params.font = m_font;
+    return params;
+}
 
-    // Split text into lines by \n
-    std::vector<std::wstring> lines;
-    std::wstring currentLine;
-    for (wchar_t ch : m_text) {
-        if (ch == L'\n') {
-            lines.push_back(currentLine);
-            currentLine.clear();
-        } else {
-            currentLine += ch;
-        }
+void TextDriver::ResetNodeStates() {
+    // Pooled nodes keep their material, and so their font, wherever they're attached next;
+    // the NIF's own nodes are textured with the main atlas again
+    m_nodeStates.resize((std::min)(m_nodeStates.size(), m_originalNodeCount + m_nodePool.size()));
+    for (size_t i = 0; i < m_nodeStates.size(); ++i) {
+        GlyphNodeState reset;
+        reset.font = i >= m_originalNodeCount ? m_nodeStates[i].font : TextAssets::MAIN_FONT;
+        m_nodeStates[i] = reset;
     }
-    lines.push_back(currentLine);  // Don't forget the last line
-
-    // Process each line
-    int lineIndex = 0;
-    for (const auto& line : lines) {
-        float yOffset = -lineIndex * lineHeight;  // Negative because subsequent lines go down
-
-        // Compute x offsets for this line (same logic as before, but per-line)
-        std::vector<float> rawPositions;
-        float currentX = 0.0f;
-        float firstPosX = 0.0f;
-        float lastPosX = 0.0f;
-        bool foundFirst = false;
-
-        for (wchar_t ch : line) {
-            float widthRatio = TextAssets::GetWidthRatio(ch);
-
-            // Spaces/tabs add to position but don't render
-            if (ch == L' ' || ch == L'\t' || ch == L'\u00A0') {
-                currentX += letterDistance * (widthRatio + TextAssets::CHAR_GAP);
-                continue;
-            }
-
-            float posX = currentX;
-            rawPositions.push_back(posX);
-
-            if (!foundFirst) {
-                firstPosX = posX;
-                foundFirst = true;
-            }
-            lastPosX = posX;
-
-            currentX += letterDistance * (widthRatio + TextAssets::CHAR_GAP);
-        }
-
-        // Apply alignment for this line
-        float alignOffset = 0.0f;
-        if (foundFirst) {
-            float centerOffset = (firstPosX + lastPosX) / -2.0f;
-            float totalWidth = lastPosX - firstPosX;
-            switch (m_alignment) {
-                case TextAlignment::Left:
-                    alignOffset = totalWidth / 2.0f + centerOffset;
-                    break;
-                case TextAlignment::Right:
-                    alignOffset = -totalWidth / 2.0f + centerOffset;
-                    break;
-                case TextAlignment::Center:
-                default:
-                    alignOffset = centerOffset;
-                    break;
-            }
-        }
+}
 
-        // Add offsets for this line's characters
-        for (float pos : rawPositions) {
-            offsets.push_back({pos + alignOffset, yOffset});
-        }
+void TextDriver::DetachNodePool(bool release) {
+    // Whatever 3D the nodes are in next is written from scratch
+    ResetNodeStates();
+    auto* poolContainer = m_poolContainer;
+    m_poolContainer = nullptr;
 
-        ++lineIndex;
+    if (m_nodePool.empty()) {
+        return;
     }
 
-    return offsets;
-}
+    size_t nodeCount = m_nodePool.size();
+    auto dropPool = [this, nodeCount](const char* reason) {
+        spdlog::info("DetachNodePool - {}, dropping {} pooled node references", reason, nodeCount);
+        m_nodePool.clear();
+    };
 
-void TextDriver::CleanupClonedNodes() {
-    if (m_clonedNodes.empty()) {
+    if (!poolContainer) {
+        // Already detached - nothing in the scene references them
+        if (release) {
+            m_nodePool.clear();
+        }
         return;
     }
 
-    size_t nodeCount = m_clonedNodes.size();
-
     // Validate projectile exists before touching any nodes
     // The game's IO thread may be accessing these nodes - if projectile is invalid,
     // the nodes may already be freed or in an inconsistent state
     if (!m_textProjectile) {
-        spdlog::info("CleanupClonedNodes - No textProjectile, clearing {} node references", nodeCount);
-        m_clonedNodes.clear();
+        dropPool("No textProjectile");
         return;
     }
 
@@ -372,84 +324,66 @@ void TextDriver::CleanupClonedNodes() {
     // projectile, leaving us with a dangling pointer. IsProjectileValid() verifies
     // the refHandle still resolves to our projectile before we access it.
     if (!gameProj.IsProjectileValid()) {
-        spdlog::info("CleanupClonedNodes - Projectile invalid or destroyed by game, clearing {} node references without manipulation", nodeCount);
-        m_clonedNodes.clear();
+        dropPool("Projectile invalid or destroyed by game");
         return;
     }
 
     auto* proj = gameProj.GetProjectile();
     auto* projNode = proj->Get3D();
-    if (!projNode) {
-        spdlog::info("CleanupClonedNodes - Get3D() null, clearing {} node references", nodeCount);
-        m_clonedNodes.clear();
+    if (!projNode || projNode != m_nodesRoot) {
+        dropPool("3D gone or replaced");
+        return;
+    }
+
+    auto* container = TextureManipulator::GetCharacterContainer(projNode);
+    if (container != poolContainer) {
+        dropPool("Character container replaced");
         return;
     }
 
     // Projectile is valid - safe to manipulate nodes
-    // First hide all cloned nodes (detaching alone may not stop rendering immediately)
-    for (auto& clonedNode : m_clonedNodes) {
-        if (clonedNode) {
-            TextureManipulator::HideNodeByPosition(clonedNode.get());
-            TextureManipulator::HideCharacter(clonedNode.get());
-        }
+    // First hide all pooled nodes (detaching alone may not stop rendering immediately)
+    for (auto& pooledNode : m_nodePool) {
+        TextureManipulator::HideNodeByPosition(pooledNode.get());
+        TextureManipulator::HideCharacter(pooledNode.get());
     }
 
-    // Then detach from container
-    // NiPointer ensures nodes stay alive until we clear() below
-    auto* container = TextureManipulator::GetCharacterContainer(projNode);
-    if (container) {
-        for (auto& clonedNode : m_clonedNodes) {
-            if (clonedNode) {
-                container->DetachChild2(clonedNode.get());
-            }
-        }
+    // Then detach from container - NiPointer keeps them alive (and their materials) for the next show
+    for (auto& pooledNode : m_nodePool) {
+        container->DetachChild2(pooledNode.get());
     }
 
-    spdlog::info("CleanupClonedNodes - Cleaned up {} cloned nodes", nodeCount);
-    // Nodes are destroyed here when NiPointer releases its reference
-    m_clonedNodes.clear();
+    if (release) {
+        spdlog::info("DetachNodePool - Released {} pooled nodes", nodeCount);
+        m_nodePool.clear();
+    } else {
+        spdlog::trace("DetachNodePool - Detached {} pooled nodes", nodeCount);
+    }
 }
 
 bool TextDriver::UpdateCharacterNodes() {
-    m_layout.clear();
-    m_boundsValid = false;
-
     if (!m_textProjectile) {
-        CleanupClonedNodes();
-        return true;
-    }
-
-    // Hide all character nodes (including template) when text is empty
-    if (m_text.empty()) {
-        CleanupClonedNodes();
-        auto& gameProj = m_textProjectile->GetGameProjectile();
-        if (gameProj.IsProjectileValid()) {
-            if (auto* proj = gameProj.GetProjectile()) {
-                if (auto* projNode = proj->Get3D()) {
-                    auto charNodes = TextureManipulator::GetAllCharNodes(projNode);
-                    for (auto* node : charNodes) {
-                        TextureManipulator::HideNodeByPosition(node);
-                        TextureManipulator::HideCharacter(node);
-                    }
-                }
-            }
-        }
+        DetachNodePool(true);
+        m_layout.reset();
         return true;
     }
 
     auto& gameProj = m_textProjectile->GetGameProjectile();
     if (!gameProj.IsProjectileValid()) {
         spdlog::trace("TextDriver::UpdateCharacterNodes - Projectile no longer valid");
-        return false;
+        return m_text.empty();
     }
     auto* proj = gameProj.GetProjectile();
     if (!proj) {
         spdlog::trace("TextDriver::UpdateCharacterNodes - No projectile yet");
-        return false;
+        return m_text.empty();
     }
 
     auto* projNode = proj->Get3D();
     if (!projNode) {
+        if (m_text.empty()) {
+            return true;
+        }
         static int s_noNodeCount = 0;
         if (++s_noNodeCount <= 3 || s_noNodeCount % 60 == 0) {
             spdlog::warn("TextDriver::UpdateCharacterNodes - No 3D node (attempt {}). "
@@ -458,128 +392,117 @@ bool TextDriver::UpdateCharacterNodes() {
         return false;
     }
 
-    // Get the container node for attaching clones
+    // New 3D while the pool was still attached to the old one: we missed the hide, so the
+    // pooled nodes may still point at a freed parent
+    if (projNode != m_nodesRoot && m_poolContainer) {
+        spdlog::info("TextDriver::UpdateCharacterNodes - 3D replaced, dropping {} pooled nodes", m_nodePool.size());
+        m_poolContainer = nullptr;
+        m_nodePool.clear();
+        m_nodeStates.clear();
+    }
+    m_nodesRoot = projNode;
+
+    // Get the container node for attaching pooled nodes
     auto* container = TextureManipulator::GetCharacterContainer(projNode);
     if (!container) {
         spdlog::warn("TextDriver::UpdateCharacterNodes - No character container found");
         return false;
     }
 
+    if (!m_poolContainer) {
+        // Fresh 3D: texture the NIF's own nodes (each node has its own material), then
+        // attach the pool. Pooled nodes kept their material (and its font atlas) from before.
+        // TextureManipulator::SetTexture caches the loaded texture internally
+        auto originalNodes = TextureManipulator::GetAllCharNodes(projNode);
+        if (originalNodes.empty()) {
+            spdlog::warn("TextDriver::UpdateCharacterNodes - No geometry children in mesh");
+            return false;
+        }
 
-    // Get existing character nodes
-    auto charNodes = TextureManipulator::GetAllCharNodes(projNode);
-    if (charNodes.empty()) {
-        spdlog::warn("TextDriver::UpdateCharacterNodes - No geometry children in mesh");
-        return false;
-    }
-
-    // Store original node count on first call (before any cloning)
-    if (m_originalNodeCount == 0) {
-        m_originalNodeCount = charNodes.size();
-        spdlog::info("TextDriver::UpdateCharacterNodes - Original node count: {}", m_originalNodeCount);
-    }
+        // Store original node count on first call (before any cloning)
+        if (m_originalNodeCount == 0) {
+            m_originalNodeCount = originalNodes.size();
+            spdlog::info("TextDriver::UpdateCharacterNodes - Original node count: {}", m_originalNodeCount);
+        }
 
-    // Count how many visible characters we need (excluding whitespace and newlines)
-    size_t visibleCharCount = 0;
-    for (wchar_t ch : m_text) {
-        if (ch != L' ' && ch != L'\t' && ch != L'\u00A0' && ch != L'\n') {
-            ++visibleCharCount;
+        for (auto* node : originalNodes) {
+            TextureManipulator::SetTexture(node, TextAssets::TEXT_ATLAS_PATH);
+        }
+        for (auto& pooledNode : m_nodePool) {
+            container->AttachChild(pooledNode.get(), false);
         }
+        m_poolContainer = container;
+        ResetNodeStates();
     }
 
-    // Clean up old clones first if text changed
-    CleanupClonedNodes();
-
-    // Re-get nodes after cleanup (in case cloned nodes were removed)
-    charNodes = TextureManipulator::GetAllCharNodes(projNode);
-
-    // Use the first node as template for cloning
-    RE::NiAVObject* templateNode = charNodes.empty() ? nullptr : charNodes[0];
-    if (!templateNode) {
-        spdlog::error("TextDriver::UpdateCharacterNodes - No template node available");
+    // Original NIF nodes first, then the pool in attach order
+    auto charNodes = TextureManipulator::GetAllCharNodes(projNode);
+    if (charNodes.empty()) {
+        spdlog::warn("TextDriver::UpdateCharacterNodes - No geometry children in mesh");
         return false;
     }
 
-    // Clone additional nodes if we need more than we have
+    // Grow the pool geometrically (at least doubling it) if we need more nodes than we have,
+    // so growing text clones rarely and shows after the first never clone at all
+    size_t glyphCount = m_layout->glyphs.size();
     size_t currentNodeCount = charNodes.size();
-    if (visibleCharCount > currentNodeCount) {
-        size_t needToClone = visibleCharCount - currentNodeCount;
-        spdlog::info("TextDriver::UpdateCharacterNodes - Cloning {} additional nodes (have {}, need {})",
-            needToClone, currentNodeCount, visibleCharCount);
-
+    m_nodeStates.resize(currentNodeCount);  // Drop states of pooled nodes that were released
+    if (glyphCount > currentNodeCount) {
+        size_t needToClone = (std::max)({glyphCount - currentNodeCount, m_nodePool.size(), MIN_POOL_GROWTH});
+        spdlog::info("TextDriver::UpdateCharacterNodes - Growing node pool by {} (have {}, need {})",
+            needToClone, currentNodeCount, glyphCount);
+
+        // Use the first node as template for cloning
+        RE::NiAVObject* templateNode = charNodes[0];
         for (size_t i = 0; i < needToClone; ++i) {
             auto* clonedNode = TextureManipulator::CloneCharacterNode(templateNode, container);
-            if (clonedNode) {
-                m_clonedNodes.push_back(RE::NiPointer<RE::NiAVObject>(clonedNode));
-                charNodes.push_back(clonedNode);
-            } else {
+            if (!clonedNode) {
                 spdlog::error("TextDriver::UpdateCharacterNodes - Failed to clone node {}", i);
                 break;
             }
+            // Clones share the template's material until SetTexture gives them their own
+            TextureManipulator::SetTexture(clonedNode, TextAssets::TEXT_ATLAS_PATH);
+            m_nodePool.push_back(RE::NiPointer<RE::NiAVObject>(clonedNode));
+            charNodes.push_back(clonedNode);
         }
     }
 
-    std::vector<CharOffset> offsets = ComputeCharacterOffsets();
-
-    // Hide all nodes and set texture on each (each node has its own material)
-    for (auto* node : charNodes) {
-        TextureManipulator::HideNodeByPosition(node);
-        TextureManipulator::HideCharacter(node);
-    }
-
-    // Set the font atlas texture on all nodes
-    // TextureManipulator::SetTexture caches the loaded texture internally
-    for (auto* node : charNodes) {
-        TextureManipulator::SetTexture(node, TextAssets::TEXT_ATLAS_PATH);
-    }
+    // New clones start with the main atlas
+    m_nodeStates.resize(charNodes.size());
 
-    size_t nodeIndex = 0;
-    size_t offsetIndex = 0;
+    // Only rewrite nodes whose glyph, position, visibility or font changed
+    m_nodeUpdates.clear();
+    PlanGlyphNodeUpdates(*m_layout, m_nodeStates, m_nodeUpdates);
 
-    for (size_t i = 0; i < m_text.length() && nodeIndex < charNodes.size(); ++i) {
-        wchar_t ch = m_text[i];
+    const auto& fonts = TextAssets::GetFonts();
+    for (const auto& update : m_nodeUpdates) {
+        auto* node = charNodes[update.node];
+        const auto& state = m_nodeStates[update.node];
 
-        // Skip whitespace and newlines (they don't get rendered)
-        if (ch == L' ' || ch == L'\t' || ch == L'\u00A0' || ch == L'\n') {
+        if (update.ops & GlyphNodeUpdate::Hide) {
+            TextureManipulator::HideNodeByPosition(node);
+            TextureManipulator::HideCharacter(node);
             continue;
         }
-
-        CharacterLayout layout;
-        layout.ch = ch;
-        layout.widthRatio = TextAssets::GetWidthRatio(ch);
-        layout.visible = false;
-        layout.xOffset = 0.0f;
-        layout.yOffset = 0.0f;
-
-        const TextAssets::UVCoord* uvCoord = TextAssets::GetCharUV(ch);
-        if (uvCoord) {
-            layout.uv = *uvCoord;
-            layout.visible = true;
-        } else {
-            spdlog::trace("TextDriver::UpdateCharacterNodes - Char '{}' (U+{:04X}) not in atlas",
-                static_cast<char>(ch <= 127 ? ch : '?'), static_cast<int>(ch));
+        if (update.ops & GlyphNodeUpdate::Show) {
+            TextureManipulator::ShowNodeByPosition(node);
         }
-
-        if (offsetIndex < offsets.size()) {
-            layout.xOffset = offsets[offsetIndex].x;
-            layout.yOffset = offsets[offsetIndex].y;
-            ++offsetIndex;
+        if (update.ops & GlyphNodeUpdate::Move) {
+            TextureManipulator::SetNodeLocalX(node, state.x);
+            TextureManipulator::SetNodeLocalZ(node, state.y);
         }
-
-        auto* node = charNodes[nodeIndex];
-        if (node && layout.visible) {
-            TextureManipulator::ShowNodeByPosition(node);
-            TextureManipulator::SetNodeLocalX(node, layout.xOffset);
-            TextureManipulator::SetNodeLocalZ(node, layout.yOffset);
-            TextureManipulator::SetCharUV(node, layout.uv);
+        if (update.ops & GlyphNodeUpdate::SetFont) {
+            TextureManipulator::SetTexture(node, GetFontAtlas(state.font).c_str());
+        }
+        if (update.ops & GlyphNodeUpdate::SetUV) {
+            // Visible glyphs only come from registered fonts
+            const auto& metrics = fonts.GetFont(state.font).metrics;
+            TextureManipulator::SetCharUV(node, state.uv, metrics.GetAtlasCols(), metrics.GetAtlasRows());
         }
-
-        m_layout.push_back(layout);
-        ++nodeIndex;
     }
 
-    spdlog::trace("TextDriver::UpdateCharacterNodes - Set up {} characters ({} cloned nodes)",
-        m_layout.size(), m_clonedNodes.size());
+    spdlog::trace("TextDriver::UpdateCharacterNodes - {} characters, {} of {} nodes rewritten ({} pooled nodes)",
+        glyphCount, m_nodeUpdates.size(), charNodes.size(), m_nodePool.size());
     return true;
 }
 
@@ -1,40 +1,14 @@
 #pragma once
 
 #include "../ProjectileDriver.h"
-#include "../TextAssets.h"
+#include "../TextLayout.h"
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Projectile {
 
-// =============================================================================
-// TextBounds
-// Represents the bounding box of rendered text in driver local space
-// =============================================================================
-struct TextBounds {
-    float minX = 0.0f;
-    float maxX = 0.0f;
-    float minY = 0.0f;
-    float maxY = 0.0f;
-    float width = 0.0f;
-    float height = 0.0f;
-
-    RE::NiPoint3 GetCenter() const {
-        return RE::NiPoint3((minX + maxX) * 0.5f, (minY + maxY) * 0.5f, 0.0f);
-    }
-
-    bool IsEmpty() const { return width <= 0.0f; }
-};
-
-// =============================================================================
-// TextAlignment
-// =============================================================================
-enum class TextAlignment {
-    Left,
-    Center,
-    Right
-};
-
 // =============================================================================
 // TextDriver
 // Renders text using a projectile with multiple character geometry nodes.
@@ -68,14 +42,23 @@ public:
     void SetLineSpacing(float spacing) { m_lineSpacing = spacing; MarkDirty(); }
     float GetLineSpacing() const { return m_lineSpacing; }
 
+    // Font by registry name (see TextAssets::GetFonts); unknown names use the main font.
+    // Characters the font lacks come from its fallbacks.
+    void SetFont(std::string_view name);
+    FontId GetFont() const { return m_font; }
+
     // =========================================================================
     // Bounds
     // =========================================================================
 
+    // Bounds of the text as last applied to the character nodes
     TextBounds GetBounds() const;
     float GetCharacterHeight() const;
     float GetLetterDistance() const;
 
+    // Layouts are shared by all text drivers through one cache
+    static TextLayoutCache::Stats GetLayoutCacheStats();
+
     // =========================================================================
     // ProjectileDriver Overrides
     // =========================================================================
@@ -87,47 +70,44 @@ public:
 
 protected:
     void UpdateLayout(float deltaTime) override;
+    // A rewrite waits for the text projectile's 3D, retried every frame until it applies
+    bool IsLayoutIdle() const override { return !m_dirty && m_uvsApplied; }
 
 private:
-    struct CharOffset {
-        float x;
-        float y;
-    };
-
     void EnsureProjectile();
-    std::vector<CharOffset> ComputeCharacterOffsets() const;
+    TextLayoutParams GetLayoutParams() const;
     bool UpdateCharacterNodes();
-    void CleanupClonedNodes();
-    void MarkDirty() { m_dirty = true; }
+    // Mark every node for a full rewrite, keeping the font pooled nodes' materials show
+    void ResetNodeStates();
+    // Hide and detach pooled nodes from the current 3D; release=true also drops them
+    void DetachNodePool(bool release);
+    void MarkDirty() { m_dirty = true; WakeUp(); }
 
     std::wstring m_text;
 
     float m_textScale = 1.0f;
     float m_lineSpacing = 1.2f;  // Multiplier of character height between lines
     TextAlignment m_alignment = TextAlignment::Center;
+    FontId m_font = TextAssets::MAIN_FONT;
 
-    struct CharacterLayout {
-        wchar_t ch;
-        float xOffset;
-        float yOffset;
-        float widthRatio;
-        TextAssets::UVCoord uv;
-        bool visible;
-    };
-    std::vector<CharacterLayout> m_layout;
+    // Layout currently applied to the character nodes (shared with the layout cache)
+    std::shared_ptr<const TextLayout> m_layout;
 
-    mutable TextBounds m_cachedBounds;
-    mutable bool m_boundsValid = false;
+    // What each character node shows, so a text change only rewrites the glyphs that
+    // differ. Reset (see ResetNodeStates) whenever the nodes may have been recreated.
+    std::vector<GlyphNodeState> m_nodeStates;
+    std::vector<GlyphNodeUpdate> m_nodeUpdates;  // Scratch, reused across updates
+    RE::NiAVObject* m_nodesRoot = nullptr;       // Projectile 3D that m_nodeStates describe
 
     bool m_dirty = true;
     bool m_uvsApplied = false;
 
     ControlledProjectile* m_textProjectile = nullptr;  // Owned by m_children, cached for direct access
 
-    // Track cloned character nodes for cleanup
-    // We keep the first node as template and clone additional nodes as needed
-    // Using NiPointer to prevent premature destruction while we hold references
-    std::vector<RE::NiPointer<RE::NiAVObject>> m_clonedNodes;
+    // Pool of cloned character nodes, beyond the NIF's own, kept across hide/show: detached
+    // from the 3D on hide (NiPointer keeps them alive) and reattached to the next one on show
+    std::vector<RE::NiPointer<RE::NiAVObject>> m_nodePool;
+    RE::NiNode* m_poolContainer = nullptr;  // Container the pool is attached to, null while detached
     size_t m_originalNodeCount = 0;  // Number of nodes that were in the NIF originally
 };
 
@@ -0,0 +1,277 @@
+#include "FontRegistry.h"
+
+#include <algorithm>
+#include <fstream>
+#include <istream>
+
+namespace Projectile {
+
+namespace {
+    // Split one CSV line on commas (manifest and kerning files have no quoted fields)
+    std::vector<std::string> SplitCSVLine(const std::string& line, char separator = ',') {
+        std::vector<std::string> fields(1);
+        for (char c : line) {
+            if (c == separator) {
+                fields.emplace_back();
+            } else if (c != '\r') {
+                fields.back() += c;
+            }
+        }
+        for (auto& field : fields) {
+            size_t first = field.find_first_not_of(" \t");
+            size_t last = field.find_last_not_of(" \t");
+            field = first == std::string::npos ? std::string() : field.substr(first, last - first + 1);
+        }
+        return fields;
+    }
+
+    // "U+XXXX" -> codepoint, 0 if malformed
+    uint32_t ParseUnicode(const std::string& field) {
+        if (field.size() < 6 || field[0] != 'U' || field[1] != '+') {
+            return 0;
+        }
+        try {
+            return static_cast<uint32_t>(std::stoul(field.substr(2), nullptr, 16));
+        } catch (...) {
+            return 0;
+        }
+    }
+
+    uint64_t MakeFontKey(FontId font, uint32_t codepoint) {
+        return (static_cast<uint64_t>(font) << 32) | codepoint;
+    }
+}
+
+// =============================================================================
+// KerningTable
+// =============================================================================
+
+KerningTable::KerningTable(std::vector<Pair> pairs) {
+    m_pairs.reserve(pairs.size());
+    for (const auto& pair : pairs) {
+        m_pairs.push_back({MakeKey(pair.left, pair.right), pair.adjust});
+    }
+    // Stable, so the last of equal keys stays last - keep it
+    std::stable_sort(m_pairs.begin(), m_pairs.end(),
+        [](const Entry& a, const Entry& b) { return a.key < b.key; });
+    auto last = std::unique(m_pairs.rbegin(), m_pairs.rend(),
+        [](const Entry& a, const Entry& b) { return a.key == b.key; });
+    m_pairs.erase(m_pairs.begin(), last.base());
+}
+
+std::optional<KerningTable> KerningTable::ParseCSV(std::istream& in) {
+    std::string line;
+    // Skip header line
+    if (!std::getline(in, line)) {
+        return std::nullopt;
+    }
+
+    std::vector<Pair> pairs;
+    while (std::getline(in, line)) {
+        // Left,Right,Adjust
+        auto fields = SplitCSVLine(line);
+        if (fields.size() < 3 || fields[2].empty()) {
+            continue;
+        }
+
+        Pair pair;
+        pair.left = ParseUnicode(fields[0]);
+        pair.right = ParseUnicode(fields[1]);
+        if (pair.left == 0 || pair.right == 0) {
+            continue;
+        }
+        try {
+            pair.adjust = std::stof(fields[2]);
+            pairs.push_back(pair);
+        } catch (...) {
+            // Skip invalid lines
+        }
+    }
+
+    return KerningTable(std::move(pairs));
+}
+
+float KerningTable::Get(uint32_t left, uint32_t right) const {
+    if (m_pairs.empty()) {
+        return 0.0f;
+    }
+    uint64_t key = MakeKey(left, right);
+    auto it = std::lower_bound(m_pairs.begin(), m_pairs.end(), key,
+        [](const Entry& entry, uint64_t value) { return entry.key < value; });
+    return it != m_pairs.end() && it->key == key ? it->adjust : 0.0f;
+}
+
+// =============================================================================
+// Registration
+// =============================================================================
+
+FontId FontRegistry::AddFont(std::string name, std::string atlasPath, GlyphMetricsTable metrics,
+                             KerningTable kerning)
+{
+    if (FontId existing = FindFont(name); existing != INVALID_FONT) {
+        return existing;
+    }
+
+    auto font = std::make_unique<Font>();
+    font->name = std::move(name);
+    font->atlasPath = std::move(atlasPath);
+    font->metrics = std::move(metrics);
+    font->kerning = std::move(kerning);
+    m_fonts.push_back(std::move(font));
+    return static_cast<FontId>(m_fonts.size() - 1);
+}
+
+void FontRegistry::SetFallbacks(FontId font, std::vector<FontId> fallbacks) {
+    m_fonts[font]->fallbacks = std::move(fallbacks);
+
+    std::lock_guard lock(m_cacheMutex);
+    m_fallbackCache.clear();
+}
+
+FontId FontRegistry::FindFont(std::string_view name) const {
+    for (size_t i = 0; i < m_fonts.size(); ++i) {
+        if (m_fonts[i]->name == name) {
+            return static_cast<FontId>(i);
+        }
+    }
+    return INVALID_FONT;
+}
+
+// =============================================================================
+// Resolution
+// =============================================================================
+
+FontRegistry::ResolvedGlyph FontRegistry::Resolve(FontId font, uint32_t codepoint) const {
+    // Most characters are in the requested font - no lock
+    if (const auto* glyph = m_fonts[font]->metrics.Find(codepoint)) {
+        return {font, glyph};
+    }
+
+    uint64_t key = MakeFontKey(font, codepoint);
+    {
+        std::lock_guard lock(m_cacheMutex);
+        if (auto it = m_fallbackCache.find(key); it != m_fallbackCache.end()) {
+            return it->second;
+        }
+    }
+
+    ResolvedGlyph resolved = ResolveChain(font, codepoint);
+
+    std::lock_guard lock(m_cacheMutex);
+    m_fallbackCache.emplace(key, resolved);
+    return resolved;
+}
+
+FontRegistry::ResolvedGlyph FontRegistry::ResolveChain(FontId font, uint32_t codepoint) const {
+    // Depth-first through the fallbacks in order, each font visited once
+    std::vector<bool> visited(m_fonts.size(), false);
+    std::vector<FontId> pending{font};
+    while (!pending.empty()) {
+        FontId current = pending.back();
+        pending.pop_back();
+        if (visited[current]) {
+            continue;
+        }
+        visited[current] = true;
+
+        if (const auto* glyph = m_fonts[current]->metrics.Find(codepoint)) {
+            return {current, glyph};
+        }
+        const auto& fallbacks = m_fonts[current]->fallbacks;
+        for (auto it = fallbacks.rbegin(); it != fallbacks.rend(); ++it) {
+            if (*it < m_fonts.size() && !visited[*it]) {
+                pending.push_back(*it);
+            }
+        }
+    }
+    return {};
+}
+
+// =============================================================================
+// Manifest
+// =============================================================================
+
+std::vector<FontId> FontRegistry::LoadManifest(std::istream& manifest, const std::filesystem::path& baseDir,
+                                               std::vector<std::string>* errors)
+{
+    auto report = [errors](std::string message) {
+        if (errors) {
+            errors->push_back(std::move(message));
+        }
+    };
+
+    std::vector<FontId> added;
+    std::vector<std::pair<FontId, std::string>> fallbackLists;
+
+    std::string line;
+    // Skip header line
+    if (!std::getline(manifest, line)) {
+        return added;
+    }
+
+    // Register every font first so fallbacks can name fonts further down
+    while (std::getline(manifest, line)) {
+        // Name,Atlas,Metrics,Kerning,Fallbacks
+        auto fields = SplitCSVLine(line);
+        if (fields.size() < 3 || fields[0].empty()) {
+            continue;
+        }
+        fields.resize((std::max)(fields.size(), size_t(5)));
+        const std::string& name = fields[0];
+
+        if (FindFont(name) != INVALID_FONT) {
+            report("Font '" + name + "' is already registered");
+            continue;
+        }
+
+        std::filesystem::path metricsPath = baseDir / fields[2];
+        std::ifstream metricsFile(metricsPath, std::ios::binary);
+        if (!metricsFile.is_open()) {
+            report("Font '" + name + "': could not open metrics " + metricsPath.string());
+            continue;
+        }
+        auto metrics = metricsPath.extension() == ".bin"
+            ? GlyphMetricsTable::ReadBinary(metricsFile)
+            : GlyphMetricsTable::ParseCSV(metricsFile);
+        if (!metrics || metrics->IsEmpty()) {
+            report("Font '" + name + "': no glyphs in " + metricsPath.string());
+            continue;
+        }
+
+        KerningTable kerning;
+        if (!fields[3].empty()) {
+            std::filesystem::path kerningPath = baseDir / fields[3];
+            std::ifstream kerningFile(kerningPath);
+            auto parsed = KerningTable::ParseCSV(kerningFile);
+            if (parsed) {
+                kerning = std::move(*parsed);
+            } else {
+                report("Font '" + name + "': could not read kerning " + kerningPath.string());
+            }
+        }
+
+        FontId id = AddFont(name, fields[1], std::move(*metrics), std::move(kerning));
+        added.push_back(id);
+        fallbackLists.emplace_back(id, fields[4]);
+    }
+
+    for (const auto& [id, list] : fallbackLists) {
+        std::vector<FontId> fallbacks;
+        for (const auto& fallbackName : SplitCSVLine(list, ';')) {
+            if (fallbackName.empty()) {
+                continue;
+            }
+            FontId fallback = FindFont(fallbackName);
+            if (fallback == INVALID_FONT) {
+                report("Font '" + m_fonts[id]->name + "': unknown fallback '" + fallbackName + "'");
+                continue;
+            }
+            fallbacks.push_back(fallback);
+        }
+        SetFallbacks(id, std::move(fallbacks));
+    }
+
+    return added;
+}
+
+} // namespace Projectile
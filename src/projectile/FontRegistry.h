@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "GlyphMetricsTable.h"
+
+namespace Projectile {
+
+using FontId = uint16_t;
+
+// =============================================================================
+// KerningTable
+// Pair adjustments for one font, in cell-width ratio units (the same units as a glyph's
+// width ratio; negative pulls the right glyph closer). Sorted, binary searched.
+// =============================================================================
+class KerningTable {
+public:
+    struct Pair {
+        uint32_t left = 0;
+        uint32_t right = 0;
+        float adjust = 0.0f;
+    };
+
+    KerningTable() = default;
+
+    // Later pairs replace earlier ones
+    explicit KerningTable(std::vector<Pair> pairs);
+
+    // Kerning CSV: Left,Right,Adjust with characters as U+XXXX (header line first).
+    // nullopt if the stream has no header.
+    static std::optional<KerningTable> ParseCSV(std::istream& in);
+
+    // 0 for pairs without an entry
+    float Get(uint32_t left, uint32_t right) const;
+
+    size_t Size() const { return m_pairs.size(); }
+    bool Empty() const { return m_pairs.empty(); }
+
+private:
+    static uint64_t MakeKey(uint32_t left, uint32_t right) {
+        return (static_cast<uint64_t>(left) << 32) | right;
+    }
+
+    struct Entry {
+        uint64_t key;
+        float adjust;
+    };
+    std::vector<Entry> m_pairs;  // Sorted by key
+};
+
+// =============================================================================
+// FontRegistry
+// Text fonts: each is an atlas texture with its own glyph metrics, optional kerning and
+// an ordered fallback chain for characters its atlas lacks.
+//
+// Resolve() tries the font's own table first; characters that need the chain are
+// resolved once and cached per (font, character). Fonts are registered at load and
+// read-only afterwards (Resolve is thread-safe).
+// =============================================================================
+class FontRegistry {
+public:
+    static constexpr FontId INVALID_FONT = 0xFFFF;
+
+    struct Font {
+        std::string name;
+        std::string atlasPath;          // Game texture path
+        GlyphMetricsTable metrics;
+        KerningTable kerning;
+        std::vector<FontId> fallbacks;  // In resolve order
+    };
+
+    struct ResolvedGlyph {
+        FontId font = INVALID_FONT;     // Font whose atlas has the glyph
+        const GlyphMetricsTable::Glyph* glyph = nullptr;
+    };
+
+    FontRegistry() = default;
+    FontRegistry(const FontRegistry&) = delete;
+    FontRegistry& operator=(const FontRegistry&) = delete;
+
+    // Returns the new font's ID, or the existing one if name is taken (which is left as is)
+    FontId AddFont(std::string name, std::string atlasPath, GlyphMetricsTable metrics,
+                   KerningTable kerning = {});
+
+    // Replace font's fallback chain. Fallbacks are tried in order, each with its own chain
+    // after it; cycles and repeats are skipped.
+    void SetFallbacks(FontId font, std::vector<FontId> fallbacks);
+
+    // INVALID_FONT if unknown
+    FontId FindFont(std::string_view name) const;
+    const Font& GetFont(FontId font) const { return *m_fonts[font]; }
+    size_t GetFontCount() const { return m_fonts.size(); }
+
+    // Glyph for codepoint in font or, failing that, its fallback chain.
+    // glyph is null if no font in the chain has it.
+    ResolvedGlyph Resolve(FontId font, uint32_t codepoint) const;
+
+    // Kerning between two glyphs of font
+    float GetKerning(FontId font, uint32_t left, uint32_t right) const {
+        return m_fonts[font]->kerning.Get(left, right);
+    }
+
+    // Register the fonts listed in a manifest CSV:
+    //   Name,Atlas,Metrics,Kerning,Fallbacks
+    // Metrics (mapping CSV, or the .bin generate_atlas.py writes) and Kerning (optional)
+    // are paths relative to baseDir; Fallbacks is a ';'-separated list of font names,
+    // registered before or anywhere in this manifest. Rows that fail to load are skipped
+    // (and described in errors, if given). Returns the IDs of the fonts added.
+    std::vector<FontId> LoadManifest(std::istream& manifest, const std::filesystem::path& baseDir,
+                                     std::vector<std::string>* errors = nullptr);
+
+private:
+    ResolvedGlyph ResolveChain(FontId font, uint32_t codepoint) const;
+
+    std::vector<std::unique_ptr<Font>> m_fonts;  // Stable addresses - glyph pointers point into them
+
+    mutable std::mutex m_cacheMutex;
+    mutable std::unordered_map<uint64_t, ResolvedGlyph> m_fallbackCache;  // (font << 32 | codepoint)
+};
+
+} // namespace Projectile
@@ -5,7 +5,7 @@ namespace Projectile {
 
 void FormManager::Initialize(std::vector<RE::BGSProjectile*> projForms,
                               std::vector<RE::TESAmmo*> ammoForms) {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     if (m_initialized) {
         spdlog::warn("FormManager already initialized");
@@ -17,31 +17,40 @@ void FormManager::Initialize(std::vector<RE::BGSProjectile*> projForms,
     size_t numForms = (std::max)(projForms.size(), ammoForms.size());
     m_forms.resize(numForms);
 
+    m_unassigned = {};
+    m_idle = {};
     for (size_t i = 0; i < numForms; ++i) {
         m_forms[i].projForm = i < projForms.size() ? projForms[i] : nullptr;
         m_forms[i].ammoForm = i < ammoForms.size() ? ammoForms[i] : nullptr;
-        m_forms[i].assignedModel.clear();
+        m_forms[i].assignedModel = {};
         m_forms[i].refCount = 0;
+        PushFree(m_unassigned, static_cast<int>(i));
     }
 
     m_modelToForm.clear();
+    m_modelToForm.reserve(numForms);
+    m_usedCount = 0;
+    m_stats = {};
     m_initialized = true;
 
     spdlog::info("FormManager initialized with {} form slots", numForms);
 }
 
 void FormManager::Shutdown() {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     m_forms.clear();
     m_modelToForm.clear();
+    m_unassigned = {};
+    m_idle = {};
+    m_usedCount = 0;
     m_initialized = false;
 
     spdlog::info("FormManager shut down");
 }
 
-int FormManager::AcquireForm(const std::string& modelPath) {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+int FormManager::AcquireForm(InternedString modelPath) {
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     if (!m_initialized) {
         spdlog::error("FormManager::AcquireForm called before initialization");
@@ -50,42 +59,58 @@ int FormManager::AcquireForm(const std::string& modelPath) {
 
     // [DIAG] Log form pool state on every acquire
     spdlog::trace("[FORM] AcquireForm('{}') - used={}/{} free={}",
-        modelPath, GetUsedForms(), GetTotalForms(), GetFreeForms());
+        modelPath.view(), m_usedCount, m_forms.size(), m_forms.size() - m_usedCount);
 
-    // First, check if this model is already assigned to a form
+    // First, check if this model is already assigned to a form (in use or idle)
     int existingForm = FindFormByModel(modelPath);
     if (existingForm >= 0) {
-        m_forms[existingForm].refCount++;
+        FormSlot& slot = m_forms[existingForm];
+        if (slot.refCount++ == 0) {
+            Unlink(m_idle, existingForm);
+            m_usedCount++;
+        }
+        m_stats.hits++;
         spdlog::trace("FormManager::AcquireForm reusing form {} for '{}', refCount={}",
-            existingForm, modelPath, m_forms[existingForm].refCount);
+            existingForm, modelPath.view(), m_forms[existingForm].refCount);
         return existingForm;
     }
 
     // Need a new form - find a free one
-    int freeForm = FindFreeForm();
+    int freeForm = TakeFreeForm();
     if (freeForm < 0) {
+        m_stats.exhaustions++;
         spdlog::error("[FORM] EXHAUSTED - No free forms for '{}' (used={}/{})",
-            modelPath, GetUsedForms(), GetTotalForms());
+            modelPath.view(), m_usedCount, m_forms.size());
         // [DIAG] Dump all form slots for debugging
         for (size_t i = 0; i < m_forms.size(); ++i) {
             spdlog::error("[FORM]   Slot {}: refCount={} model='{}'",
-                i, m_forms[i].refCount, m_forms[i].assignedModel);
+                i, m_forms[i].refCount, m_forms[i].assignedModel.view());
         }
         return -1;
     }
 
+    m_stats.misses++;
+    FormSlot& slot = m_forms[freeForm];
+    if (!slot.assignedModel.empty()) {
+        // Evict the idle model - its next show is a miss
+        m_stats.evictions++;
+        m_modelToForm.erase(slot.assignedModel);
+        spdlog::trace("FormManager::AcquireForm evicting '{}' from idle form {}", slot.assignedModel.view(), freeForm);
+    }
+
     // Assign the model to this form
+    slot.assignedModel = modelPath;
+    slot.refCount = 1;
+    m_usedCount++;
     SetFormModel(freeForm, modelPath);
-    m_forms[freeForm].assignedModel = modelPath;
-    m_forms[freeForm].refCount = 1;
-    m_modelToForm[modelPath] = freeForm;
+    m_modelToForm.emplace(modelPath, freeForm);
 
-    spdlog::trace("FormManager::AcquireForm assigned form {} to '{}'", freeForm, modelPath);
+    spdlog::trace("FormManager::AcquireForm assigned form {} to '{}'", freeForm, modelPath.view());
     return freeForm;
 }
 
 void FormManager::ReleaseForm(int formIndex) {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     if (formIndex < 0 || formIndex >= static_cast<int>(m_forms.size())) {
         return;
@@ -100,21 +125,19 @@ void FormManager::ReleaseForm(int formIndex) {
     slot.refCount--;
     spdlog::trace("FormManager::ReleaseForm form {} refCount now {}", formIndex, slot.refCount);
 
-    // If refCount hits 0, the form is now free for reassignment
-    // We keep the model assigned until someone else claims it (lazy cleanup)
-    // This way if the same model is requested again soon, we don't need to re-set it
+    // If refCount hits 0, the form is now idle and free for reassignment
+    // We keep the model assigned (and in m_modelToForm) until someone else claims it,
+    // so if the same model is requested again soon, we don't need to re-set it
     if (slot.refCount == 0) {
-        // Remove from fast lookup - form is now fully free
-        m_modelToForm.erase(slot.assignedModel);
-        spdlog::trace("FormManager::ReleaseForm form {} now free (was '{}')",
-            formIndex, slot.assignedModel);
-        // Clear the model string to prevent memory fragmentation from retained strings
-        slot.assignedModel.clear();
+        PushFree(m_idle, formIndex);
+        m_usedCount--;
+        spdlog::trace("FormManager::ReleaseForm form {} now idle ('{}')",
+            formIndex, slot.assignedModel.view());
     }
 }
 
 RE::BGSProjectile* FormManager::GetProjectileForm(int formIndex) {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     if (formIndex < 0 || formIndex >= static_cast<int>(m_forms.size())) {
         return nullptr;
@@ -123,7 +146,7 @@ RE::BGSProjectile* FormManager::GetProjectileForm(int formIndex) {
 }
 
 RE::TESAmmo* FormManager::GetAmmoForm(int formIndex) {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     if (formIndex < 0 || formIndex >= static_cast<int>(m_forms.size())) {
         return nullptr;
@@ -132,7 +155,7 @@ RE::TESAmmo* FormManager::GetAmmoForm(int formIndex) {
 }
 
 const FormManager::FormSlot* FormManager::GetFormSlot(int formIndex) const {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     if (formIndex < 0 || formIndex >= static_cast<int>(m_forms.size())) {
         return nullptr;
@@ -141,30 +164,26 @@ const FormManager::FormSlot* FormManager::GetFormSlot(int formIndex) const {
 }
 
 size_t FormManager::GetUsedForms() const {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-
-    size_t count = 0;
-    for (const auto& slot : m_forms) {
-        if (slot.refCount > 0) {
-            ++count;
-        }
-    }
-    return count;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_usedCount;
 }
 
 size_t FormManager::GetFreeForms() const {
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_forms.size() - m_usedCount;
+}
 
-    size_t count = 0;
-    for (const auto& slot : m_forms) {
-        if (slot.refCount == 0) {
-            ++count;
-        }
-    }
-    return count;
+size_t FormManager::GetIdleForms() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_idle.size;
 }
 
-int FormManager::FindFormByModel(const std::string& modelPath) const {
+FormManager::Stats FormManager::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+int FormManager::FindFormByModel(InternedString modelPath) const {
     auto it = m_modelToForm.find(modelPath);
     if (it != m_modelToForm.end()) {
         return it->second;
@@ -172,21 +191,48 @@ int FormManager::FindFormByModel(const std::string& modelPath) const {
     return -1;
 }
 
-int FormManager::FindFreeForm() const {
-    // First pass: prefer forms with refCount == 0 that already have our model
-    // (This is handled by FindFormByModel, so here we just find any free form)
+int FormManager::TakeFreeForm() {
+    // Forms that already have our model are handled by FindFormByModel, so here we
+    // prefer a never-assigned form and otherwise evict the least recently used idle one
+    FreeList& list = m_unassigned.head >= 0 ? m_unassigned : m_idle;
+    int formIndex = list.head;
+    if (formIndex >= 0) {
+        Unlink(list, formIndex);
+    }
+    return formIndex;
+}
 
-    // Second pass: any form with refCount == 0
-    for (size_t i = 0; i < m_forms.size(); ++i) {
-        if (m_forms[i].refCount == 0) {
-            return static_cast<int>(i);
-        }
+void FormManager::PushFree(FreeList& list, int formIndex) {
+    FormSlot& slot = m_forms[formIndex];
+    slot.prevFree = list.tail;
+    slot.nextFree = -1;
+    if (list.tail >= 0) {
+        m_forms[list.tail].nextFree = formIndex;
+    } else {
+        list.head = formIndex;
     }
+    list.tail = formIndex;
+    list.size++;
+}
 
-    return -1;
+void FormManager::Unlink(FreeList& list, int formIndex) {
+    FormSlot& slot = m_forms[formIndex];
+    if (slot.prevFree >= 0) {
+        m_forms[slot.prevFree].nextFree = slot.nextFree;
+    } else {
+        list.head = slot.nextFree;
+    }
+    if (slot.nextFree >= 0) {
+        m_forms[slot.nextFree].prevFree = slot.prevFree;
+    } else {
+        list.tail = slot.prevFree;
+    }
+    slot.prevFree = -1;
+    slot.nextFree = -1;
+    list.size--;
 }
 
-void FormManager::SetFormModel(int formIndex, const std::string& modelPath) {
+void FormManager::SetFormModel(int formIndex, InternedString modelPath) {
     if (formIndex < 0 || formIndex >= static_cast<int>(m_forms.size())) {
         return;
     }
@@ -196,7 +242,7 @@ void FormManager::SetFormModel(int formIndex, const std::string& modelPath) {
     // Set model on BGSProjectile (inherits from TESModel)
     if (slot.projForm) {
         slot.projForm->SetModel(modelPath.c_str());
-        spdlog::info("[BOUNDS] SetModel called for '{}'", modelPath);
+        spdlog::info("[BOUNDS] SetModel called for '{}'", modelPath.view());
     }
 
     // Set model on TESAmmo (also inherits from TESModel)
@@ -204,7 +250,7 @@ void FormManager::SetFormModel(int formIndex, const std::string& modelPath) {
         slot.ammoForm->SetModel(modelPath.c_str());
     }
 
-    spdlog::trace("FormManager::SetFormModel form {} model set to '{}'", formIndex, modelPath);
+    spdlog::trace("FormManager::SetFormModel form {} model set to '{}'", formIndex, modelPath.view());
 }
 
 } // namespace Projectile
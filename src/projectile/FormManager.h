@@ -6,7 +6,10 @@
 #include "TestStubs.h"
 #endif
 
-#include <string>
+#include "../util/StringTable.h"
+
+#include <cstdint>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <mutex>
@@ -15,14 +18,30 @@ namespace Projectile {
 
 // Tracks model→FormID assignments with reference counting.
 // Allows multiple projectile instances to share the same FormID when they use the same model.
-// Forms are released when refCount hits 0, making them available for other models.
+// A form whose refCount hits 0 keeps its model (idle), so showing the same model again reuses
+// it without SetModel. A new model takes a never-used form first, then evicts the least
+// recently released idle form.
+//
+// Acquire and release are O(1) and don't allocate: free forms sit on two intrusive lists
+// (never assigned, idle in LRU order), used/idle counts are kept running, and models are
+// looked up by interned string ID.
 class FormManager {
 public:
     struct FormSlot {
         RE::BGSProjectile* projForm = nullptr;
         RE::TESAmmo* ammoForm = nullptr;
-        std::string assignedModel;  // Empty = unassigned/free
+        InternedString assignedModel;  // Empty = never assigned
         int refCount = 0;           // How many live instances use this form
+        int prevFree = -1;          // Free list links (refCount == 0 only)
+        int nextFree = -1;
+    };
+
+    // Lifetime counters (reset by Initialize)
+    struct Stats {
+        uint64_t hits = 0;          // Model already assigned to a form (shared or idle)
+        uint64_t misses = 0;        // Model had to be set on a form
+        uint64_t evictions = 0;     // Misses that replaced an idle form's model
+        uint64_t exhaustions = 0;   // Acquires that failed - every form in use
     };
 
     FormManager() = default;
@@ -39,13 +58,14 @@ public:
     bool IsInitialized() const { return m_initialized; }
 
     // Acquire a form for the given model path.
-    // If model already assigned to a form, reuses it (refCount++).
-    // Otherwise assigns to a free form and sets the model.
-    // Returns formIndex, or -1 if no form available.
-    int AcquireForm(const std::string& modelPath);
+    // If model already assigned to a form (in use or idle), reuses it (refCount++).
+    // Otherwise assigns it to a free form, evicting the LRU idle model if needed.
+    // Returns formIndex, or -1 if every form is in use.
+    int AcquireForm(InternedString modelPath);
+    int AcquireForm(std::string_view modelPath) { return AcquireForm(InternedString(modelPath)); }
 
     // Release a form. Decrements refCount.
-    // If refCount hits 0, form becomes available for reassignment.
+    // If refCount hits 0, the form goes idle: it keeps its model but may be evicted.
     void ReleaseForm(int formIndex);
 
     // Get the forms for firing
@@ -59,20 +79,37 @@ public:
     size_t GetTotalForms() const { return m_forms.size(); }
     size_t GetUsedForms() const;   // Forms with refCount > 0
     size_t GetFreeForms() const;   // Forms with refCount == 0
+    size_t GetIdleForms() const;   // Free forms still holding a model
+    Stats GetStats() const;
 
 private:
+    // Doubly linked list of free slots threaded through FormSlot::prevFree/nextFree
+    struct FreeList {
+        int head = -1;
+        int tail = -1;
+        size_t size = 0;
+    };
+
     // Find a form already assigned to this model, or -1 if none
-    int FindFormByModel(const std::string& modelPath) const;
+    int FindFormByModel(InternedString modelPath) const;
+
+    // Take a free form (refCount == 0): a never-assigned one if any, otherwise the least
+    // recently used idle one. -1 if none
+    int TakeFreeForm();
 
-    // Find a free form (refCount == 0), or -1 if none
-    int FindFreeForm() const;
+    void PushFree(FreeList& list, int formIndex);  // Appends (most recently used end)
+    void Unlink(FreeList& list, int formIndex);
 
     // Set the model on a form's BGSProjectile and TESAmmo
-    void SetFormModel(int formIndex, const std::string& modelPath);
+    void SetFormModel(int formIndex, InternedString modelPath);
 
-    mutable std::recursive_mutex m_mutex;
+    mutable std::mutex m_mutex;
     std::vector<FormSlot> m_forms;
-    std::unordered_map<std::string, int> m_modelToForm;  // Fast lookup: model → formIndex
+    std::unordered_map<InternedString, int, InternedString::Hash> m_modelToForm;  // model → formIndex (incl. idle)
+    FreeList m_unassigned;   // Never assigned a model
+    FreeList m_idle;         // Keep their model; head = least recently released
+    size_t m_usedCount = 0;
+    Stats m_stats;
     bool m_initialized = false;
 };
 
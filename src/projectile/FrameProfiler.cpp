@@ -0,0 +1,282 @@
+#include "FrameProfiler.h"
+
+#if defined(TEST_ENVIRONMENT)
+#include "TestStubs.h"  // spdlog stubs
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+
+namespace Projectile {
+
+namespace {
+    constexpr size_t SCOPE_COUNT = static_cast<size_t>(ProfileScope::Count);
+
+    // Owner attributed to samples recorded on this thread (see OwnerScope)
+    thread_local const void* t_currentOwner = nullptr;
+
+    // Ring cache for the calling thread. Keyed by instance id rather than address so a
+    // profiler created at a recycled address never sees another instance's ring.
+    std::atomic<uint64_t> g_nextInstanceId{1};
+    thread_local uint64_t t_ringInstanceId = 0;
+    thread_local void* t_ring = nullptr;
+
+    // Nearest-rank percentile of sorted values
+    float Percentile(const std::vector<float>& sorted, float percentile) {
+        size_t rank = static_cast<size_t>(std::ceil(percentile * static_cast<float>(sorted.size())));
+        rank = std::clamp<size_t>(rank, 1, sorted.size());
+        return sorted[rank - 1];
+    }
+
+    const char* OwnerLabel(const std::string& name, const void* owner) {
+        if (!name.empty()) return name.c_str();
+        return owner ? "(unnamed)" : "(global)";
+    }
+}
+
+const char* ToString(ProfileScope scope) {
+    switch (scope) {
+        case ProfileScope::Frame: return "Frame";
+        case ProfileScope::DriverUpdate: return "DriverUpdate";
+        case ProfileScope::Layout: return "Layout";
+        case ProfileScope::Interaction: return "Interaction";
+        case ProfileScope::Tooltip: return "Tooltip";
+        case ProfileScope::TextureProcessing: return "TextureProcessing";
+        case ProfileScope::Smoothing: return "Smoothing";
+        case ProfileScope::Hook: return "Hook";
+        default: return "Unknown";
+    }
+}
+
+FrameProfiler& FrameProfiler::GetSingleton() {
+    static FrameProfiler instance;
+    return instance;
+}
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+FrameProfiler::FrameProfiler()
+    : m_instanceId(g_nextInstanceId.fetch_add(1, std::memory_order_relaxed)) {}
+
+FrameProfiler::ThreadRing& FrameProfiler::GetThreadRing() {
+    if (t_ringInstanceId == m_instanceId && t_ring) {
+        return *static_cast<ThreadRing*>(t_ring);
+    }
+
+    std::lock_guard lock(m_ringsMutex);
+    m_rings.push_back(std::make_unique<ThreadRing>());
+    t_ring = m_rings.back().get();
+    t_ringInstanceId = m_instanceId;
+    return *m_rings.back();
+}
+
+void FrameProfiler::Record(ProfileScope scope, const void* owner, Clock::duration elapsed) {
+    if (scope >= ProfileScope::Count) {
+        return;
+    }
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    ns = std::clamp<decltype(ns)>(ns, 0, UINT32_MAX);
+
+    ThreadRing& ring = GetThreadRing();
+    size_t head = ring.head.load(std::memory_order_relaxed);
+    size_t tail = ring.tail.load(std::memory_order_acquire);
+    if (head - tail >= RING_CAPACITY) {
+        m_droppedSamples.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    ring.samples[head % RING_CAPACITY] = {owner, static_cast<uint32_t>(ns), scope};
+    ring.head.store(head + 1, std::memory_order_release);
+}
+
+const void* FrameProfiler::GetCurrentOwner() {
+    return t_currentOwner;
+}
+
+FrameProfiler::OwnerScope::OwnerScope(const void* owner)
+    : m_previous(t_currentOwner) {
+    t_currentOwner = owner;
+}
+
+FrameProfiler::OwnerScope::~OwnerScope() {
+    t_currentOwner = m_previous;
+}
+
+// =============================================================================
+// Owners
+// =============================================================================
+
+void FrameProfiler::SetOwnerName(const void* owner, std::string name) {
+    std::lock_guard lock(m_statsMutex);
+    m_owners[owner].name = std::move(name);
+}
+
+void FrameProfiler::ForgetOwner(const void* owner) {
+    std::lock_guard lock(m_statsMutex);
+    m_owners.erase(owner);
+}
+
+// =============================================================================
+// Frame boundary
+// =============================================================================
+
+void FrameProfiler::EndFrame() {
+    std::lock_guard statsLock(m_statsMutex);
+
+    {
+        // Only blocks against a thread recording its very first sample
+        std::lock_guard ringsLock(m_ringsMutex);
+        for (auto& ring : m_rings) {
+            size_t tail = ring->tail.load(std::memory_order_relaxed);
+            size_t head = ring->head.load(std::memory_order_acquire);
+            for (; tail != head; ++tail) {
+                const Sample& sample = ring->samples[tail % RING_CAPACITY];
+                auto it = m_owners.find(sample.owner);
+                if (it == m_owners.end()) {
+                    if (sample.owner) {
+                        continue;  // Unnamed or forgotten owner (e.g. a destroyed driver)
+                    }
+                    it = m_owners.emplace(nullptr, OwnerStats{}).first;
+                }
+                size_t index = static_cast<size_t>(sample.scope);
+                it->second.frameNs[index] += sample.nanoseconds;
+                it->second.touched[index] = true;
+            }
+            ring->tail.store(tail, std::memory_order_release);
+        }
+    }
+
+    // Push this frame's per-owner totals into the rolling windows
+    for (auto& [owner, stats] : m_owners) {
+        for (size_t i = 0; i < SCOPE_COUNT; ++i) {
+            if (!stats.touched[i]) {
+                continue;
+            }
+            auto& window = stats.windows[i];
+            float micros = static_cast<float>(stats.frameNs[i]) / 1000.0f;
+            if (window.frames.size() < WINDOW_FRAMES) {
+                window.frames.push_back(micros);
+            } else {
+                window.frames[window.next] = micros;
+            }
+            window.next = (window.next + 1) % WINDOW_FRAMES;
+            stats.frameNs[i] = 0;
+            stats.touched[i] = false;
+        }
+    }
+}
+
+void FrameProfiler::Reset() {
+    std::lock_guard statsLock(m_statsMutex);
+    {
+        std::lock_guard ringsLock(m_ringsMutex);
+        for (auto& ring : m_rings) {
+            ring->tail.store(ring->head.load(std::memory_order_acquire), std::memory_order_release);
+        }
+    }
+    for (auto& [owner, stats] : m_owners) {
+        stats.frameNs.fill(0);
+        stats.touched.fill(false);
+        for (auto& window : stats.windows) {
+            window.frames.clear();
+            window.next = 0;
+        }
+    }
+    m_droppedSamples.store(0, std::memory_order_relaxed);
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+FrameProfiler::ScopeStats FrameProfiler::ComputeStats(const Window& window) {
+    ScopeStats stats;
+    if (window.frames.empty()) {
+        return stats;
+    }
+    std::vector<float> sorted = window.frames;
+    std::sort(sorted.begin(), sorted.end());
+    stats.p50Us = Percentile(sorted, 0.50f);
+    stats.p95Us = Percentile(sorted, 0.95f);
+    stats.p99Us = Percentile(sorted, 0.99f);
+    stats.maxUs = sorted.back();
+    stats.frameCount = static_cast<uint32_t>(sorted.size());
+    return stats;
+}
+
+FrameProfiler::ScopeStats FrameProfiler::Query(const void* owner, ProfileScope scope) const {
+    if (scope >= ProfileScope::Count) {
+        return {};
+    }
+    std::lock_guard lock(m_statsMutex);
+    auto it = m_owners.find(owner);
+    if (it == m_owners.end()) {
+        return {};
+    }
+    return ComputeStats(it->second.windows[static_cast<size_t>(scope)]);
+}
+
+std::vector<FrameProfiler::OwnerReport> FrameProfiler::GetReport() const {
+    std::vector<OwnerReport> report;
+    {
+        std::lock_guard lock(m_statsMutex);
+        report.reserve(m_owners.size());
+        for (const auto& [owner, stats] : m_owners) {
+            OwnerReport entry;
+            entry.owner = owner;
+            entry.name = stats.name;
+            for (size_t i = 0; i < SCOPE_COUNT; ++i) {
+                entry.scopes[i] = ComputeStats(stats.windows[i]);
+            }
+            report.push_back(std::move(entry));
+        }
+    }
+
+    // Most expensive owner first (by its worst p95 over all scopes)
+    auto cost = [](const OwnerReport& entry) {
+        float worst = 0.0f;
+        for (const auto& scope : entry.scopes) {
+            worst = (std::max)(worst, scope.p95Us);
+        }
+        return worst;
+    };
+    std::sort(report.begin(), report.end(), [&](const OwnerReport& a, const OwnerReport& b) {
+        return cost(a) > cost(b);
+    });
+    return report;
+}
+
+std::string FrameProfiler::FormatReport() const {
+    std::string out;
+    for (const auto& entry : GetReport()) {
+        for (size_t i = 0; i < SCOPE_COUNT; ++i) {
+            const auto& stats = entry.scopes[i];
+            if (stats.frameCount == 0) {
+                continue;
+            }
+            out += std::format("{} {}: p50={:.1f}us p95={:.1f}us p99={:.1f}us max={:.1f}us frames={}\n",
+                OwnerLabel(entry.name, entry.owner), ToString(static_cast<ProfileScope>(i)),
+                stats.p50Us, stats.p95Us, stats.p99Us, stats.maxUs, stats.frameCount);
+        }
+    }
+    return out;
+}
+
+void FrameProfiler::DumpToLog() const {
+    std::string report = FormatReport();
+    spdlog::info("[Profiler] Frame time report ({} frame window, {} dropped samples)",
+        WINDOW_FRAMES, GetDroppedSampleCount());
+
+    size_t start = 0;
+    while (start < report.size()) {
+        size_t end = report.find('\n', start);
+        if (end == std::string::npos) end = report.size();
+        spdlog::info("[Profiler] {}", report.substr(start, end - start));
+        start = end + 1;
+    }
+}
+
+} // namespace Projectile
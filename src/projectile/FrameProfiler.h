@@ -0,0 +1,181 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Projectile {
+
+// Instrumented sections of a frame. Scopes nest (DriverUpdate includes Layout of the same
+// driver), so per-scope times are inclusive and don't add up to Frame.
+enum class ProfileScope : uint8_t {
+    Frame,              // Whole DriverUpdateManager::Update
+    DriverUpdate,       // Root driver Update (anchor, facing, layout, children)
+    Layout,             // UpdateLayout of a driver and its sub-drivers
+    Interaction,        // InteractionController::Update (hover, scale animation)
+    Tooltip,            // TooltipTextDisplayManager::Update
+    TextureProcessing,  // AsyncTextureLoader::ProcessCompletedLoads
+    Smoothing,          // TransformStore::Update (batch smoothing + publish)
+    Hook,               // Projectile physics hook (summed over every hooked projectile)
+    Count
+};
+
+const char* ToString(ProfileScope scope);
+
+// Always-on, low-overhead frame profiler.
+//
+// Threads record samples into their own lock-free single-producer ring buffer (no locks or
+// allocation after a thread's first sample). Once per frame the main thread calls EndFrame(),
+// which drains every buffer, sums each owner's samples per scope, and pushes those per-frame
+// totals into rolling windows used for p50/p95/p99 queries.
+//
+// Samples are attributed to an "owner" - the root driver being updated on this thread
+// (see OwnerScope) - so a slow menu shows up under its own name. Samples recorded outside
+// any owner (tooltips, texture processing, the hook) go to the global owner (nullptr).
+class FrameProfiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Frames kept per owner and scope for percentile queries (~6.7s at 90Hz)
+    static constexpr size_t WINDOW_FRAMES = 600;
+    // Per-thread ring capacity (samples between two EndFrame calls)
+    static constexpr size_t RING_CAPACITY = 4096;
+
+    struct ScopeStats {
+        float p50Us = 0.0f;
+        float p95Us = 0.0f;
+        float p99Us = 0.0f;
+        float maxUs = 0.0f;
+        uint32_t frameCount = 0;  // Frames in the window that recorded this scope
+    };
+
+    struct OwnerReport {
+        const void* owner = nullptr;
+        std::string name;
+        std::array<ScopeStats, static_cast<size_t>(ProfileScope::Count)> scopes;
+    };
+
+    static FrameProfiler& GetSingleton();
+
+    FrameProfiler();
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    // === Recording (any thread) ===
+    void Record(ProfileScope scope, const void* owner, Clock::duration elapsed);
+
+    // Recording is on by default; disabling makes scopes skip the clock reads
+    void SetEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+    bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    // Owner that scopes on the calling thread attribute their samples to
+    static const void* GetCurrentOwner();
+
+    // === Owners (main thread) ===
+    // Owners must be named before their samples are kept; samples of unknown owners are
+    // discarded so a destroyed driver's late samples can't resurrect its entry
+    void SetOwnerName(const void* owner, std::string name);
+    // Drop an owner's history (e.g. its driver is being destroyed)
+    void ForgetOwner(const void* owner);
+
+    // === Frame boundary (main thread, once per frame) ===
+    void EndFrame();
+
+    // === Queries (any thread) ===
+    ScopeStats Query(const void* owner, ProfileScope scope) const;
+    std::vector<OwnerReport> GetReport() const;
+    // Human-readable report, one line per owner and recorded scope
+    std::string FormatReport() const;
+    void DumpToLog() const;
+
+    // Samples dropped because a thread's ring was full
+    uint64_t GetDroppedSampleCount() const { return m_droppedSamples.load(std::memory_order_relaxed); }
+
+    // Clear every window and pending sample (owner names are kept)
+    void Reset();
+
+    // RAII timer for one scope, attributed to the thread's current owner
+    class Scope {
+    public:
+        explicit Scope(ProfileScope scope)
+            : m_scope(scope)
+            , m_active(GetSingleton().IsEnabled()) {
+            if (m_active) {
+                m_start = Clock::now();
+            }
+        }
+        ~Scope() {
+            if (m_active) {
+                GetSingleton().Record(m_scope, GetCurrentOwner(), Clock::now() - m_start);
+            }
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ProfileScope m_scope;
+        bool m_active;
+        Clock::time_point m_start;
+    };
+
+    // RAII owner attribution for the calling thread (restores the previous owner)
+    class OwnerScope {
+    public:
+        explicit OwnerScope(const void* owner);
+        ~OwnerScope();
+        OwnerScope(const OwnerScope&) = delete;
+        OwnerScope& operator=(const OwnerScope&) = delete;
+
+    private:
+        const void* m_previous;
+    };
+
+private:
+    struct Sample {
+        const void* owner;
+        uint32_t nanoseconds;
+        ProfileScope scope;
+    };
+
+    // Single-producer (owning thread) / single-consumer (EndFrame) ring
+    struct ThreadRing {
+        std::array<Sample, RING_CAPACITY> samples;
+        std::atomic<size_t> head{0};  // Next write (producer)
+        std::atomic<size_t> tail{0};  // Next read (consumer)
+    };
+
+    struct Window {
+        std::vector<float> frames;  // Per-frame totals in microseconds, ring of WINDOW_FRAMES
+        size_t next = 0;
+    };
+
+    struct OwnerStats {
+        std::string name;
+        std::array<uint64_t, static_cast<size_t>(ProfileScope::Count)> frameNs{};
+        std::array<bool, static_cast<size_t>(ProfileScope::Count)> touched{};
+        std::array<Window, static_cast<size_t>(ProfileScope::Count)> windows;
+    };
+
+    ThreadRing& GetThreadRing();
+    static ScopeStats ComputeStats(const Window& window);
+
+    const uint64_t m_instanceId;
+    std::atomic<bool> m_enabled{true};
+    std::atomic<uint64_t> m_droppedSamples{0};
+
+    // Rings are never freed, so a thread's ring stays valid for EndFrame after it exits
+    std::mutex m_ringsMutex;
+    std::vector<std::unique_ptr<ThreadRing>> m_rings;
+
+    mutable std::mutex m_statsMutex;
+    std::unordered_map<const void*, OwnerStats> m_owners;
+};
+
+} // namespace Projectile
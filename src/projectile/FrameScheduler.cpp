@@ -0,0 +1,101 @@
+#include "FrameScheduler.h"
+
+#include <algorithm>
+
+namespace Widget {
+
+namespace {
+    // Weight of the newest sample in a root's cost estimate
+    constexpr float COST_SMOOTHING = 0.2f;
+}
+
+const char* ToString(UpdatePriority priority) {
+    switch (priority) {
+        case UpdatePriority::Interacting: return "Interacting";
+        case UpdatePriority::Normal: return "Normal";
+        case UpdatePriority::Far: return "Far";
+        case UpdatePriority::Hidden: return "Hidden";
+        default: return "Unknown";
+    }
+}
+
+uint32_t FrameScheduler::GetInterval(UpdatePriority priority) const {
+    switch (priority) {
+        case UpdatePriority::Far: return (std::max)(m_settings.farInterval, 1u);
+        case UpdatePriority::Hidden: return (std::max)(m_settings.hiddenInterval, 1u);
+        default: return 1;
+    }
+}
+
+const std::vector<size_t>& FrameScheduler::Plan(const std::vector<Candidate>& candidates, float deltaTime) {
+    m_plan.clear();
+    m_deferredCount = 0;
+
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        auto& state = m_states[candidates[i].key];
+        state.priority = candidates[i].priority;
+        state.pendingDelta += deltaTime;
+        ++state.framesWaiting;
+        if (state.framesWaiting >= GetInterval(state.priority)) {
+            m_plan.push_back(i);
+        }
+    }
+
+    // Most urgent first; among equals, whoever waited longest (deferred roots get to go first)
+    std::stable_sort(m_plan.begin(), m_plan.end(), [&](size_t a, size_t b) {
+        const auto& stateA = m_states[candidates[a].key];
+        const auto& stateB = m_states[candidates[b].key];
+        if (stateA.priority != stateB.priority) {
+            return stateA.priority < stateB.priority;
+        }
+        return stateA.framesWaiting > stateB.framesWaiting;
+    });
+    return m_plan;
+}
+
+bool FrameScheduler::Admit(const void* key, uint64_t spentUs, float& deltaTime) {
+    auto it = m_states.find(key);
+    if (it == m_states.end()) {
+        return false;  // Not planned this frame
+    }
+    auto& state = it->second;
+
+    // The first root of a frame always runs so the budget can never stall every root
+    bool withinBudget = m_settings.budgetUs == 0 || spentUs == 0 ||
+        spentUs + static_cast<uint64_t>(state.estimatedCostUs) <= m_settings.budgetUs;
+    bool mustRun = state.priority == UpdatePriority::Interacting ||
+        state.deferrals >= m_settings.maxDeferredFrames;
+
+    if (!withinBudget && !mustRun) {
+        ++state.deferrals;
+        ++m_deferredCount;
+        return false;
+    }
+
+    deltaTime = state.pendingDelta;
+    state.pendingDelta = 0.0f;
+    state.framesWaiting = 0;
+    state.deferrals = 0;
+    return true;
+}
+
+void FrameScheduler::RecordCost(const void* key, uint64_t costUs) {
+    auto it = m_states.find(key);
+    if (it == m_states.end()) {
+        return;
+    }
+    float cost = static_cast<float>(costUs);
+    float& estimate = it->second.estimatedCostUs;
+    estimate = (estimate == 0.0f) ? cost : estimate + (cost - estimate) * COST_SMOOTHING;
+}
+
+float FrameScheduler::GetEstimatedCost(const void* key) const {
+    auto it = m_states.find(key);
+    return it != m_states.end() ? it->second.estimatedCostUs : 0.0f;
+}
+
+void FrameScheduler::Forget(const void* key) {
+    m_states.erase(key);
+}
+
+} // namespace Widget
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Widget {
+
+// How urgently a root driver needs its per-frame update
+enum class UpdatePriority : uint8_t {
+    Interacting,    // Hovered or grabbed - every frame, never deferred by the budget
+    Normal,         // Visible and near - every frame while the budget allows
+    Far,            // Visible but far from the player - every Settings::farInterval frames
+    Hidden          // Registered but hidden - every Settings::hiddenInterval frames
+};
+
+const char* ToString(UpdatePriority priority);
+
+// Decides which root drivers DriverUpdateManager updates this frame.
+//
+// Each frame the manager passes every root with its priority to Plan(), which returns the
+// roots that are due, most urgent first (by priority, then by how long each has waited).
+// The manager then asks Admit() before running each one; once the frame's time budget is
+// spent, remaining non-interacting roots are deferred to a later frame. A deferred or
+// reduced-rate root keeps accumulating delta time and receives all of it when it next runs,
+// so its animations and smoothing catch up instead of slowing down.
+//
+// NOT thread-safe - owned by DriverUpdateManager on the main thread.
+class FrameScheduler {
+public:
+    struct Settings {
+        uint32_t budgetUs = 0;          // Per-frame time budget for root updates (0 = unlimited)
+        uint32_t farInterval = 2;       // Far roots run every N frames
+        uint32_t hiddenInterval = 10;   // Hidden roots run every N frames
+        uint32_t maxDeferredFrames = 4; // Budget deferrals before a root runs regardless
+    };
+
+    struct Candidate {
+        const void* key;
+        UpdatePriority priority;
+    };
+
+    void SetSettings(const Settings& settings) { m_settings = settings; }
+    const Settings& GetSettings() const { return m_settings; }
+
+    // Start a frame: accumulate deltaTime for every candidate and return the indices (into
+    // candidates) of the ones that are due, most urgent first. Unknown keys are added.
+    const std::vector<size_t>& Plan(const std::vector<Candidate>& candidates, float deltaTime);
+
+    // Ask to run a planned root now, given the time already spent (or committed) on roots
+    // this frame.
+    // On true, deltaTime receives the time accumulated since the root last ran.
+    // On false the root is deferred and its accumulated time rolls over.
+    bool Admit(const void* key, uint64_t spentUs, float& deltaTime);
+
+    // Report how long an admitted root took (feeds the per-root cost estimate)
+    void RecordCost(const void* key, uint64_t costUs);
+    // Moving average of a root's update cost in microseconds (0 until first recorded)
+    float GetEstimatedCost(const void* key) const;
+
+    // Stop tracking a root (unregistered)
+    void Forget(const void* key);
+
+    // Roots deferred by the budget in the last frame
+    size_t GetDeferredCount() const { return m_deferredCount; }
+
+private:
+    struct State {
+        UpdatePriority priority = UpdatePriority::Normal;
+        float pendingDelta = 0.0f;      // Time accumulated since the root last ran
+        uint32_t framesWaiting = 0;     // Frames since the root last ran
+        uint32_t deferrals = 0;         // Consecutive budget deferrals
+        float estimatedCostUs = 0.0f;   // Moving average of the root's update cost
+    };
+
+    uint32_t GetInterval(UpdatePriority priority) const;
+
+    Settings m_settings;
+    std::unordered_map<const void*, State> m_states;
+    std::vector<size_t> m_plan;          // Reused across frames
+    size_t m_deferredCount = 0;
+};
+
+} // namespace Widget
@@ -1,6 +1,8 @@
 #include "GameProjectile.h"
 #if !defined(TEST_ENVIRONMENT)
 #include "TextureManipulator.h"
+#include "AsyncTextureLoader.h"
+#include "IconAtlas.h"
 #endif
 #include "../log.h"
 #include "../util/VRNodes.h"
@@ -14,18 +16,23 @@ GameProjectile::~GameProjectile() {
 GameProjectile::GameProjectile(GameProjectile&& other) noexcept
     : m_projectile(other.m_projectile)
     , m_refHandle(other.m_refHandle)
+    , m_hookProjectile(other.m_hookProjectile.exchange(nullptr))
     , m_targetTransform(other.m_targetTransform)
     , m_modelPath(std::move(other.m_modelPath))
     , m_texturePath(std::move(other.m_texturePath))
     , m_borderColor(std::move(other.m_borderColor))
     , m_needsTextureSet(other.m_needsTextureSet)
-    , m_visible(other.m_visible)
+    , m_textureRequests(std::move(other.m_textureRequests))
+    , m_pinnedTexture(other.m_pinnedTexture)
+    , m_visible(other.m_visible.load())
     , m_markedForDeletion(other.m_markedForDeletion)
     , m_assignmentTime(other.m_assignmentTime)
 {
+    m_transformMailbox.Publish(m_targetTransform);
     other.m_projectile = nullptr;
     other.m_refHandle = 0;
     other.m_needsTextureSet = false;
+    other.m_pinnedTexture = InternedString();
 }
 
 GameProjectile& GameProjectile::operator=(GameProjectile&& other) noexcept {
@@ -33,18 +40,23 @@ GameProjectile& GameProjectile::operator=(GameProjectile&& other) noexcept {
         Unbind();
         m_projectile = other.m_projectile;
         m_refHandle = other.m_refHandle;
+        m_hookProjectile.store(other.m_hookProjectile.exchange(nullptr));
         m_targetTransform = other.m_targetTransform;
+        m_transformMailbox.Publish(m_targetTransform);
         m_modelPath = std::move(other.m_modelPath);
         m_texturePath = std::move(other.m_texturePath);
         m_borderColor = std::move(other.m_borderColor);
         m_needsTextureSet = other.m_needsTextureSet;
-        m_visible = other.m_visible;
+        m_textureRequests = std::move(other.m_textureRequests);
+        m_pinnedTexture = other.m_pinnedTexture;
+        m_visible = other.m_visible.load();
         m_markedForDeletion = other.m_markedForDeletion;
         m_assignmentTime = other.m_assignmentTime;
 
         other.m_projectile = nullptr;
         other.m_refHandle = 0;
         other.m_needsTextureSet = false;
+        other.m_pinnedTexture = InternedString();
     }
     return *this;
 }
@@ -76,6 +88,7 @@ void GameProjectile::BindToProjectile(RE::Projectile* proj) {
     m_projectile = proj;
 
     m_refHandle = GameProjectileUtils::GetOrCreateRefHandle(proj);
+    m_hookProjectile.store(proj, std::memory_order_release);
 
     // CRITICAL: Reset texture flag when binding to a NEW projectile
     // This ensures textures are re-applied after visibility toggle (unbind/rebind cycle).
@@ -84,7 +97,7 @@ void GameProjectile::BindToProjectile(RE::Projectile* proj) {
     if (!m_texturePath.empty()) {
         m_needsTextureSet = true;
         m_textureRetryCount = 0;
-        spdlog::trace("GameProjectile::BindToProjectile - Reset m_needsTextureSet for texture '{}'", m_texturePath);
+        spdlog::trace("GameProjectile::BindToProjectile - Reset m_needsTextureSet for texture '{}'", m_texturePath.view());
     }
 
     PreventDestruction();
@@ -109,6 +122,11 @@ void GameProjectile::Unbind() {
         }
     }
 
+    // Pending swaps target this projectile's nodes, and it no longer shows its texture
+    CancelTextureRequests();
+    SetPinnedTexture(InternedString());
+
+    m_hookProjectile.store(nullptr, std::memory_order_release);
     m_projectile = nullptr;
     m_refHandle = 0;
     m_markedForDeletion = false;
@@ -136,14 +154,10 @@ RE::FormID GameProjectile::GetBaseFormID() const {
 
 void GameProjectile::SetTransform(const ProjectileTransform& transform) {
     m_targetTransform = transform;
+    m_transformMailbox.Publish(transform);
 }
 
 void GameProjectile::ApplyTransform() {
-    // Throttled logging counter
-    static uint64_t s_applyCount = 0;
-    ++s_applyCount;
-    bool shouldLog = (s_applyCount % 300 == 1);
-
     if (!m_projectile) {
         spdlog::warn("GameProjectile::ApplyTransform - m_projectile is null");
         return;
@@ -155,7 +169,13 @@ void GameProjectile::ApplyTransform() {
         return;
     }
 
-    auto* node = m_projectile->Get3D();
+    ApplyTransform(m_projectile);
+}
+
+void GameProjectile::ApplyTransform(RE::Projectile* proj) {
+    // Only touches proj and the atomics/mailbox - m_projectile and m_refHandle belong to
+    // the main thread, and the hook's projectile is alive for the duration of its update
+    auto* node = proj->Get3D();
     if (!node) {
         spdlog::warn("GameProjectile::ApplyTransform - Get3D() returned null");
         return;
@@ -164,16 +184,19 @@ void GameProjectile::ApplyTransform() {
     // === CRITICAL: Prevent game from destroying the projectile ===
     // Must be called EVERY FRAME to reset lifetime counters and traveled distance.
     // This is the key fix - SpellWheelVR does this continuously in their update hook.
-    PreventDestruction();
+    PreventDestruction(proj);
+
+    // Latest complete transform published by the main thread (no lock needed)
+    ProjectileTransform transform = m_transformMailbox.Read();
 
     // Apply position
-    m_projectile->data.location = m_targetTransform.position;
+    proj->data.location = transform.position;
 
     // Note: proj->data.angle is not set - we apply rotation directly to the node
     // (data.angle doesn't propagate to visuals for stationary projectiles)
 
     // Update scene node transforms
-    UpdateNodeTransform();
+    UpdateNodeTransform(node, transform);
 }
 
 bool GameProjectile::ValidateProjectileExists(bool clearIfInvalid) {
@@ -196,6 +219,7 @@ bool GameProjectile::ValidateProjectileExists(bool clearIfInvalid) {
         if (clearIfInvalid) {
             m_projectile = nullptr;
             m_refHandle = 0;
+            m_hookProjectile.store(nullptr, std::memory_order_release);
         }
     }
 
@@ -210,31 +234,22 @@ void GameProjectile::ZeroVelocity() {
     }
 }
 
-void GameProjectile::UpdateNodeTransform() {
-    if (!m_projectile) {
-        return;
-    }
-
-    auto* node = m_projectile->Get3D();
-    if (!node) {
-        return;
-    }
-
+void GameProjectile::UpdateNodeTransform(RE::NiAVObject* node, const ProjectileTransform& transform) {
     // Update node position
-    node->local.translate = m_targetTransform.position;
-    node->world.translate = m_targetTransform.position;
+    node->local.translate = transform.position;
+    node->world.translate = transform.position;
 
     // Update scale
-    float effectiveScale = m_visible ? m_targetTransform.scale : 0.00001f;
+    float effectiveScale = IsVisible() ? transform.scale : 0.00001f;
     node->local.scale = effectiveScale;
 
     // Update rotation - apply matrix directly to node
     // (rotation is now stored as matrix in ProjectileTransform)
-    node->local.rotate = m_targetTransform.rotation;
+    node->local.rotate = transform.rotation;
 }
 
 void GameProjectile::SetVisible(bool visible) {
-    m_visible = visible;
+    m_visible.store(visible, std::memory_order_relaxed);
     // Visibility will be applied on next ApplyTransform() call via scale
 }
 
@@ -257,14 +272,14 @@ void GameProjectile::ApplyPendingTexture() {
     // Check if we've exceeded the retry limit
     if (m_textureRetryCount > MAX_TEXTURE_RETRIES) {
         spdlog::error("GameProjectile::ApplyPendingTexture - Exceeded {} retries for texture '{}', giving up",
-            MAX_TEXTURE_RETRIES, m_texturePath);
+            MAX_TEXTURE_RETRIES, m_texturePath.view());
         m_needsTextureSet = false;
         m_textureRetryCount = 0;
         return;
     }
 
     spdlog::trace("GameProjectile::ApplyPendingTexture - projFormID={:x} refHandle={:x} texture='{}' (attempt {}/{})",
-        m_projectile ? m_projectile->GetFormID() : 0, m_refHandle, m_texturePath,
+        m_projectile ? m_projectile->GetFormID() : 0, m_refHandle, m_texturePath.view(),
         m_textureRetryCount, MAX_TEXTURE_RETRIES);
 
     // icon_template.nif structure: BSFadeNode → container → geometry nodes
@@ -282,21 +297,47 @@ void GameProjectile::ApplyPendingTexture() {
 
     spdlog::trace("GameProjectile::ApplyPendingTexture - Found {} geometry nodes, applying texture", charNodes.size());
 
+    // Visible icons nearest the HMD load first
+    float priority = TextureRequestQueue::MakePriority(IsVisible(),
+        m_targetTransform.position.GetDistance(GameProjectileUtils::GetHMDPosition()));
+
+    // Shared atlas page when enabled - its source texture may still be loading
+    IconAtlas::Entry atlasEntry;
+    auto atlasStatus = IconAtlas::GetSingleton().Acquire(m_texturePath, priority, atlasEntry);
+    if (atlasStatus == IconAtlas::Status::Pending) {
+        --m_textureRetryCount;  // Waiting on the load isn't a failed attempt
+        return;
+    }
+
     // Apply texture to all geometry nodes in the icon
+    CancelTextureRequests();
     bool success = false;
     for (auto* charNode : charNodes) {
-        if (TextureManipulator::SetTexture(charNode, m_texturePath.c_str())) {
+        if (atlasStatus == IconAtlas::Status::Placed) {
+            if (TextureManipulator::SetAtlasTexture(charNode, atlasEntry.page, atlasEntry.uv)) {
+                success = true;
+            }
+            continue;
+        }
+
+        TextureRequestToken token;
+        if (TextureManipulator::SetTexture(charNode, m_texturePath.c_str(), priority, &token)) {
             success = true;
         }
+        if (token.IsValid()) {
+            m_textureRequests.push_back(token);
+        }
     }
 
     if (success) {
+        // An atlased icon lives on its page - its source texture needn't stay cached
+        SetPinnedTexture(atlasStatus == IconAtlas::Status::Placed ? InternedString() : m_texturePath);
         m_needsTextureSet = false;
         m_textureRetryCount = 0;
         spdlog::trace("GameProjectile::ApplyPendingTexture - SUCCESS, texture applied for projFormID={:x}",
             m_projectile ? m_projectile->GetFormID() : 0);
     } else {
-        spdlog::error("GameProjectile::ApplyPendingTexture - FAILED to apply texture '{}', will retry", m_texturePath);
+        spdlog::error("GameProjectile::ApplyPendingTexture - FAILED to apply texture '{}', will retry", m_texturePath.view());
     }
 #else
     // Stub for test environment - just clear the flag
@@ -305,13 +346,22 @@ void GameProjectile::ApplyPendingTexture() {
 #endif
 }
 
-void GameProjectile::SetModelPath(const std::string& path) {
+InternedString GameProjectile::DefaultModelPath() {
+    static const InternedString s_path("meshes\\clutter\\dwemer\\centuriondynamocore01.nif");
+    return s_path;
+}
+
+void GameProjectile::SetModelPath(InternedString path) {
     m_modelPath = path;
     // Note: Model path must be set on the BGSProjectile form before firing
     // This is stored here for reference and should be used during spawn setup
 }
 
-void GameProjectile::SetTexturePath(const std::string& path) {
+void GameProjectile::SetTexturePath(InternedString path) {
+    if (path != m_texturePath) {
+        CancelTextureRequests();  // Superseded - don't load (or swap in) the old texture
+        SetPinnedTexture(InternedString());
+    }
     m_texturePath = path;
     if (!path.empty()) {
         m_needsTextureSet = true;
@@ -319,7 +369,35 @@ void GameProjectile::SetTexturePath(const std::string& path) {
     }
 }
 
-void GameProjectile::SetBorderColor(const std::string& hexColor) {
+void GameProjectile::CancelTextureRequests() {
+#if !defined(TEST_ENVIRONMENT)
+    if (!m_textureRequests.empty()) {
+        auto& loader = AsyncTextureLoader::GetInstance();
+        for (auto& token : m_textureRequests) {
+            loader.Cancel(token);
+        }
+    }
+#endif
+    m_textureRequests.clear();
+}
+
+void GameProjectile::SetPinnedTexture(InternedString path) {
+    if (path == m_pinnedTexture) {
+        return;
+    }
+#if !defined(TEST_ENVIRONMENT)
+    auto& loader = AsyncTextureLoader::GetInstance();
+    if (!path.empty()) {
+        loader.PinTexture(path);
+    }
+    if (!m_pinnedTexture.empty()) {
+        loader.UnpinTexture(m_pinnedTexture);
+    }
+#endif
+    m_pinnedTexture = path;
+}
+
+void GameProjectile::SetBorderColor(InternedString hexColor) {
     m_borderColor = hexColor;
 }
 
@@ -333,9 +411,12 @@ void GameProjectile::PreventDestruction() {
         spdlog::warn("GameProjectile::PreventDestruction - m_projectile is null, returning early");
         return;
     }
+    PreventDestruction(m_projectile);
+}
 
+void GameProjectile::PreventDestruction(RE::Projectile* proj) {
     // === One-time form setup (only logs once per projectile) ===
-    auto* baseObj = m_projectile->GetBaseObject();
+    auto* baseObj = proj->GetBaseObject();
     if (baseObj) {
         auto* projForm = baseObj->As<RE::BGSProjectile>();
         if (projForm) {
@@ -354,11 +435,23 @@ void GameProjectile::PreventDestruction() {
     }
 
     // === Per-frame: Zero velocity to keep projectile stationary ===
-    auto& runtimeData = m_projectile->GetProjectileRuntimeData();
+    auto& runtimeData = proj->GetProjectileRuntimeData();
     runtimeData.linearVelocity = RE::NiPoint3(0.0f, 0.0f, 0.0f);
     runtimeData.velocity = RE::NiPoint3(0.0f, 0.0f, 0.0f);
 }
 
+void GameProjectile::HoldParked(RE::Projectile* proj) {
+    if (!proj) {
+        return;
+    }
+    PreventDestruction(proj);
+
+    // Same hidden scale as an invisible bound projectile; position stays where it was launched
+    if (auto* node = proj->Get3D()) {
+        node->local.scale = 0.00001f;
+    }
+}
+
 // =============================================================================
 // Utility implementations
 // =============================================================================
@@ -374,6 +467,14 @@ uint32_t GetOrCreateRefHandle(RE::Projectile* proj) {
     return static_cast<bool>(handle) ? handle.native_handle() : 0;
 }
 
+bool IsHandleValid(RE::Projectile* proj, uint32_t refHandle) {
+    if (!proj || refHandle == 0) {
+        return false;
+    }
+    auto refPtr = RE::TESObjectREFR::LookupByHandle(refHandle);
+    return refPtr && static_cast<void*>(refPtr.get()) == static_cast<void*>(proj);
+}
+
 void GetAttitudeAndHeading(const RE::NiPoint3& from, const RE::NiPoint3& to,
                            float& outAttitude, float& outHeading) {
     float x = to.x - from.x;
@@ -6,8 +6,15 @@
 #include "TestStubs.h"
 #endif
 
+#include "../util/StringTable.h"
+#include "TextureRequestQueue.h"
+
+#include <array>
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <cstdint>
+#include <vector>
 
 namespace Projectile {
 
@@ -27,6 +34,67 @@ struct ProjectileTransform {
     float scale = 1.0f;
 };
 
+// Single-writer, multi-reader seqlock mailbox for a ProjectileTransform.
+// The main thread publishes the latest transform once per frame; the projectile hook reads
+// the latest complete value without taking any lock, whichever thread the engine runs it on.
+// Publish never blocks. Read only retries if it overlapped a Publish (one per frame).
+class TransformMailbox {
+public:
+    TransformMailbox() { Publish(ProjectileTransform{}); }
+
+    void Publish(const ProjectileTransform& transform) {
+        uint32_t seq = m_sequence.load(std::memory_order_relaxed);
+        m_sequence.store(seq + 1, std::memory_order_relaxed);  // Odd = write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+
+        const auto& rot = transform.rotation.entry;
+        const float values[FLOAT_COUNT] = {
+            transform.position.x, transform.position.y, transform.position.z,
+            rot[0][0], rot[0][1], rot[0][2],
+            rot[1][0], rot[1][1], rot[1][2],
+            rot[2][0], rot[2][1], rot[2][2],
+            transform.scale
+        };
+        for (size_t i = 0; i < FLOAT_COUNT; ++i) {
+            m_data[i].store(values[i], std::memory_order_relaxed);
+        }
+
+        m_sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    ProjectileTransform Read() const {
+        float values[FLOAT_COUNT];
+        uint32_t before, after;
+        do {
+            before = m_sequence.load(std::memory_order_acquire);
+            for (size_t i = 0; i < FLOAT_COUNT; ++i) {
+                values[i] = m_data[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = m_sequence.load(std::memory_order_relaxed);
+        } while ((before & 1) != 0 || before != after);
+
+        ProjectileTransform transform;
+        transform.position = RE::NiPoint3(values[0], values[1], values[2]);
+        for (int row = 0; row < 3; ++row) {
+            for (int col = 0; col < 3; ++col) {
+                transform.rotation.entry[row][col] = values[3 + row * 3 + col];
+            }
+        }
+        transform.scale = values[12];
+        return transform;
+    }
+
+    // Number of completed publishes (for diagnostics/tests)
+    uint32_t GetPublishCount() const { return m_sequence.load(std::memory_order_acquire) / 2 - 1; }
+
+private:
+    static constexpr size_t FLOAT_COUNT = 13;  // position(3) + rotation(9) + scale(1)
+
+    std::atomic<uint32_t> m_sequence{0};
+    std::array<std::atomic<float>, FLOAT_COUNT> m_data{};
+};
+
 // Low-level abstraction over game projectile objects
 // This class manages the direct interaction with Skyrim's Projectile class
 // and its associated NiNode scene graph
@@ -57,27 +125,39 @@ public:
     uint32_t GetRefHandle() const { return m_refHandle; }
 
     // Transform manipulation (applied each frame via hook)
+    // SetTransform publishes to the mailbox read by ApplyTransform - call from the main thread only
     void SetTransform(const ProjectileTransform& transform);
     const ProjectileTransform& GetTargetTransform() const { return m_targetTransform; }
 
-    // Apply the current transform to the game projectile
-    // Called from the projectile update hook
+    // Apply the latest published transform to the bound game projectile (main thread)
     void ApplyTransform();
 
+    // Hook entry: apply the latest published transform to proj, the projectile the hook is
+    // updating. Reads only the mailbox and atomics, never the main thread's binding fields.
+    void ApplyTransform(RE::Projectile* proj);
+
+    // True if proj is the projectile currently bound (safe from the hook thread)
+    bool IsBoundTo(RE::Projectile* proj) const {
+        return proj && m_hookProjectile.load(std::memory_order_acquire) == proj;
+    }
+
     // Visibility control
     void SetVisible(bool visible);
-    bool IsVisible() const { return m_visible; }
+    bool IsVisible() const { return m_visible.load(std::memory_order_relaxed); }
 
     // Model/mesh control (set before spawning)
-    void SetModelPath(const std::string& path);
-    const std::string& GetModelPath() const { return m_modelPath; }
+    void SetModelPath(InternedString path);
+    void SetModelPath(std::string_view path) { SetModelPath(InternedString(path)); }
+    InternedString GetModelPath() const { return m_modelPath; }
 
     // Texture-based display (alternative to custom model)
     // When set, uses BasicPicture.nif and applies the texture to "Picture" node
-    void SetTexturePath(const std::string& path);
-    const std::string& GetTexturePath() const { return m_texturePath; }
-    void SetBorderColor(const std::string& hexColor);
-    const std::string& GetBorderColor() const { return m_borderColor; }
+    void SetTexturePath(InternedString path);
+    void SetTexturePath(std::string_view path) { SetTexturePath(InternedString(path)); }
+    InternedString GetTexturePath() const { return m_texturePath; }
+    void SetBorderColor(InternedString hexColor);
+    void SetBorderColor(std::string_view hexColor) { SetBorderColor(InternedString(hexColor)); }
+    InternedString GetBorderColor() const { return m_borderColor; }
     bool NeedsTextureSet() const { return m_needsTextureSet; }
     void ClearTextureSetFlag() { m_needsTextureSet = false; }
 
@@ -90,38 +170,56 @@ public:
     void MarkForDeletion();
     bool IsMarkedForDeletion() const { return m_markedForDeletion; }
 
+    // Keep a projectile nobody is bound to alive, still and invisible (warm pool entries,
+    // see ProjectileSubsystem). Called from the projectile update hook like ApplyTransform.
+    static void HoldParked(RE::Projectile* proj);
+
     // Timestamp for pool recycling (when was this last assigned)
     void SetAssignmentTime(uint64_t time) { m_assignmentTime = time; }
     uint64_t GetAssignmentTime() const { return m_assignmentTime; }
 
 private:
+    static InternedString DefaultModelPath();
     void ZeroVelocity();
-    void UpdateNodeTransform();
+    void UpdateNodeTransform(RE::NiAVObject* node, const ProjectileTransform& transform);
 
     // Validates that m_projectile still exists in the game world by checking refHandle.
     // Returns true if projectile is valid, false if game destroyed it.
-    // If invalid and clearIfInvalid=true, clears m_projectile and m_refHandle.
+    // If invalid and clearIfInvalid=true, clears the binding. Main thread only.
     bool ValidateProjectileExists(bool clearIfInvalid = true);
 
+    // Cancel texture swaps still waiting on AsyncTextureLoader - their callbacks hold
+    // pointers into this projectile's nodes
+    void CancelTextureRequests();
+
+    // Pin path in the texture cache while it's displayed (empty = release the current pin)
+    void SetPinnedTexture(InternedString path);
+
     // Prevents the game from destroying the projectile by:
     // 1. Setting very high range on the BGSProjectile form
     // 2. Resetting runtime traveled distance (range) to 0
     // 3. Resetting living time to 0
     // 4. Zeroing gravity and velocity
-    // Called during binding and each frame in ApplyTransform.
+    // Called during binding and each frame in ApplyTransform (and HoldParked).
+    // The member version reads m_projectile, so the hook uses the static one.
     void PreventDestruction();
+    static void PreventDestruction(RE::Projectile* proj);
 
-    RE::Projectile* m_projectile = nullptr;
-    uint32_t m_refHandle = 0;
+    RE::Projectile* m_projectile = nullptr;  // Main thread only
+    uint32_t m_refHandle = 0;                 // Main thread only
+    std::atomic<RE::Projectile*> m_hookProjectile{nullptr};  // m_projectile, published for the hook
 
-    ProjectileTransform m_targetTransform;
-    std::string m_modelPath = "meshes\\clutter\\dwemer\\centuriondynamocore01.nif";
-    std::string m_texturePath;       // For image-based display
-    std::string m_borderColor;       // Hex color for border (e.g., "ff0000")
+    ProjectileTransform m_targetTransform;  // Writer-side copy (main thread)
+    TransformMailbox m_transformMailbox;    // Published copy read by the hook
+    InternedString m_modelPath = DefaultModelPath();
+    InternedString m_texturePath;    // For image-based display
+    InternedString m_borderColor;    // Hex color for border (e.g., "ff0000")
     bool m_needsTextureSet = false;  // Flag for pending texture application
     int m_textureRetryCount = 0;     // Counter for texture application retries
+    std::vector<TextureRequestToken> m_textureRequests;  // Pending async swaps, one per geometry node
+    InternedString m_pinnedTexture;  // Kept from cache eviction while bound and applied
     static constexpr int MAX_TEXTURE_RETRIES = 50;  // Give up after this many attempts
-    bool m_visible = true;
+    std::atomic<bool> m_visible{true};  // Written on main thread, read by the hook
     bool m_markedForDeletion = false;
     uint64_t m_assignmentTime = 0;
 };
@@ -131,6 +229,9 @@ namespace GameProjectileUtils {
     // Get or create a reference handle for a projectile
     uint32_t GetOrCreateRefHandle(RE::Projectile* proj);
 
+    // True if refHandle still resolves to proj (the game hasn't destroyed it)
+    bool IsHandleValid(RE::Projectile* proj, uint32_t refHandle);
+
     // Calculate heading angle from one point to another (for billboarding)
     void GetAttitudeAndHeading(const RE::NiPoint3& from, const RE::NiPoint3& to,
                                float& outAttitude, float& outHeading);
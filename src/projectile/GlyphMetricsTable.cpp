@@ -0,0 +1,227 @@
+#include "GlyphMetricsTable.h"
+
+#include <algorithm>
+#include <bit>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace Projectile {
+
+namespace {
+    // Split one CSV line, honouring quoted fields ("," and """" are characters in the mapping)
+    std::vector<std::string> SplitCSVLine(const std::string& line) {
+        std::vector<std::string> fields(1);
+        bool quoted = false;
+        for (size_t i = 0; i < line.size(); ++i) {
+            char c = line[i];
+            if (quoted) {
+                if (c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+                    fields.back() += '"';
+                    ++i;
+                } else if (c == '"') {
+                    quoted = false;
+                } else {
+                    fields.back() += c;
+                }
+            } else if (c == '"') {
+                quoted = true;
+            } else if (c == ',') {
+                fields.emplace_back();
+            } else if (c != '\r') {
+                fields.back() += c;
+            }
+        }
+        return fields;
+    }
+
+    // "U+XXXX" -> codepoint, 0 if malformed
+    uint32_t ParseUnicode(const std::string& field) {
+        if (field.size() < 6 || field[0] != 'U' || field[1] != '+') {
+            return 0;
+        }
+        try {
+            return static_cast<uint32_t>(std::stoul(field.substr(2), nullptr, 16));
+        } catch (...) {
+            return 0;
+        }
+    }
+
+    template <class T>
+    void WriteLE(std::ostream& out, T value) {
+        // Every supported target is little-endian
+        auto raw = std::bit_cast<std::array<unsigned char, sizeof(T)>>(value);
+        out.write(reinterpret_cast<const char*>(raw.data()), sizeof(T));
+    }
+
+    template <class T>
+    bool ReadLE(std::istream& in, T& value) {
+        std::array<unsigned char, sizeof(T)> raw;
+        if (!in.read(reinterpret_cast<char*>(raw.data()), sizeof(T))) {
+            return false;
+        }
+        value = std::bit_cast<T>(raw);
+        return true;
+    }
+}
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+GlyphMetricsTable::GlyphMetricsTable(const std::vector<Entry>& entries) {
+    // Dedupe (last wins) and sort
+    std::map<uint32_t, Glyph> glyphs;
+    for (const auto& entry : entries) {
+        glyphs[entry.codepoint] = entry.glyph;
+    }
+
+    std::array<size_t, 256> pageCounts{};
+    for (const auto& [codepoint, glyph] : glyphs) {
+        if (codepoint <= 0xFFFF) {
+            ++pageCounts[codepoint >> 8];
+        }
+        m_atlasCols = (std::max)(m_atlasCols, glyph.uv.col + 1);
+        m_atlasRows = (std::max)(m_atlasRows, glyph.uv.row + 1);
+    }
+
+    Glyph emptySlot;
+    emptySlot.uv.col = -1;
+    for (size_t page = 0; page < pageCounts.size(); ++page) {
+        if (pageCounts[page] >= DENSE_PAGE_MIN) {
+            m_pageIndex[page] = static_cast<uint16_t>(m_slots.size() >> 8);
+            m_slots.resize(m_slots.size() + 256, emptySlot);
+        }
+    }
+
+    for (const auto& [codepoint, glyph] : glyphs) {
+        if (codepoint <= 0xFFFF && m_pageIndex[codepoint >> 8] != NO_PAGE) {
+            m_slots[(static_cast<size_t>(m_pageIndex[codepoint >> 8]) << 8) | (codepoint & 0xFF)] = glyph;
+        } else {
+            m_sparse.push_back({codepoint, glyph});
+        }
+    }
+    m_glyphCount = glyphs.size();
+}
+
+const GlyphMetricsTable::Glyph* GlyphMetricsTable::FindSparse(uint32_t codepoint) const {
+    auto it = std::lower_bound(m_sparse.begin(), m_sparse.end(), codepoint,
+        [](const Entry& entry, uint32_t value) { return entry.codepoint < value; });
+    return it != m_sparse.end() && it->codepoint == codepoint ? &it->glyph : nullptr;
+}
+
+std::vector<GlyphMetricsTable::Entry> GlyphMetricsTable::GetEntries() const {
+    std::vector<Entry> entries;
+    entries.reserve(m_glyphCount);
+    for (size_t page = 0; page < m_pageIndex.size(); ++page) {
+        if (m_pageIndex[page] == NO_PAGE) {
+            continue;
+        }
+        for (uint32_t slot = 0; slot < 256; ++slot) {
+            const Glyph& glyph = m_slots[(static_cast<size_t>(m_pageIndex[page]) << 8) | slot];
+            if (glyph.uv.col >= 0) {
+                entries.push_back({static_cast<uint32_t>(page << 8) | slot, glyph});
+            }
+        }
+    }
+    entries.insert(entries.end(), m_sparse.begin(), m_sparse.end());
+    std::sort(entries.begin(), entries.end(),
+        [](const Entry& a, const Entry& b) { return a.codepoint < b.codepoint; });
+    return entries;
+}
+
+// =============================================================================
+// CSV
+// =============================================================================
+
+std::optional<GlyphMetricsTable> GlyphMetricsTable::ParseCSV(std::istream& in) {
+    std::string line;
+    // Skip header line
+    if (!std::getline(in, line)) {
+        return std::nullopt;
+    }
+
+    std::vector<Entry> entries;
+    while (std::getline(in, line)) {
+        if (line.empty() || line == "\r") {
+            continue;
+        }
+
+        // Character,Unicode,Index,Row,Col,X,Y,Width,WidthRatio
+        auto fields = SplitCSVLine(line);
+        if (fields.size() < 9 || fields[8].empty()) {
+            continue;
+        }
+
+        // Unicode column first; the character itself only if it's a single byte
+        uint32_t codepoint = ParseUnicode(fields[1]);
+        if (codepoint == 0 && fields[0].size() == 1) {
+            codepoint = static_cast<unsigned char>(fields[0][0]);
+        }
+        if (codepoint == 0) {
+            continue;
+        }
+
+        try {
+            Entry entry;
+            entry.codepoint = codepoint;
+            entry.glyph.uv = TextAssets::UVCoord(std::stoi(fields[4]), std::stoi(fields[3]));
+            entry.glyph.widthRatio = std::stof(fields[8]);
+            if (entry.glyph.uv.col >= 0 && entry.glyph.uv.row >= 0) {
+                entries.push_back(entry);
+            }
+        } catch (...) {
+            // Skip invalid lines
+        }
+    }
+
+    return GlyphMetricsTable(entries);
+}
+
+// =============================================================================
+// Binary
+// =============================================================================
+
+bool GlyphMetricsTable::WriteBinary(std::ostream& out) const {
+    auto entries = GetEntries();
+    WriteLE(out, BINARY_MAGIC);
+    WriteLE(out, BINARY_VERSION);
+    WriteLE(out, static_cast<uint32_t>(entries.size()));
+    for (const auto& entry : entries) {
+        WriteLE(out, entry.codepoint);
+        WriteLE(out, static_cast<uint16_t>(entry.glyph.uv.row));
+        WriteLE(out, static_cast<uint16_t>(entry.glyph.uv.col));
+        WriteLE(out, entry.glyph.widthRatio);
+    }
+    return static_cast<bool>(out);
+}
+
+std::optional<GlyphMetricsTable> GlyphMetricsTable::ReadBinary(std::istream& in) {
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint32_t count = 0;
+    if (!ReadLE(in, magic) || magic != BINARY_MAGIC ||
+        !ReadLE(in, version) || version != BINARY_VERSION ||
+        !ReadLE(in, count)) {
+        return std::nullopt;
+    }
+
+    std::vector<Entry> entries;
+    entries.reserve((std::min)(count, 0x10000u));
+    for (uint32_t i = 0; i < count; ++i) {
+        Entry entry;
+        uint16_t row = 0;
+        uint16_t col = 0;
+        if (!ReadLE(in, entry.codepoint) || !ReadLE(in, row) || !ReadLE(in, col) ||
+            !ReadLE(in, entry.glyph.widthRatio)) {
+            return std::nullopt;
+        }
+        entry.glyph.uv = TextAssets::UVCoord(col, row);
+        entries.push_back(entry);
+    }
+
+    return GlyphMetricsTable(entries);
+}
+
+} // namespace Projectile
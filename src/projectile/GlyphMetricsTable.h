@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <vector>
+
+#include "TextAssets.h"
+
+namespace Projectile {
+
+// =============================================================================
+// GlyphMetricsTable
+// Per-character atlas cell and width ratio, built once when metrics load and read on
+// every layout pass.
+//
+// BMP characters live in 256-entry pages indexed directly by codepoint: a page lookup,
+// then a slot. Only pages holding at least DENSE_PAGE_MIN glyphs get slots; characters in
+// sparser pages (a lone U+20AC) and beyond the BMP go in a sorted fallback array that is
+// binary searched.
+//
+// Loads from the atlas mapping CSV or from the binary file generate_atlas.py writes
+// next to it (see WriteBinary for the layout).
+// =============================================================================
+class GlyphMetricsTable {
+public:
+    struct Glyph {
+        TextAssets::UVCoord uv;
+        float widthRatio = 0.0f;
+    };
+
+    struct Entry {
+        uint32_t codepoint = 0;
+        Glyph glyph;
+    };
+
+    static constexpr size_t DENSE_PAGE_MIN = 16;
+
+    GlyphMetricsTable() = default;
+
+    // Later entries for the same codepoint replace earlier ones
+    explicit GlyphMetricsTable(const std::vector<Entry>& entries);
+
+    // Mapping CSV: Character,Unicode,Index,Row,Col,X,Y,Width,WidthRatio (header line first).
+    // Rows without a usable codepoint, cell or width ratio are skipped; nullopt if the stream
+    // has no header.
+    static std::optional<GlyphMetricsTable> ParseCSV(std::istream& in);
+
+    // nullopt on a bad magic/version or a truncated file
+    static std::optional<GlyphMetricsTable> ReadBinary(std::istream& in);
+
+    // Little-endian: "3DGM", uint32 version, uint32 count, then per glyph
+    // uint32 codepoint, uint16 row, uint16 col, float32 widthRatio
+    bool WriteBinary(std::ostream& out) const;
+
+    const Glyph* Find(uint32_t codepoint) const {
+        if (codepoint <= 0xFFFF) {
+            uint16_t page = m_pageIndex[codepoint >> 8];
+            if (page != NO_PAGE) {
+                const Glyph& glyph = m_slots[(static_cast<size_t>(page) << 8) | (codepoint & 0xFF)];
+                return glyph.uv.col >= 0 ? &glyph : nullptr;
+            }
+        }
+        return FindSparse(codepoint);
+    }
+
+    // All glyphs, sorted by codepoint
+    std::vector<Entry> GetEntries() const;
+
+    size_t GetGlyphCount() const { return m_glyphCount; }
+    size_t GetDensePageCount() const { return m_slots.size() >> 8; }
+    size_t GetSparseCount() const { return m_sparse.size(); }
+    bool IsEmpty() const { return m_glyphCount == 0; }
+
+    // Derived from the largest row/col present
+    int GetAtlasCols() const { return m_atlasCols; }
+    int GetAtlasRows() const { return m_atlasRows; }
+
+private:
+    static constexpr uint16_t NO_PAGE = 0xFFFF;
+    static constexpr uint32_t BINARY_MAGIC = 0x4D474433;  // "3DGM"
+    static constexpr uint32_t BINARY_VERSION = 1;
+
+    const Glyph* FindSparse(uint32_t codepoint) const;
+
+    std::array<uint16_t, 256> m_pageIndex = MakeEmptyPageIndex();
+    std::vector<Glyph> m_slots;    // 256 per dense page; uv.col < 0 marks an empty slot
+    std::vector<Entry> m_sparse;   // Sorted by codepoint
+    size_t m_glyphCount = 0;
+    int m_atlasCols = 0;
+    int m_atlasRows = 0;
+
+    static std::array<uint16_t, 256> MakeEmptyPageIndex() {
+        std::array<uint16_t, 256> index;
+        index.fill(NO_PAGE);
+        return index;
+    }
+};
+
+} // namespace Projectile
@@ -0,0 +1,170 @@
+#include "HoverSpatialIndex.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Projectile {
+
+namespace {
+    // Cell coordinates are packed into 21 bits per axis. Distant cells may share a key;
+    // that only adds candidates, which the exact distance test filters out.
+    constexpr int64_t CELL_BITS = 21;
+    constexpr uint64_t CELL_MASK = (uint64_t{1} << CELL_BITS) - 1;
+    constexpr float MAX_CELL_COORD = 1.0e12f;
+}
+
+void HoverSpatialIndex::SetCellSize(float cellSize) {
+    if (!std::isfinite(cellSize) || cellSize <= 0.0f || cellSize == m_cellSize) {
+        return;
+    }
+    m_cellSize = cellSize;
+    m_inverseCellSize = 1.0f / cellSize;
+
+    // Re-bucket everything under the new cell size
+    m_cells.clear();
+    for (uint32_t id = 0; id < m_elements.size(); ++id) {
+        auto& element = m_elements[id];
+        if (element.cell != NO_CELL) {
+            element.cell = CellFor(element.position);
+            AddToCell(element.cell, id);
+        }
+    }
+}
+
+void HoverSpatialIndex::Resize(size_t count) {
+    for (size_t id = count; id < m_elements.size(); ++id) {
+        if (m_elements[id].cell != NO_CELL) {
+            RemoveFromCell(m_elements[id].cell, static_cast<uint32_t>(id));
+        }
+    }
+    m_elements.resize(count);
+}
+
+void HoverSpatialIndex::Clear() {
+    m_elements.clear();
+    m_cells.clear();
+}
+
+void HoverSpatialIndex::SetPosition(uint32_t id, const RE::NiPoint3& position) {
+    if (id >= m_elements.size()) {
+        return;
+    }
+    auto& element = m_elements[id];
+    if (element.cell != NO_CELL && position == element.position) {
+        return;  // Unmoved (e.g. element at rest)
+    }
+
+    CellKey cell = NO_CELL;
+    if (std::isfinite(position.x) && std::isfinite(position.y) && std::isfinite(position.z)) {
+        cell = CellFor(position);
+    }
+
+    element.position = position;
+    if (cell == element.cell) {
+        return;  // Same cell - refit in place
+    }
+    if (element.cell != NO_CELL) {
+        RemoveFromCell(element.cell, id);
+    }
+    if (cell != NO_CELL) {
+        AddToCell(cell, id);
+    }
+    element.cell = cell;
+}
+
+void HoverSpatialIndex::QueryNearest(const RE::NiPoint3& center, float maxDistance, size_t k,
+                                     std::vector<Neighbor>& out) const {
+    out.clear();
+    if (k == 0 || m_elements.empty() || !(maxDistance >= 0.0f)) {
+        return;
+    }
+
+    auto consider = [&](uint32_t id) {
+        const RE::NiPoint3& pos = m_elements[id].position;
+        float dx = pos.x - center.x;
+        float dy = pos.y - center.y;
+        float dz = pos.z - center.z;
+        float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+        if (dist <= maxDistance) {
+            out.push_back({id, dist});
+        }
+    };
+
+    int64_t minX = CellCoord(center.x - maxDistance), maxX = CellCoord(center.x + maxDistance);
+    int64_t minY = CellCoord(center.y - maxDistance), maxY = CellCoord(center.y + maxDistance);
+    int64_t minZ = CellCoord(center.z - maxDistance), maxZ = CellCoord(center.z + maxDistance);
+    double cellCount = double(maxX - minX + 1) * double(maxY - minY + 1) * double(maxZ - minZ + 1);
+
+    if (!std::isfinite(maxDistance) || cellCount > double(m_elements.size())) {
+        // Query is coarse relative to the grid - scanning elements is cheaper (and avoids
+        // visiting aliased cell keys twice)
+        for (uint32_t id = 0; id < m_elements.size(); ++id) {
+            if (m_elements[id].cell != NO_CELL) {
+                consider(id);
+            }
+        }
+    } else {
+        for (int64_t x = minX; x <= maxX; ++x) {
+            for (int64_t y = minY; y <= maxY; ++y) {
+                for (int64_t z = minZ; z <= maxZ; ++z) {
+                    auto it = m_cells.find(PackCell(x, y, z));
+                    if (it == m_cells.end()) {
+                        continue;
+                    }
+                    for (uint32_t id : it->second) {
+                        consider(id);
+                    }
+                }
+            }
+        }
+    }
+
+    // Ties broken by id so results don't depend on cell iteration order
+    auto closer = [](const Neighbor& a, const Neighbor& b) {
+        return a.distance < b.distance || (a.distance == b.distance && a.id < b.id);
+    };
+    if (out.size() > k) {
+        std::partial_sort(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(k), out.end(), closer);
+        out.resize(k);
+    } else {
+        std::sort(out.begin(), out.end(), closer);
+    }
+}
+
+HoverSpatialIndex::CellKey HoverSpatialIndex::PackCell(int64_t x, int64_t y, int64_t z) {
+    return ((static_cast<uint64_t>(x) & CELL_MASK) << (2 * CELL_BITS)) |
+           ((static_cast<uint64_t>(y) & CELL_MASK) << CELL_BITS) |
+           (static_cast<uint64_t>(z) & CELL_MASK);
+}
+
+int64_t HoverSpatialIndex::CellCoord(float value) const {
+    float scaled = std::floor(value * m_inverseCellSize);
+    // Clamp before converting so extreme coordinates can't overflow
+    scaled = std::clamp(scaled, -MAX_CELL_COORD, MAX_CELL_COORD);
+    return static_cast<int64_t>(scaled);
+}
+
+HoverSpatialIndex::CellKey HoverSpatialIndex::CellFor(const RE::NiPoint3& position) const {
+    return PackCell(CellCoord(position.x), CellCoord(position.y), CellCoord(position.z));
+}
+
+void HoverSpatialIndex::AddToCell(CellKey cell, uint32_t id) {
+    m_cells[cell].push_back(id);
+}
+
+void HoverSpatialIndex::RemoveFromCell(CellKey cell, uint32_t id) {
+    auto it = m_cells.find(cell);
+    if (it == m_cells.end()) {
+        return;
+    }
+    auto& ids = it->second;
+    auto found = std::find(ids.begin(), ids.end(), id);
+    if (found != ids.end()) {
+        *found = ids.back();
+        ids.pop_back();
+    }
+    if (ids.empty()) {
+        m_cells.erase(it);
+    }
+}
+
+} // namespace Projectile
@@ -0,0 +1,81 @@
+#pragma once
+
+#if !defined(TEST_ENVIRONMENT)
+#include <RE/Skyrim.h>
+#else
+#include "TestStubs.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Projectile {
+
+// Uniform grid over element world positions, used by InteractionController for hover queries.
+// Elements are identified by a dense id (their index in the caller's element list) and are
+// refit incrementally: an element only changes cell lists when it crosses a cell boundary,
+// so a static or slowly moving menu costs one position update per element per frame.
+//
+// With the cell size at least as large as the query radius, a query touches at most 27 cells
+// regardless of how many elements the menu holds. Queries spanning more cells than there are
+// elements fall back to a linear scan.
+//
+// NOT thread-safe - owned and used by one InteractionController on the main thread.
+class HoverSpatialIndex {
+public:
+    struct Neighbor {
+        uint32_t id;
+        float distance;
+    };
+
+    HoverSpatialIndex() = default;
+
+    // === Configuration ===
+    // Changing the cell size re-buckets every element
+    void SetCellSize(float cellSize);
+    float GetCellSize() const { return m_cellSize; }
+
+    // === Elements ===
+    // Set the element count (ids [0, count)). New elements start unindexed until positioned.
+    void Resize(size_t count);
+    size_t GetSize() const { return m_elements.size(); }
+
+    // Move element `id` to `position`. Non-finite positions leave the element unindexed.
+    void SetPosition(uint32_t id, const RE::NiPoint3& position);
+
+    void Clear();
+
+    // === Queries ===
+    // Up to k nearest elements within maxDistance of center (inclusive), by ascending distance.
+    // Distances are computed exactly like InteractionController's brute-force test
+    // (element - center, then sqrt of the sum of squares), so results are bit-identical.
+    void QueryNearest(const RE::NiPoint3& center, float maxDistance, size_t k,
+                      std::vector<Neighbor>& out) const;
+
+private:
+    using CellKey = uint64_t;
+    static constexpr CellKey NO_CELL = ~CellKey{0};
+
+    struct Element {
+        RE::NiPoint3 position;
+        CellKey cell = NO_CELL;
+    };
+
+    static CellKey PackCell(int64_t x, int64_t y, int64_t z);
+    int64_t CellCoord(float value) const;
+    CellKey CellFor(const RE::NiPoint3& position) const;
+
+    void AddToCell(CellKey cell, uint32_t id);
+    void RemoveFromCell(CellKey cell, uint32_t id);
+
+    float m_cellSize = 10.0f;
+    float m_inverseCellSize = 0.1f;
+    std::vector<Element> m_elements;
+
+    // Cell -> element ids (occupied cells only)
+    std::unordered_map<CellKey, std::vector<uint32_t>> m_cells;
+};
+
+} // namespace Projectile
@@ -162,6 +162,123 @@ inline RE::NiMatrix3 EulerToMatrix(const RE::NiPoint3& euler) {
     return mat;
 }
 
+// Helper to convert a rotation matrix to a unit quaternion (w, x, y, z)
+// Branches on the largest diagonal term to stay numerically stable near 180 degrees
+inline RE::NiQuaternion MatrixToQuaternion(const RE::NiMatrix3& rot) {
+    const auto& m = rot.entry;
+    float trace = m[0][0] + m[1][1] + m[2][2];
+    float w, x, y, z;
+
+    if (trace > 0.0f) {
+        float s = std::sqrt(trace + 1.0f) * 2.0f;  // s = 4w
+        w = 0.25f * s;
+        x = (m[2][1] - m[1][2]) / s;
+        y = (m[0][2] - m[2][0]) / s;
+        z = (m[1][0] - m[0][1]) / s;
+    } else if (m[0][0] > m[1][1] && m[0][0] > m[2][2]) {
+        float s = std::sqrt(1.0f + m[0][0] - m[1][1] - m[2][2]) * 2.0f;  // s = 4x
+        w = (m[2][1] - m[1][2]) / s;
+        x = 0.25f * s;
+        y = (m[0][1] + m[1][0]) / s;
+        z = (m[0][2] + m[2][0]) / s;
+    } else if (m[1][1] > m[2][2]) {
+        float s = std::sqrt(1.0f + m[1][1] - m[0][0] - m[2][2]) * 2.0f;  // s = 4y
+        w = (m[0][2] - m[2][0]) / s;
+        x = (m[0][1] + m[1][0]) / s;
+        y = 0.25f * s;
+        z = (m[1][2] + m[2][1]) / s;
+    } else {
+        float s = std::sqrt(1.0f + m[2][2] - m[0][0] - m[1][1]) * 2.0f;  // s = 4z
+        w = (m[1][0] - m[0][1]) / s;
+        x = (m[0][2] + m[2][0]) / s;
+        y = (m[1][2] + m[2][1]) / s;
+        z = 0.25f * s;
+    }
+
+    return RE::NiQuaternion(w, x, y, z);
+}
+
+// Helper to convert a unit quaternion to a rotation matrix (inverse of MatrixToQuaternion)
+inline RE::NiMatrix3 QuaternionToMatrix(const RE::NiQuaternion& q) {
+    float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    RE::NiMatrix3 mat;
+    mat.entry[0][0] = 1.0f - 2.0f * (yy + zz);
+    mat.entry[0][1] = 2.0f * (xy - wz);
+    mat.entry[0][2] = 2.0f * (xz + wy);
+    mat.entry[1][0] = 2.0f * (xy + wz);
+    mat.entry[1][1] = 1.0f - 2.0f * (xx + zz);
+    mat.entry[1][2] = 2.0f * (yz - wx);
+    mat.entry[2][0] = 2.0f * (xz - wy);
+    mat.entry[2][1] = 2.0f * (yz + wx);
+    mat.entry[2][2] = 1.0f - 2.0f * (xx + yy);
+    return mat;
+}
+
+// Normalized linear interpolation between unit quaternions along the shortest arc
+// Cheap and accurate enough for the small per-frame steps of exponential smoothing
+inline RE::NiQuaternion NlerpQuaternion(const RE::NiQuaternion& a, const RE::NiQuaternion& b, float t) {
+    float dot = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+    float sign = dot < 0.0f ? -1.0f : 1.0f;  // q and -q are the same rotation
+
+    float w = a.w + (b.w * sign - a.w) * t;
+    float x = a.x + (b.x * sign - a.x) * t;
+    float y = a.y + (b.y * sign - a.y) * t;
+    float z = a.z + (b.z * sign - a.z) * t;
+
+    float length = std::sqrt(w * w + x * x + y * y + z * z);
+    if (length < 1e-6f) {
+        return b;
+    }
+    return RE::NiQuaternion(w / length, x / length, y / length, z / length);
+}
+
+// Spherical linear interpolation between unit quaternions along the shortest arc
+// Constant angular velocity; falls back to nlerp when the rotations are nearly equal
+inline RE::NiQuaternion SlerpQuaternion(const RE::NiQuaternion& a, const RE::NiQuaternion& b, float t) {
+    float dot = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+    if (std::abs(dot) > 0.9995f) {
+        return NlerpQuaternion(a, b, t);
+    }
+
+    float sign = dot < 0.0f ? -1.0f : 1.0f;
+    float theta = std::acos(dot * sign);
+    float sinTheta = std::sin(theta);
+    float wa = std::sin((1.0f - t) * theta) / sinTheta;
+    float wb = std::sin(t * theta) / sinTheta * sign;
+
+    return RE::NiQuaternion(
+        a.w * wa + b.w * wb,
+        a.x * wa + b.x * wb,
+        a.y * wa + b.y * wb,
+        a.z * wa + b.z * wb);
+}
+
+// Tolerances for the "at rest" checks that let unchanged elements skip their per-frame update
+constexpr float REST_POSITION_EPSILON = 0.01f;    // Game units
+constexpr float REST_ROTATION_EPSILON = 0.0001f;  // Per matrix entry (~0.006 degrees)
+
+// Helper to compare two points component-wise within epsilon
+inline bool NearlyEqual(const RE::NiPoint3& a, const RE::NiPoint3& b, float epsilon) {
+    return std::abs(a.x - b.x) <= epsilon &&
+           std::abs(a.y - b.y) <= epsilon &&
+           std::abs(a.z - b.z) <= epsilon;
+}
+
+// Helper to compare two rotation matrices entry-wise within epsilon (0 = exact match)
+inline bool NearlyEqual(const RE::NiMatrix3& a, const RE::NiMatrix3& b, float epsilon) {
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            if (std::abs(a.entry[i][j] - b.entry[i][j]) > epsilon) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 // Input event types for the composable hierarchy
 enum class InputEventType {
     HoverEnter,     // Hand entered hover threshold
@@ -221,11 +338,27 @@ public:
 
     // === Local Transform ===
     // Local position relative to parent (or world if no parent)
-    virtual void SetLocalPosition(const RE::NiPoint3& pos) { m_localPosition = pos; }
+    // Setting an unchanged value is a no-op, so layouts that re-apply the same transform
+    // every frame don't wake their (at rest) children or containers
+    virtual void SetLocalPosition(const RE::NiPoint3& pos) {
+        if (pos == m_localPosition) {
+            return;
+        }
+        m_localPosition = pos;
+        InvalidateWorldTransform();
+        WakeUp();
+    }
     virtual RE::NiPoint3 GetLocalPosition() const { return m_localPosition; }
 
     // Local rotation relative to parent (composed up the chain)
-    virtual void SetLocalRotation(const RE::NiMatrix3& rot) { m_localRotation = rot; }
+    virtual void SetLocalRotation(const RE::NiMatrix3& rot) {
+        if (NearlyEqual(rot, m_localRotation, 0.0f)) {
+            return;
+        }
+        m_localRotation = rot;
+        InvalidateWorldTransform();
+        WakeUp();
+    }
 
     // Euler angle overloads (DEGREES) - build rotation matrix internally
     // Uses ZYX convention: euler.x=pitch (Y-axis), euler.y=roll (X-axis), euler.z=yaw (Z-axis)
@@ -235,6 +368,8 @@ public:
             eulerDegrees.x * DEG_TO_RAD,
             eulerDegrees.y * DEG_TO_RAD,
             eulerDegrees.z * DEG_TO_RAD));
+        InvalidateWorldTransform();
+        WakeUp();
     }
     virtual void SetLocalRotation(float pitchDeg, float rollDeg, float yawDeg) {
         constexpr float DEG_TO_RAD = 3.14159265358979323846f / 180.0f;
@@ -242,39 +377,74 @@ public:
             pitchDeg * DEG_TO_RAD,
             rollDeg * DEG_TO_RAD,
             yawDeg * DEG_TO_RAD));
+        InvalidateWorldTransform();
+        WakeUp();
     }
 
     virtual RE::NiMatrix3 GetLocalRotation() const { return m_localRotation; }
 
     // Local scale relative to parent (multiplied up the chain)
-    virtual void SetLocalScale(float scale) { m_localScale = scale; }
+    virtual void SetLocalScale(float scale) {
+        if (scale == m_localScale) {
+            return;
+        }
+        m_localScale = scale;
+        InvalidateWorldTransform();
+        WakeUp();
+    }
     virtual float GetLocalScale() const { return m_localScale; }
 
-    // === World Transform (computed from parent chain) ===
-    // World rotation = Parent.WorldRotation × LocalRotation
+    // === World Transform (cached, computed from parent chain) ===
+    // Getters return the cached world transform, recomputing it from the parent's cached
+    // value when dirty. Each node is composed once per change instead of re-walking the
+    // whole chain on every call, so a frame costs O(nodes) rather than O(nodes x depth).
     virtual RE::NiMatrix3 GetWorldRotation() const {
-        if (m_parent) {
-            return MultiplyMatrices(m_parent->GetWorldRotation(), m_localRotation);
-        }
-        return m_localRotation;
+        EnsureWorldTransform();
+        return m_worldRotation;
     }
 
-    // World position = Parent.WorldPosition + Parent.WorldRotation × LocalPosition
-    // This is the key scene graph formula - parent rotation affects child position
     virtual RE::NiPoint3 GetWorldPosition() const {
-        if (m_parent) {
-            RE::NiMatrix3 parentWorldRot = m_parent->GetWorldRotation();
-            RE::NiPoint3 rotatedLocalPos = RotatePoint(parentWorldRot, m_localPosition);
-            return m_parent->GetWorldPosition() + rotatedLocalPos;
-        }
-        return m_localPosition;
+        EnsureWorldTransform();
+        return m_worldPosition;
     }
 
     virtual float GetWorldScale() const {
+        EnsureWorldTransform();
+        return m_worldScale;
+    }
+
+    // Mark this node's cached world transform (and its descendants') as stale.
+    // Called by the local setters and SetParent; derived classes call it whenever any other
+    // input of ComputeWorld*() changes, and containers override it to propagate to children.
+    // A dirty node's descendants are always dirty, so an already-dirty node can stop here.
+    virtual void InvalidateWorldTransform() {
+        m_worldDirty = true;
+        m_worldChanged = true;
+    }
+    bool IsWorldTransformDirty() const { return m_worldDirty; }
+
+    // True if the world transform was invalidated since the last call (or is still dirty).
+    // Unlike the dirty flag, this isn't cleared by other readers of GetWorld*() - the owning
+    // element consumes it once per frame to decide whether it can stay at rest.
+    bool ConsumeWorldTransformChange() {
+        bool changed = HasWorldTransformChange();
+        m_worldChanged = false;
+        return changed;
+    }
+    bool HasWorldTransformChange() const { return m_worldChanged || m_worldDirty; }
+
+    // === Rest ===
+    // True when the last Update() had nothing to do and the next one won't either until
+    // something wakes this node. Containers skip the layout and update of a subtree whose
+    // children are all at rest; the default never rests, so unknown node types always update.
+    virtual bool IsAtRest() const { return false; }
+
+    // Something changed that a skipped Update() would miss - wakes every resting ancestor.
+    // Called by setters; containers override it to clear their own rest state first.
+    virtual void WakeUp() {
         if (m_parent) {
-            return m_parent->GetWorldScale() * m_localScale;
+            m_parent->WakeUp();
         }
-        return m_localScale;
     }
 
     // === Initialization ===
@@ -307,7 +477,11 @@ public:
     virtual void OnParentHide() {}
 
     // === Parent Management ===
-    virtual void SetParent(IPositionable* parent) { m_parent = parent; }
+    virtual void SetParent(IPositionable* parent) {
+        m_parent = parent;
+        InvalidateWorldTransform();
+        WakeUp();
+    }
     virtual IPositionable* GetParent() const { return m_parent; }
     virtual bool HasParent() const { return m_parent != nullptr; }
 
@@ -343,6 +517,46 @@ public:
     }
 
 protected:
+    // === World Transform Computation ===
+    // Uncached scene graph formulas, evaluated against the parent's (cached) world transform.
+    // Override these - not the GetWorld*() getters - to customize how the world transform is built.
+
+    // World rotation = Parent.WorldRotation × LocalRotation
+    virtual RE::NiMatrix3 ComputeWorldRotation() const {
+        if (m_parent) {
+            return MultiplyMatrices(m_parent->GetWorldRotation(), m_localRotation);
+        }
+        return m_localRotation;
+    }
+
+    // World position = Parent.WorldPosition + Parent.WorldRotation × LocalPosition
+    // This is the key scene graph formula - parent rotation affects child position
+    virtual RE::NiPoint3 ComputeWorldPosition() const {
+        if (m_parent) {
+            RE::NiMatrix3 parentWorldRot = m_parent->GetWorldRotation();
+            RE::NiPoint3 rotatedLocalPos = RotatePoint(parentWorldRot, m_localPosition);
+            return m_parent->GetWorldPosition() + rotatedLocalPos;
+        }
+        return m_localPosition;
+    }
+
+    virtual float ComputeWorldScale() const {
+        if (m_parent) {
+            return m_parent->GetWorldScale() * m_localScale;
+        }
+        return m_localScale;
+    }
+
+    void EnsureWorldTransform() const {
+        if (!m_worldDirty) {
+            return;
+        }
+        m_worldRotation = ComputeWorldRotation();
+        m_worldPosition = ComputeWorldPosition();
+        m_worldScale = ComputeWorldScale();
+        m_worldDirty = false;
+    }
+
     std::string m_id;  // Optional string ID for API lookup
     RE::NiPoint3 m_localPosition{0, 0, 0};
     RE::NiMatrix3 m_localRotation = IdentityMatrix();  // Identity by default
@@ -350,6 +564,13 @@ protected:
     bool m_localVisible = true;  // User's intended visibility (persists across parent cycles)
     IPositionable* m_parent = nullptr;
     UnhandledEventCallback m_unhandledEventCallback;
+
+    // Cached world transform (valid while !m_worldDirty)
+    mutable RE::NiPoint3 m_worldPosition{0, 0, 0};
+    mutable RE::NiMatrix3 m_worldRotation = IdentityMatrix();
+    mutable float m_worldScale = 1.0f;
+    mutable bool m_worldDirty = true;
+    bool m_worldChanged = true;   // Invalidated since the last ConsumeWorldTransformChange()
 };
 
 // Shared handle types for IPositionable
@@ -0,0 +1,214 @@
+#include "IconAtlas.h"
+#include "AsyncTextureLoader.h"
+#include "../log.h"
+#include <d3d11.h>
+#include <format>
+
+namespace Projectile {
+
+namespace {
+    // Native D3D11 texture behind a loaded NiTexture, or nullptr
+    ID3D11Texture2D* GetD3DTexture(RE::NiSourceTexture* texture) {
+        auto* rendererTexture = texture ? texture->rendererTexture : nullptr;
+        return rendererTexture ? reinterpret_cast<ID3D11Texture2D*>(rendererTexture->texture) : nullptr;
+    }
+}
+
+IconAtlas& IconAtlas::GetSingleton() {
+    static IconAtlas instance;
+    return instance;
+}
+
+void IconAtlas::Configure(uint32_t maxPages) {
+    if (maxPages > MAX_PAGES) {
+        spdlog::warn("IconAtlas: iconAtlasMaxPages {} clamped to {}", maxPages, MAX_PAGES);
+        maxPages = MAX_PAGES;
+    }
+
+    IconAtlasLayout::Settings settings;
+    settings.maxPages = maxPages;
+    m_layout.SetSettings(settings);
+    m_enabled = maxPages > 0;
+
+    if (m_enabled) {
+        spdlog::info("IconAtlas: Enabled ({} pages of {}x{} max, icons up to {}px)",
+            settings.maxPages, settings.pageSize, settings.pageSize, settings.maxIconSize);
+    }
+}
+
+IconAtlas::Status IconAtlas::Acquire(InternedString path, float priority, Entry& outEntry) {
+    if (!m_enabled || path.empty() || m_standalone.contains(path)) {
+        return Status::Unavailable;
+    }
+
+    // Fast path: already on a page
+    if (const auto* placement = m_layout.Find(path)) {
+        outEntry = {m_pages[placement->page].carrier.get(), placement->uv};
+        return Status::Placed;
+    }
+
+    // Need the source pixels first
+    auto& loader = AsyncTextureLoader::GetInstance();
+    auto loaded = loader.GetCachedTexture(path);
+    if (!loaded) {
+        if (!m_loading.contains(path)) {
+            m_loading.insert(path);
+            loader.RequestTexture(path,
+                [this, path](RE::NiPointer<RE::NiTexture> texture) {
+                    // Main thread. On success, the next Acquire() finds it in the cache
+                    m_loading.erase(path);
+                    if (!texture) {
+                        MarkStandalone(path, "load failed");
+                    }
+                },
+                priority);
+        }
+        return m_standalone.contains(path) ? Status::Unavailable : Status::Pending;
+    }
+
+    auto* source = netimmerse_cast<RE::NiSourceTexture*>(loaded.get());
+    auto* sourceTexture = GetD3DTexture(source);
+    if (!sourceTexture) {
+        MarkStandalone(path, "no renderer texture");
+        return Status::Unavailable;
+    }
+
+    D3D11_TEXTURE2D_DESC desc{};
+    sourceTexture->GetDesc(&desc);
+    if (desc.ArraySize != 1 || desc.Width % 4 != 0 || desc.Height % 4 != 0) {
+        // Block-compressed copies need whole 4x4 blocks
+        MarkStandalone(path, "unsupported size");
+        return Status::Unavailable;
+    }
+    uint32_t pageMips = m_layout.GetSettings().mipLevels;
+    if (desc.MipLevels < pageMips) {
+        // The page's lower mips would have nothing to show for it
+        MarkStandalone(path, "too few mips");
+        return Status::Unavailable;
+    }
+
+    auto placement = m_layout.Place(path, desc.Width, desc.Height, static_cast<uint32_t>(desc.Format));
+    if (!placement) {
+        MarkStandalone(path, "no room");
+        return Status::Unavailable;
+    }
+
+    if (placement->newPage) {
+        ID3D11Device* device = nullptr;
+        sourceTexture->GetDevice(&device);
+        bool created = CreatePage(device, static_cast<uint32_t>(desc.Format));
+        device->Release();
+        if (!created) {
+            spdlog::error("IconAtlas: Failed to create page - atlas disabled");
+            m_enabled = false;
+            return Status::Unavailable;
+        }
+    }
+
+    // Copy each of the page's mips from the same source mip. The layout aligns rects so every
+    // mip lands on whole blocks inside the icon's cell.
+    auto& page = m_pages[placement->page];
+    ID3D11Device* device = nullptr;
+    page.texture->GetDevice(&device);
+    ID3D11DeviceContext* context = nullptr;
+    device->GetImmediateContext(&context);
+    for (uint32_t mip = 0; mip < pageMips; ++mip) {
+        context->CopySubresourceRegion(page.texture, D3D11CalcSubresource(mip, 0, pageMips),
+            placement->rect.x >> mip, placement->rect.y >> mip, 0,
+            sourceTexture, D3D11CalcSubresource(mip, 0, desc.MipLevels), nullptr);
+    }
+    context->Release();
+    device->Release();
+
+    spdlog::debug("IconAtlas: Placed '{}' ({}x{}) on page {} at {},{}",
+        path.view(), desc.Width, desc.Height, placement->page, placement->rect.x, placement->rect.y);
+
+    outEntry = {page.carrier.get(), placement->uv};
+    return Status::Placed;
+}
+
+bool IconAtlas::CreatePage(ID3D11Device* device, uint32_t format) {
+    // The carrier comes from BSShaderManager's cache under a path only this atlas loads
+    std::string carrierPath = std::format(CARRIER_PATH_FORMAT, m_pages.size());
+    RE::NiPointer<RE::NiTexture> loaded;
+    RE::BSShaderManager::GetTexture(carrierPath.c_str(), true, loaded, false);
+    RE::NiPointer<RE::NiSourceTexture> carrier(netimmerse_cast<RE::NiSourceTexture*>(loaded.get()));
+    auto* carrierTexture = GetD3DTexture(carrier.get());
+    if (!carrierTexture) {
+        spdlog::error("IconAtlas: Carrier texture '{}' missing", carrierPath);
+        return false;
+    }
+    for (const auto& existing : m_pages) {
+        if (existing.carrier == carrier) {
+            // The engine handed back a shared fallback - repointing it would leak the page
+            spdlog::error("IconAtlas: Carrier texture '{}' is not unique", carrierPath);
+            return false;
+        }
+    }
+
+    uint32_t pageSize = m_layout.GetSettings().pageSize;
+    D3D11_TEXTURE2D_DESC desc{};
+    desc.Width = pageSize;
+    desc.Height = pageSize;
+    desc.MipLevels = m_layout.GetSettings().mipLevels;
+    desc.ArraySize = 1;
+    desc.Format = static_cast<DXGI_FORMAT>(format);
+    desc.SampleDesc.Count = 1;
+    desc.Usage = D3D11_USAGE_DEFAULT;
+    desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+    ID3D11Texture2D* pageTexture = nullptr;
+    ID3D11ShaderResourceView* pageView = nullptr;
+    HRESULT hr = device->CreateTexture2D(&desc, nullptr, &pageTexture);
+    if (SUCCEEDED(hr)) {
+        hr = device->CreateShaderResourceView(pageTexture, nullptr, &pageView);
+    }
+    if (FAILED(hr)) {
+        spdlog::error("IconAtlas: CreatePage failed (format={}, hr={:#x})", format, static_cast<uint32_t>(hr));
+        if (pageTexture) {
+            pageTexture->Release();
+        }
+        return false;
+    }
+
+    // Repoint the carrier: it now owns the page. Its placeholder pixels were never shown,
+    // so drop the references it held on them.
+    auto* rendererTexture = carrier->rendererTexture;
+    if (auto* carrierView = reinterpret_cast<ID3D11ShaderResourceView*>(rendererTexture->resourceView)) {
+        carrierView->Release();
+    }
+    carrierTexture->Release();
+    rendererTexture->texture = reinterpret_cast<decltype(rendererTexture->texture)>(pageTexture);
+    rendererTexture->resourceView = reinterpret_cast<decltype(rendererTexture->resourceView)>(pageView);
+
+    Page page;
+    page.carrier = std::move(carrier);
+    page.texture = pageTexture;
+    m_pages.push_back(std::move(page));
+
+    spdlog::info("IconAtlas: Created page {} ({}x{}, format {}, carrier '{}')",
+        m_pages.size() - 1, pageSize, pageSize, format, carrierPath);
+    return true;
+}
+
+void IconAtlas::MarkStandalone(InternedString path, const char* reason) {
+    if (m_standalone.insert(path).second) {
+        spdlog::debug("IconAtlas: '{}' stays standalone ({})", path.view(), reason);
+    }
+}
+
+IconAtlas::Stats IconAtlas::GetStats() const {
+    Stats stats;
+    stats.pages = m_pages.size();
+    stats.icons = m_layout.GetIconCount();
+    stats.standalone = m_standalone.size();
+    for (uint32_t i = 0; i < m_layout.GetPageCount(); ++i) {
+        stats.occupancy += m_layout.GetPageOccupancy(i);
+    }
+    if (m_layout.GetPageCount() > 0) {
+        stats.occupancy /= static_cast<float>(m_layout.GetPageCount());
+    }
+    return stats;
+}
+
+} // namespace Projectile
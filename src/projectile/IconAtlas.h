@@ -0,0 +1,87 @@
+#pragma once
+
+#include "RE/Skyrim.h"
+#include "IconAtlasLayout.h"
+#include <unordered_set>
+#include <vector>
+
+struct ID3D11Texture2D;
+struct ID3D11ShaderResourceView;
+
+namespace Projectile {
+
+// =============================================================================
+// IconAtlas
+// Optional runtime atlas for element icons ([Performance] iconAtlasMaxPages, 0 = off).
+//
+// Once an icon's DDS is loaded (through AsyncTextureLoader), its top mips are copied onto
+// the matching mips of a shared page texture of the same format; elements then bind the page and select their
+// sub-rect via material UVs, so a menu of icons binds a handful of pages instead of one
+// texture per element. Icons that don't fit (too large, odd sizes, too few mips, pages full)
+// stay standalone textures.
+//
+// Each page is shown through its own carrier texture, loaded from a plugin-owned path
+// (CARRIER_PATH_FORMAT) nothing else uses, so repointing it at the page can't leak the page
+// onto anything the game or icons load by path. One carrier DDS ships per page
+// (assets/textures/3DUI/atlas), which caps the page count at MAX_PAGES.
+//
+// Pages live until shutdown and icons keep their spot once placed. Main thread only.
+// =============================================================================
+class IconAtlas {
+public:
+    static IconAtlas& GetSingleton();
+
+    static constexpr uint32_t MAX_PAGES = 16;
+    static constexpr const char* CARRIER_PATH_FORMAT = "textures\\3DUI\\atlas\\page{:02}.dds";
+
+    enum class Status {
+        Placed,       // entry is valid
+        Pending,      // Source texture still loading - ask again next frame
+        Unavailable   // Use a standalone texture
+    };
+
+    struct Entry {
+        RE::NiSourceTexture* page = nullptr;
+        AtlasUV uv;
+    };
+
+    struct Stats {
+        size_t pages = 0;
+        size_t icons = 0;
+        size_t standalone = 0;   // Icons that couldn't be atlased
+        float occupancy = 0.0f;  // Mean over pages
+    };
+
+    // maxPages 0 disables the atlas, and is clamped to MAX_PAGES. Call before any Acquire().
+    void Configure(uint32_t maxPages);
+    bool IsEnabled() const { return m_enabled; }
+
+    // Where to find path's icon, loading its source (at priority) and placing it on first use
+    Status Acquire(InternedString path, float priority, Entry& outEntry);
+
+    Stats GetStats() const;
+
+private:
+    IconAtlas() = default;
+    IconAtlas(const IconAtlas&) = delete;
+    IconAtlas& operator=(const IconAtlas&) = delete;
+
+    struct Page {
+        // NiSourceTexture the page is shown through: the page's own carrier texture,
+        // repointed at the page. Held forever, so the engine never frees the page through it.
+        RE::NiPointer<RE::NiSourceTexture> carrier;
+        ID3D11Texture2D* texture = nullptr;  // Owned by the carrier now
+    };
+
+    // Load the next page's carrier and repoint it at a new page in format, created on device
+    bool CreatePage(ID3D11Device* device, uint32_t format);
+    void MarkStandalone(InternedString path, const char* reason);
+
+    bool m_enabled = false;
+    IconAtlasLayout m_layout;
+    std::vector<Page> m_pages;
+    std::unordered_set<InternedString, InternedString::Hash> m_loading;     // Source requested, callback pending
+    std::unordered_set<InternedString, InternedString::Hash> m_standalone;  // Never atlased
+};
+
+} // namespace Projectile
@@ -0,0 +1,206 @@
+#include "IconAtlasLayout.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace Projectile {
+
+// =============================================================================
+// AtlasRectAllocator
+// =============================================================================
+
+AtlasRectAllocator::AtlasRectAllocator(uint32_t width, uint32_t height, uint32_t alignment, uint32_t padding)
+    : m_width(width)
+    , m_height(height)
+    , m_alignment((std::max)(alignment, 1u))
+    , m_padding(padding)
+{
+    Reset();
+}
+
+void AtlasRectAllocator::Reset() {
+    m_skyline.assign(1, {0, 0, m_width});
+    m_usedArea = 0;
+}
+
+float AtlasRectAllocator::GetOccupancy() const {
+    uint64_t area = static_cast<uint64_t>(m_width) * m_height;
+    return area ? static_cast<float>(static_cast<double>(m_usedArea) / static_cast<double>(area)) : 0.0f;
+}
+
+uint32_t AtlasRectAllocator::Align(uint32_t value) const {
+    return (value + m_alignment - 1) / m_alignment * m_alignment;
+}
+
+std::optional<uint32_t> AtlasRectAllocator::FitAt(size_t index, uint32_t width, uint32_t height) const {
+    uint32_t x = m_skyline[index].x;
+    if (x + width > m_width) {
+        return std::nullopt;
+    }
+
+    // The rect rests on the highest skyline span it covers
+    uint32_t y = 0;
+    uint32_t remaining = width;
+    for (size_t i = index; remaining > 0; ++i) {
+        y = (std::max)(y, m_skyline[i].y);
+        if (y + height > m_height) {
+            return std::nullopt;
+        }
+        remaining -= (std::min)(remaining, m_skyline[i].width);
+    }
+    return y;
+}
+
+std::optional<AtlasRect> AtlasRectAllocator::Allocate(uint32_t width, uint32_t height) {
+    if (width == 0 || height == 0) {
+        return std::nullopt;
+    }
+
+    // Footprint includes the gutter; the last one on a page edge may be clipped
+    uint32_t footprintW = (std::min)(Align(width + m_padding), m_width);
+    uint32_t footprintH = (std::min)(Align(height + m_padding), m_height);
+    if (width > footprintW || height > footprintH) {
+        return std::nullopt;
+    }
+
+    // Bottom-left: lowest resulting top edge, then narrowest span
+    size_t bestIndex = m_skyline.size();
+    uint32_t bestTop = (std::numeric_limits<uint32_t>::max)();
+    uint32_t bestWidth = (std::numeric_limits<uint32_t>::max)();
+    for (size_t i = 0; i < m_skyline.size(); ++i) {
+        auto y = FitAt(i, footprintW, footprintH);
+        if (!y) {
+            continue;
+        }
+        uint32_t top = *y + footprintH;
+        if (top < bestTop || (top == bestTop && m_skyline[i].width < bestWidth)) {
+            bestIndex = i;
+            bestTop = top;
+            bestWidth = m_skyline[i].width;
+        }
+    }
+    if (bestIndex == m_skyline.size()) {
+        return std::nullopt;
+    }
+
+    AtlasRect rect{m_skyline[bestIndex].x, bestTop - footprintH, width, height};
+
+    // Raise the skyline over the footprint, trimming the spans it covers
+    m_skyline.insert(m_skyline.begin() + bestIndex, {rect.x, bestTop, footprintW});
+    uint32_t right = rect.x + footprintW;
+    for (size_t i = bestIndex + 1; i < m_skyline.size();) {
+        auto& node = m_skyline[i];
+        if (node.x >= right) {
+            break;
+        }
+        uint32_t nodeRight = node.x + node.width;
+        if (nodeRight <= right) {
+            m_skyline.erase(m_skyline.begin() + i);
+            continue;
+        }
+        node.width = nodeRight - right;
+        node.x = right;
+        break;
+    }
+
+    // Merge neighbouring spans at the same height
+    for (size_t i = 0; i + 1 < m_skyline.size();) {
+        if (m_skyline[i].y == m_skyline[i + 1].y) {
+            m_skyline[i].width += m_skyline[i + 1].width;
+            m_skyline.erase(m_skyline.begin() + i + 1);
+        } else {
+            ++i;
+        }
+    }
+
+    m_usedArea += static_cast<uint64_t>(width) * height;
+    return rect;
+}
+
+// =============================================================================
+// AtlasUV
+// =============================================================================
+
+AtlasUV AtlasUV::ForRect(const AtlasRect& rect, uint32_t pageWidth, uint32_t pageHeight) {
+    // Inset half a texel on each side
+    double u0 = (rect.x + 0.5) / pageWidth;
+    double v0 = (rect.y + 0.5) / pageHeight;
+    double uSize = (std::max)(rect.width - 1.0, 0.0) / pageWidth;
+    double vSize = (std::max)(rect.height - 1.0, 0.0) / pageHeight;
+
+    // finalUV = meshUV * scale + offset, meshUV -0.5..1.5 -> u0..u0 + uSize
+    AtlasUV uv;
+    uv.scaleX = static_cast<float>(uSize * 0.5);
+    uv.scaleY = static_cast<float>(vSize * 0.5);
+    uv.offsetX = static_cast<float>(u0 + uSize * 0.25);
+    uv.offsetY = static_cast<float>(v0 + vSize * 0.25);
+    return uv;
+}
+
+// =============================================================================
+// IconAtlasLayout
+// =============================================================================
+
+void IconAtlasLayout::SetSettings(const Settings& settings) {
+    m_settings = settings;
+    // Anything accepted must fit on a fresh page
+    m_settings.maxIconSize = (std::min)(m_settings.maxIconSize, m_settings.pageSize);
+    // Down to one 4x4 block per icon grid cell on the smallest mip
+    uint32_t maxMips = 1;
+    while (GetAlignment(maxMips + 1) <= m_settings.pageSize) {
+        ++maxMips;
+    }
+    m_settings.mipLevels = std::clamp(m_settings.mipLevels, 1u, maxMips);
+}
+
+std::optional<IconAtlasLayout::Placement> IconAtlasLayout::Place(
+    InternedString path, uint32_t width, uint32_t height, uint32_t format)
+{
+    if (auto it = m_placements.find(path); it != m_placements.end()) {
+        Placement placement = it->second;
+        placement.newPage = false;
+        return placement;
+    }
+
+    if (width == 0 || height == 0 || width > m_settings.maxIconSize || height > m_settings.maxIconSize) {
+        return std::nullopt;
+    }
+
+    Placement placement;
+    std::optional<AtlasRect> rect;
+    for (uint32_t i = 0; i < m_pages.size() && !rect; ++i) {
+        if (m_pages[i].format == format) {
+            rect = m_pages[i].allocator.Allocate(width, height);
+            placement.page = i;
+        }
+    }
+
+    if (!rect) {
+        if (m_pages.size() >= m_settings.maxPages) {
+            return std::nullopt;
+        }
+        m_pages.push_back({format, AtlasRectAllocator(m_settings.pageSize, m_settings.pageSize,
+            GetAlignment(m_settings.mipLevels), GetPadding(m_settings.mipLevels))});
+        placement.page = static_cast<uint32_t>(m_pages.size() - 1);
+        placement.newPage = true;
+        rect = m_pages.back().allocator.Allocate(width, height);
+        if (!rect) {
+            return std::nullopt;
+        }
+    }
+
+    placement.rect = *rect;
+    placement.uv = AtlasUV::ForRect(*rect, m_settings.pageSize, m_settings.pageSize);
+
+    Placement stored = placement;
+    stored.newPage = false;
+    m_placements.emplace(path, stored);
+    return placement;
+}
+
+const IconAtlasLayout::Placement* IconAtlasLayout::Find(InternedString path) const {
+    auto it = m_placements.find(path);
+    return it != m_placements.end() ? &it->second : nullptr;
+}
+
+} // namespace Projectile
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "../util/StringTable.h"
+
+namespace Projectile {
+
+// Pixel rectangle on an atlas page
+struct AtlasRect {
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+};
+
+// =============================================================================
+// AtlasRectAllocator
+// Skyline bottom-left packer for one atlas page. Rects are never freed individually -
+// a page is packed once and Reset() as a whole.
+//
+// Every rect starts on an `alignment` boundary (4 for block-compressed formats, which
+// can only be copied in whole 4x4 blocks) and is followed by a `padding` pixel gutter so
+// filtering never bleeds a neighbour in.
+// =============================================================================
+class AtlasRectAllocator {
+public:
+    AtlasRectAllocator(uint32_t width, uint32_t height, uint32_t alignment = 4, uint32_t padding = 4);
+
+    // Place a width x height rect, or nullopt if it doesn't fit
+    std::optional<AtlasRect> Allocate(uint32_t width, uint32_t height);
+
+    void Reset();
+
+    uint32_t GetWidth() const { return m_width; }
+    uint32_t GetHeight() const { return m_height; }
+    uint64_t GetUsedArea() const { return m_usedArea; }  // Allocated pixels, excluding gutters
+    float GetOccupancy() const;
+
+private:
+    struct SkylineNode {
+        uint32_t x;
+        uint32_t y;      // Top of the filled area at this span
+        uint32_t width;
+    };
+
+    // Y at which a width x height rect fits at node index, or nullopt
+    std::optional<uint32_t> FitAt(size_t index, uint32_t width, uint32_t height) const;
+    uint32_t Align(uint32_t value) const;
+
+    uint32_t m_width;
+    uint32_t m_height;
+    uint32_t m_alignment;
+    uint32_t m_padding;
+    std::vector<SkylineNode> m_skyline;
+    uint64_t m_usedArea = 0;
+};
+
+// UV offset/scale that shows rect on a page through TextureManipulator::SetMaterialUV.
+// Icon meshes span UV -0.5..1.5 (the full texture is offset 0.25, scale 0.5); the rect is
+// inset half a texel so bilinear filtering stays inside it.
+struct AtlasUV {
+    float offsetX = 0.25f;
+    float offsetY = 0.25f;
+    float scaleX = 0.5f;
+    float scaleY = 0.5f;
+
+    static AtlasUV ForRect(const AtlasRect& rect, uint32_t pageWidth, uint32_t pageHeight);
+};
+
+// =============================================================================
+// IconAtlasLayout
+// Decides where icons go: same-format icons share pages, each icon is placed once
+// and keeps its spot for the atlas' lifetime. Holds no textures - IconAtlas copies
+// the pixels in game.
+// =============================================================================
+class IconAtlasLayout {
+public:
+    struct Settings {
+        uint32_t pageSize = 2048;
+        uint32_t maxPages = 8;        // Across all formats
+        uint32_t maxIconSize = 512;   // Larger textures stay standalone
+        uint32_t mipLevels = 5;       // Page mip chain - icons with fewer mips stay standalone
+    };
+
+    // Placement grid and gutter that keep every page mip of every icon in whole 4x4 blocks,
+    // with at least a texel of gutter on the smallest mip
+    static uint32_t GetAlignment(uint32_t mipLevels) { return 4u << (mipLevels - 1); }
+    static uint32_t GetPadding(uint32_t mipLevels) { return (std::max)(4u, 1u << (mipLevels - 1)); }
+
+    struct Placement {
+        uint32_t page = 0;            // Index into the layout's pages
+        AtlasRect rect;
+        AtlasUV uv;
+        bool newPage = false;         // This placement opened the page
+    };
+
+    // Settings apply to pages opened afterwards - set them before placing anything
+    void SetSettings(const Settings& settings);
+    const Settings& GetSettings() const { return m_settings; }
+
+    // Placement for an icon, allocating one on first use.
+    // nullopt if it's too large or every page that could take it is full.
+    std::optional<Placement> Place(InternedString path, uint32_t width, uint32_t height, uint32_t format);
+
+    // Existing placement only
+    const Placement* Find(InternedString path) const;
+
+    size_t GetPageCount() const { return m_pages.size(); }
+    uint32_t GetPageFormat(uint32_t page) const { return m_pages[page].format; }
+    float GetPageOccupancy(uint32_t page) const { return m_pages[page].allocator.GetOccupancy(); }
+    size_t GetIconCount() const { return m_placements.size(); }
+
+private:
+    struct Page {
+        uint32_t format;
+        AtlasRectAllocator allocator;
+    };
+
+    Settings m_settings;
+    std::vector<Page> m_pages;
+    std::unordered_map<InternedString, Placement, InternedString::Hash> m_placements;
+};
+
+} // namespace Projectile
@@ -23,6 +23,9 @@ namespace {
     // This prevents rapid tooltip show/hide cycles when hand moves quickly between items
     constexpr bool ENABLE_DEBOUNCE = true;
     constexpr float DEBOUNCE_MS = 50.0f;
+
+    // Hover exit threshold = enter threshold x this (prevents flicker at the boundary)
+    constexpr float HOVER_HYSTERESIS = 1.01f;
 }
 
 namespace Widget {
@@ -136,27 +139,8 @@ void InteractionController::Clear() {
     }
 
     m_currentScales.clear();
-}
-
-void InteractionController::CollectProjectiles(Projectile::IPositionable* node,
-                                               std::vector<Projectile::ControlledProjectilePtr>& out) {
-    if (!node) return;
-
-    // Check if this node is a ControlledProjectile
-    if (auto* proj = dynamic_cast<Projectile::ControlledProjectile*>(node)) {
-        if (proj->IsValid()) {
-            // Get shared_ptr via enable_shared_from_this
-            out.push_back(proj->shared_from_this());
-        }
-        return;  // Projectiles don't have children
-    }
-
-    // Check if this is a driver with children
-    if (auto* driver = dynamic_cast<Projectile::ProjectileDriver*>(node)) {
-        for (const auto& child : driver->GetChildren()) {
-            CollectProjectiles(child.get(), out);
-        }
-    }
+    m_hoverIndex.Clear();
+    m_scaleGeneration = 0;
 }
 
 bool InteractionController::OnActivationInput(bool isLeft, bool isReleased, vr::EVRButtonId buttonId) {
@@ -340,7 +324,7 @@ void InteractionController::CommitHoverChange(bool isLeft, RE::NiAVObject* handN
 }
 
 void InteractionController::UpdateHoverForHand(bool isLeft, RE::NiAVObject* handNode,
-                                                const std::vector<Projectile::ControlledProjectilePtr>& projectiles,
+                                                const std::vector<Projectile::ControlledProjectile*>& projectiles,
                                                 float deltaTime) {
     if (!handNode) return;
 
@@ -363,41 +347,38 @@ void InteractionController::UpdateHoverForHand(bool isLeft, RE::NiAVObject* hand
 
     auto currentPending = handState.pendingHover.lock();
 
-    // Helper to get effective threshold for a projectile (override or controller default)
-    auto getThreshold = [this](const Projectile::ControlledProjectilePtr& proj) -> float {
-        return proj->HasHoverThresholdOverride() ? proj->GetHoverThresholdOverride() : m_hoverThreshold;
-    };
-
     // Hysteresis: exit threshold is 1.01x enter threshold to prevent flickering
     // For per-projectile thresholds, we calculate this per-item
-    float currentExitThreshold = m_hoverThreshold * 1.01f;  // Updated below if we have a hovered item
+    float currentExitThreshold = m_hoverThreshold * HOVER_HYSTERESIS;  // Updated below if we have a hovered item
 
     // Find closest projectile that is within its own threshold
-    Projectile::ControlledProjectilePtr newHovered = nullptr;
+    // (raw pointers into the root's leaf list - only promoted to shared_ptr on a state change)
+    Projectile::ControlledProjectile* newHovered = nullptr;
     float closestDist = (std::numeric_limits<float>::max)();
     float currentHoveredDist = (std::numeric_limits<float>::max)();
 
     RE::NiPoint3 handPos = handNode->world.translate;
 
-    for (const auto& proj : projectiles) {
-        if (!proj || !proj->IsEffectivelyVisible())
-            continue;
+    // Only elements within the largest exit threshold can be entered or kept hovered, so the
+    // spatial index returns every candidate that matters (sorted by distance, all of them).
+    // A hovered item outside the radius behaves as before: it is beyond its exit threshold.
+    m_hoverIndex.QueryNearest(handPos, m_hoverQueryRadius, projectiles.size(), m_hoverCandidates);
 
-        RE::NiPoint3 projPos = proj->GetWorldPosition();
+    for (const auto& candidate : m_hoverCandidates) {
+        auto* proj = projectiles[candidate.id];
+        if (!proj->IsValid() || !proj->IsEffectivelyVisible())
+            continue;
 
-        float dx = projPos.x - handPos.x;
-        float dy = projPos.y - handPos.y;
-        float dz = projPos.z - handPos.z;
-        float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+        float dist = candidate.distance;
 
         // Track distance to currently hovered item for hysteresis check
-        if (proj == currentHovered) {
+        if (proj == currentHovered.get()) {
             currentHoveredDist = dist;
-            currentExitThreshold = getThreshold(proj) * 1.01f;
+            currentExitThreshold = GetEffectiveHoverThreshold(*proj) * HOVER_HYSTERESIS;
         }
 
         // Check if this projectile is within its own threshold
-        float projThreshold = getThreshold(proj);
+        float projThreshold = GetEffectiveHoverThreshold(*proj);
         if (dist < projThreshold && dist < closestDist) {
             closestDist = dist;
             newHovered = proj;
@@ -406,16 +387,16 @@ void InteractionController::UpdateHoverForHand(bool isLeft, RE::NiAVObject* hand
 
     // Hysteresis: if currently hovering an item that's within its exit threshold,
     // keep hovering it even if another item is now slightly closer
-    if (currentHovered && currentHoveredDist <= currentExitThreshold && newHovered != currentHovered) {
+    if (currentHovered && currentHoveredDist <= currentExitThreshold && newHovered != currentHovered.get()) {
         // Current item is still within exit threshold - maintain hover
         // unless new item is significantly closer (within enter threshold)
         if (!newHovered || closestDist >= currentHoveredDist) {
-            newHovered = currentHovered;
+            newHovered = currentHovered.get();
         }
     }
 
     // Handle hover state changes with optional debounce
-    if (newHovered != currentHovered) {
+    if (newHovered != currentHovered.get()) {
         // Skip debounce when:
         // 1. Exiting hover entirely (newHovered == nullptr)
         // 2. Current hovered item became invisible (must exit immediately)
@@ -425,28 +406,28 @@ void InteractionController::UpdateHoverForHand(bool isLeft, RE::NiAVObject* hand
         if constexpr (ENABLE_DEBOUNCE) {
             if (forceImmediate) {
                 // Immediate change - no debounce for hover end or invisible items
-                CommitHoverChange(isLeft, handNode, newHovered);
+                CommitHoverChange(isLeft, handNode, ToShared(newHovered));
                 handState.pendingHover.reset();
                 handState.pendingHoverTimer = 0.0f;
-            } else if (newHovered == currentPending) {
+            } else if (newHovered == currentPending.get()) {
                 // Same pending target - accumulate time
                 handState.pendingHoverTimer += deltaTime;
 
                 if (handState.pendingHoverTimer >= (DEBOUNCE_MS / 1000.0f)) {
                     // Debounce passed - commit the change
-                    CommitHoverChange(isLeft, handNode, newHovered);
+                    CommitHoverChange(isLeft, handNode, ToShared(newHovered));
                     handState.pendingHover.reset();
                     handState.pendingHoverTimer = 0.0f;
                 }
                 // else: keep waiting
             } else {
                 // Different target - reset pending state
-                handState.pendingHover = newHovered;
+                handState.pendingHover = ToShared(newHovered);
                 handState.pendingHoverTimer = deltaTime;  // start counting from this frame
             }
         } else {
             // No debounce - immediate change
-            CommitHoverChange(isLeft, handNode, newHovered);
+            CommitHoverChange(isLeft, handNode, ToShared(newHovered));
         }
     } else {
         // Same as current hover - clear any pending
@@ -455,10 +436,27 @@ void InteractionController::UpdateHoverForHand(bool isLeft, RE::NiAVObject* hand
     }
 }
 
+void InteractionController::RefreshHoverIndex(const std::vector<Projectile::ControlledProjectile*>& projectiles) {
+    // Query radius covers the largest exit threshold; cell size matches so a query
+    // touches at most 3x3x3 cells
+    float maxThreshold = m_hoverThreshold;
+    for (auto* proj : projectiles) {
+        maxThreshold = (std::max)(maxThreshold, GetEffectiveHoverThreshold(*proj));
+    }
+    m_hoverQueryRadius = maxThreshold * HOVER_HYSTERESIS;
+    m_hoverIndex.SetCellSize(m_hoverQueryRadius);
+
+    // Refit from cached world transforms - elements only move between cells when they cross one
+    m_hoverIndex.Resize(projectiles.size());
+    for (uint32_t id = 0; id < projectiles.size(); ++id) {
+        m_hoverIndex.SetPosition(id, projectiles[id]->GetWorldPosition());
+    }
+}
+
 void InteractionController::UpdateHover(float deltaTime) {
-    // Collect all projectiles from hierarchy
-    std::vector<Projectile::ControlledProjectilePtr> projectiles;
-    CollectProjectiles(m_root, projectiles);
+    // Cached flattened leaves - no traversal or allocation unless the hierarchy changed
+    uint64_t generation = m_root->GetLeafGeneration();
+    RefreshHoverIndex(m_root->GetInteractiveLeaves());
 
     // Get hand nodes
     RE::NiAVObject* leftHand = VRNodes::GetLeftHand();
@@ -466,16 +464,21 @@ void InteractionController::UpdateHover(float deltaTime) {
 
     // Update hover state for each hand independently based on tracking mode
     if (m_handTrackingMode == HandTrackingMode::AnyHand) {
-        UpdateHoverForHand(true, leftHand, projectiles, deltaTime);
-        UpdateHoverForHand(false, rightHand, projectiles, deltaTime);
+        UpdateHoverForHand(true, leftHand, m_root->GetInteractiveLeaves(), deltaTime);
+        // Hover handlers may restructure the menu - the leaf pointers and index ids are
+        // only valid for the generation they were built from
+        if (m_root->GetLeafGeneration() != generation) {
+            RefreshHoverIndex(m_root->GetInteractiveLeaves());
+        }
+        UpdateHoverForHand(false, rightHand, m_root->GetInteractiveLeaves(), deltaTime);
     } else if (m_handTrackingMode == HandTrackingMode::LeftHand) {
-        UpdateHoverForHand(true, leftHand, projectiles, deltaTime);
+        UpdateHoverForHand(true, leftHand, m_root->GetInteractiveLeaves(), deltaTime);
         // Clear right hand state if mode changed
         if (!m_rightHand.hoveredProjectile.expired()) {
             m_rightHand.Clear();
         }
     } else {
-        UpdateHoverForHand(false, rightHand, projectiles, deltaTime);
+        UpdateHoverForHand(false, rightHand, m_root->GetInteractiveLeaves(), deltaTime);
         // Clear left hand state if mode changed
         if (!m_leftHand.hoveredProjectile.expired()) {
             m_leftHand.Clear();
@@ -486,9 +489,21 @@ void InteractionController::UpdateHover(float deltaTime) {
 void InteractionController::UpdateScaleAnimation(float deltaTime) {
     if (!m_root) return;
 
-    // Collect all projectiles
-    std::vector<Projectile::ControlledProjectilePtr> projectiles;
-    CollectProjectiles(m_root, projectiles);
+    const auto& projectiles = m_root->GetInteractiveLeaves();
+
+    // Drop scales for projectiles that left the hierarchy (only needed when it changed)
+    uint64_t generation = m_root->GetLeafGeneration();
+    if (generation != m_scaleGeneration) {
+        m_retainedScales.clear();
+        for (auto* proj : projectiles) {
+            auto it = m_currentScales.find(proj);
+            if (it != m_currentScales.end()) {
+                m_retainedScales.emplace(proj, it->second);
+            }
+        }
+        m_currentScales.swap(m_retainedScales);
+        m_scaleGeneration = generation;
+    }
 
     // Lock hover state for comparisons
     auto leftHovered = m_leftHand.hoveredProjectile.lock();
@@ -497,7 +512,9 @@ void InteractionController::UpdateScaleAnimation(float deltaTime) {
     float lerpFactor = m_hoverTransitionSpeed * deltaTime;
     if (lerpFactor > 1.0f) lerpFactor = 1.0f;
 
-    for (const auto& proj : projectiles) {
+    for (auto* proj : projectiles) {
+        if (!proj->IsValid()) continue;
+
         // Skip scale animation if element is not activateable (non-interactive display)
         // Still update hover state for such elements, but no visual feedback
         if (!proj->IsActivateable()) {
@@ -506,37 +523,17 @@ void InteractionController::UpdateScaleAnimation(float deltaTime) {
         }
 
         // Item is hovered if EITHER hand is hovering it
-        bool isHovered = (proj == leftHovered) || (proj == rightHovered);
+        bool isHovered = (proj == leftHovered.get()) || (proj == rightHovered.get());
         float targetScale = isHovered ? m_hoverScale : 1.0f;
 
-        // Get or initialize current scale (use raw ptr as map key)
-        auto* rawPtr = proj.get();
-        auto it = m_currentScales.find(rawPtr);
-        float currentScale = (it != m_currentScales.end()) ? it->second : 1.0f;
+        // Get or initialize current scale (raw ptr as map key)
+        auto [it, inserted] = m_currentScales.try_emplace(proj, 1.0f);
 
         // Lerp toward target
-        currentScale = currentScale + (targetScale - currentScale) * lerpFactor;
-        m_currentScales[rawPtr] = currentScale;
+        it->second = it->second + (targetScale - it->second) * lerpFactor;
 
         // Apply hover scale
-        proj->SetHoverScale(currentScale);
-    }
-
-    // Clean up scales for projectiles that no longer exist
-    // (This is O(n*m) but both are typically small)
-    for (auto it = m_currentScales.begin(); it != m_currentScales.end(); ) {
-        bool found = false;
-        for (const auto& proj : projectiles) {
-            if (proj.get() == it->first) {
-                found = true;
-                break;
-            }
-        }
-        if (!found) {
-            it = m_currentScales.erase(it);
-        } else {
-            ++it;
-        }
+        proj->SetHoverScale(it->second);
     }
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../projectile/ControlledProjectile.h"
+#include "../projectile/HoverSpatialIndex.h"
 #include "../projectile/IPositionable.h"
 #include "../projectile/ProjectileDriver.h"
 #include "../InputManager.h"
@@ -9,6 +10,7 @@
 #include <functional>
 #include <memory>
 #include <cstdint>
+#include <unordered_map>
 
 namespace Widget {
 
@@ -44,7 +46,7 @@ struct HandInteractionState {
 };
 
 // Handles hover detection and input for projectile interactions
-// Discovers projectiles by traversing the driver hierarchy - no registration needed
+// Discovers projectiles through the root driver's cached leaf list - no registration needed
 // Tracks each hand independently - activation only works for the hand that is hovering
 class InteractionController {
 public:
@@ -77,8 +79,8 @@ public:
 
     // === Root Driver ===
     // Set the root driver to traverse for projectiles
-    // Projectiles are discovered by traversing the hierarchy each frame
-    void SetRoot(Projectile::ProjectileDriver* root) { m_root = root; }
+    // Projectiles come from the root's cached leaf list (rebuilt when the hierarchy changes)
+    void SetRoot(Projectile::ProjectileDriver* root) { m_root = root; m_scaleGeneration = 0; }
     Projectile::ProjectileDriver* GetRoot() const { return m_root; }
 
     // === Callbacks ===
@@ -118,18 +120,25 @@ public:
     void Update(float deltaTime);
 
 private:
-    // Collect all projectiles from the hierarchy
-    void CollectProjectiles(Projectile::IPositionable* node,
-                           std::vector<Projectile::ControlledProjectilePtr>& out);
+    // Refit the hover spatial index from the projectiles' cached world positions
+    void RefreshHoverIndex(const std::vector<Projectile::ControlledProjectile*>& projectiles);
+    float GetEffectiveHoverThreshold(const Projectile::ControlledProjectile& proj) const {
+        return proj.HasHoverThresholdOverride() ? proj.GetHoverThresholdOverride() : m_hoverThreshold;
+    }
 
     void UpdateHover(float deltaTime);
     void UpdateHoverForHand(bool isLeft, RE::NiAVObject* handNode,
-                            const std::vector<Projectile::ControlledProjectilePtr>& projectiles,
+                            const std::vector<Projectile::ControlledProjectile*>& projectiles,
                             float deltaTime);
     void CommitHoverChange(bool isLeft, RE::NiAVObject* handNode,
                            Projectile::ControlledProjectilePtr newHovered);
     void UpdateScaleAnimation(float deltaTime);
 
+    // Promote a leaf pointer (valid for the current leaf generation) to an owning reference
+    static Projectile::ControlledProjectilePtr ToShared(Projectile::ControlledProjectile* proj) {
+        return proj ? proj->shared_from_this() : nullptr;
+    }
+
     bool OnActivationInput(bool isLeft, bool isReleased, vr::EVRButtonId buttonId);
     bool OnGrabInput(bool isLeft, bool isReleased, vr::EVRButtonId buttonId);
 
@@ -143,8 +152,16 @@ private:
     HandInteractionState m_leftHand;
     HandInteractionState m_rightHand;
 
-    // Hover scale tracking per projectile (by pointer, rebuilt each frame)
+    // Spatial index over this frame's projectiles (ids = indices into the root's leaf list)
+    // Hover queries only visit elements within the largest exit threshold of the hand
+    Projectile::HoverSpatialIndex m_hoverIndex;
+    std::vector<Projectile::HoverSpatialIndex::Neighbor> m_hoverCandidates;  // Reused query buffer
+    float m_hoverQueryRadius = 0.0f;  // Largest effective threshold x hysteresis
+
+    // Hover scale tracking per projectile (by pointer, pruned when the leaf generation changes)
     std::unordered_map<Projectile::ControlledProjectile*, float> m_currentScales;
+    std::unordered_map<Projectile::ControlledProjectile*, float> m_retainedScales;  // Prune scratch
+    uint64_t m_scaleGeneration = 0;
 
     // Configuration
     float m_hoverThreshold = 10.0f;
@@ -1,8 +1,11 @@
 #include "ProjectileDriver.h"
 #include "InteractionController.h"
 #include "DriverUpdateManager.h"
+#include "FrameProfiler.h"
 #include "../util/VRNodes.h"
 #include "../log.h"
+#include <atomic>
+#include <utility>
 
 namespace Projectile {
 
@@ -36,6 +39,7 @@ ProjectileDriver::ProjectileDriver(ProjectileDriver&& other) noexcept
     other.m_anchor.Clear();
     other.m_isGrabbing = false;
     other.m_previousAnchor.Clear();
+    other.InvalidateLeaves();
 
     // Update interaction controller's root pointer to this driver
     if (m_interactionController) {
@@ -61,6 +65,8 @@ ProjectileDriver& ProjectileDriver::operator=(ProjectileDriver&& other) noexcept
         other.m_anchor.Clear();
         other.m_isGrabbing = false;
         other.m_previousAnchor.Clear();
+        other.InvalidateLeaves();
+        InvalidateLeaves();
 
         // Update interaction controller's root pointer to this driver
         if (m_interactionController) {
@@ -96,9 +102,21 @@ void ProjectileDriver::Initialize() {
     }
 }
 
-void ProjectileDriver::Update(float deltaTime) {
+bool ProjectileDriver::UpdateAnchorAndFacing() {
+    // Root drivers follow game nodes (anchor, hand) that move between frames. Invalidate the
+    // tree's cached world transforms only when the anchor actually moved (beyond epsilon since
+    // the last invalidation), so the children of a static menu can stay at rest
+    if (!m_parent) {
+        RE::NiPoint3 anchorPos = GetAnchorWorldPosition();
+        if (!m_hasRestAnchorPosition || !NearlyEqual(anchorPos, m_restAnchorPosition, REST_POSITION_EPSILON)) {
+            m_restAnchorPosition = anchorPos;
+            m_hasRestAnchorPosition = true;
+            InvalidateWorldTransform();
+        }
+    }
+
     if (!m_localVisible) {
-        return;
+        return false;
     }
 
     // Compute and set local rotation from facing strategy (if configured)
@@ -109,13 +127,102 @@ void ProjectileDriver::Update(float deltaTime) {
     if (m_facingStrategy && m_facingAnchor) {
         RE::NiMatrix3 facingRotation = m_facingStrategy->ComputeRotation(
             GetWorldPosition(),
-            m_facingAnchor->world.translate);
-        SetLocalRotation(facingRotation);
+            m_hasAnchorSnapshot ? m_facingAnchorSnapshot : m_facingAnchor->world.translate);
+        // Ignore sub-epsilon head jitter so an unmoved menu doesn't wake its children
+        if (!NearlyEqual(facingRotation, m_localRotation, REST_ROTATION_EPSILON)) {
+            SetLocalRotation(facingRotation);
+        }
+    }
+    return true;
+}
+
+void ProjectileDriver::SnapshotAnchors() {
+    m_anchorSnapshot = m_anchor.GetWorldPosition();
+    if (m_facingAnchor) {
+        m_facingAnchorSnapshot = m_facingAnchor->world.translate;
+    }
+    m_hasAnchorSnapshot = true;
+}
+
+void ProjectileDriver::ComputeLayout(float deltaTime) {
+    // Game nodes are only read through the snapshot taken on the main thread. A root that
+    // wasn't snapshotted, or a sub-driver with its own facing anchor, is left to Update()
+    if (!m_parent ? !m_hasAnchorSnapshot : (m_facingStrategy && m_facingAnchor)) {
+        return;
+    }
+
+    m_facingComputed = true;
+    if (!UpdateAnchorAndFacing()) {
+        return;
+    }
+
+    // Resting and nothing moved: the subtree is already laid out and resolved. Whether the
+    // billboard targets wake it is decided in Update() - they're game nodes.
+    if (m_resting && !HasWorldTransformChange() && CanStayAtRest()) {
+        return;
+    }
+
+    if (IsLayoutParallelSafe()) {
+        FrameProfiler::Scope scope(ProfileScope::Layout);
+        m_computingLayout = true;
+        UpdateLayout(deltaTime);
+        m_computingLayout = false;
+        m_layoutComputed = true;
+    }
+
+    // Resolve the subtree's cached world transforms here rather than on the main thread
+    for (const auto& child : m_children) {
+        if (auto* childDriver = dynamic_cast<ProjectileDriver*>(child.get())) {
+            childDriver->ComputeLayout(deltaTime);
+        } else {
+            child->GetWorldPosition();
+        }
+    }
+}
+
+void ProjectileDriver::SetChildVisible(IPositionable& child, bool visible) {
+    if (m_computingLayout) {
+        // Layouts restate every child's visibility each frame - only queue actual changes
+        if (child.IsVisible() != visible) {
+            m_pendingVisibility.push_back({&child, visible});
+        }
+        return;
+    }
+    child.SetVisible(visible);
+}
+
+void ProjectileDriver::ApplyPendingVisibility() {
+    for (const auto& pending : m_pendingVisibility) {
+        pending.child->SetVisible(pending.visible);
+    }
+    m_pendingVisibility.clear();
+}
+
+void ProjectileDriver::Update(float deltaTime) {
+    // Commit what ComputeLayout() prepared this frame, or do the whole update here
+    bool facingComputed = std::exchange(m_facingComputed, false);
+    bool layoutComputed = std::exchange(m_layoutComputed, false);
+    m_hasAnchorSnapshot = false;
+    ApplyPendingVisibility();
+
+    if (facingComputed ? !m_localVisible : !UpdateAnchorAndFacing()) {
+        return;
+    }
+
+    // At rest: the layout and every child would reproduce last frame exactly, so skip both
+    bool worldChanged = ConsumeWorldTransformChange();
+    if (m_resting && !worldChanged && CanStayAtRest() && !BillboardTargetsMoved()) {
+        return;
     }
+    m_resting = false;
+    m_wakeRequested = false;
 
     // Update layout (positions children in LOCAL space only - no rotation needed)
     // Children's world positions will include our rotation via scene graph
-    UpdateLayout(deltaTime);
+    if (!layoutComputed) {
+        FrameProfiler::Scope scope(ProfileScope::Layout);
+        UpdateLayout(deltaTime);
+    }
 
     // Compensate for rotation-induced drift during grab
     // When the driver rotates to face the HMD, the grabbed handle's world position changes
@@ -134,9 +241,11 @@ void ProjectileDriver::Update(float deltaTime) {
             m_anchor = m_previousAnchor;
             m_isGrabbing = false;
             m_grabbedProjectile.reset();
+            InvalidateWorldTransform();
         } else {
             // Update anchor to track hand position (fresh each frame)
             m_anchor.SetDirect(handNode);
+            InvalidateWorldTransform();
 
             if (auto grabbedProj = m_grabbedProjectile.lock()) {
                 // Grabbed projectile still exists - compensate for drift
@@ -147,17 +256,47 @@ void ProjectileDriver::Update(float deltaTime) {
                 // Adjust offset to compensate for rotation-induced drift
                 RE::NiPoint3 currentOffset = m_anchor.GetOffset();
                 m_anchor.SetOffset(currentOffset - drift);
+                InvalidateWorldTransform();
             }
             // If grabbedProjectile expired but hand is valid, just skip drift compensation
         }
     }
 
-    // Update children recursively
-    // THREAD SAFETY: Copy before iterating - main thread may call AddChild/Clear while VR thread updates
-    auto childrenCopy = m_children;
-    for (auto& child : childrenCopy) {
+    // Update children recursively, in place - AddChild/Clear calls made meanwhile are deferred
+    bool childrenAtRest = true;
+    m_iteratingChildren = true;
+    for (auto& child : m_children) {
         child->Update(deltaTime);
+        childrenAtRest = childrenAtRest && child->IsAtRest();
+    }
+    m_iteratingChildren = false;
+    ApplyPendingChildOps();
+
+    // Rest after a frame in which nothing changed: a layout that moved a child, or a setter
+    // called on a child after its update (m_wakeRequested), keeps us awake for another frame
+    if (!worldChanged && !m_wakeRequested && childrenAtRest && CanStayAtRest()) {
+        m_resting = true;
+        m_restHMDPosition = GameProjectileUtils::GetHMDPosition();
+        m_restPlayerPosition = GameProjectileUtils::GetPlayerPosition();
+    }
+}
+
+bool ProjectileDriver::CanStayAtRest() const {
+    return !m_isGrabbing && IsLayoutIdle();
+}
+
+bool ProjectileDriver::BillboardTargetsMoved() const {
+    return !NearlyEqual(GameProjectileUtils::GetHMDPosition(), m_restHMDPosition, REST_POSITION_EPSILON) ||
+           !NearlyEqual(GameProjectileUtils::GetPlayerPosition(), m_restPlayerPosition, REST_POSITION_EPSILON);
+}
+
+void ProjectileDriver::WakeUp() {
+    m_wakeRequested = true;
+    if (!m_resting) {
+        return;  // An awake driver's ancestors are awake too (they rest only when we do)
     }
+    m_resting = false;
+    IPositionable::WakeUp();
 }
 
 void ProjectileDriver::AddChild(IPositionablePtr child) {
@@ -166,11 +305,23 @@ void ProjectileDriver::AddChild(IPositionablePtr child) {
         return;
     }
 
+    if (m_iteratingChildren) {
+        spdlog::trace("[Driver '{}'] AddChild: deferring child='{}' until children update finishes",
+            GetID(), child->GetID());
+        m_pendingChildOps.push_back({std::move(child)});
+        return;
+    }
+    AddChildNow(std::move(child));
+}
+
+void ProjectileDriver::AddChildNow(IPositionablePtr child) {
     // Set this driver as the parent BEFORE Initialize() so it knows it's a child
     child->SetParent(this);
 
     // Add to children FIRST so UpdateLayout can position it
     m_children.push_back(child);
+    InvalidateLeaves();
+    WakeUp();
 
     // If we're already initialized, position and then initialize the child
     // so the projectile spawns at the correct position
@@ -184,6 +335,15 @@ void ProjectileDriver::AddChild(IPositionablePtr child) {
 }
 
 void ProjectileDriver::Clear() {
+    if (m_iteratingChildren) {
+        spdlog::trace("[Driver '{}'] Clear: deferring until children update finishes", GetID());
+        m_pendingChildOps.push_back({nullptr});
+        return;
+    }
+    ClearChildrenNow();
+}
+
+void ProjectileDriver::ClearChildrenNow() {
     spdlog::trace("[Driver '{}'] Clear: removing {} children", GetID(), m_children.size());
     // Destroy all projectile children
     for (auto& child : m_children) {
@@ -197,12 +357,73 @@ void ProjectileDriver::Clear() {
         }
     }
     m_children.clear();
+    m_pendingVisibility.clear();
+    InvalidateLeaves();
+    WakeUp();
+}
+
+void ProjectileDriver::ApplyPendingChildOps() {
+    // Not iterating any more, so nothing below can queue further ops
+    for (auto& op : m_pendingChildOps) {
+        if (op.child) {
+            AddChildNow(std::move(op.child));
+        } else {
+            ClearChildrenNow();
+        }
+    }
+    m_pendingChildOps.clear();
 }
 
 void ProjectileDriver::UpdateLayout(float deltaTime) {
 
 }
 
+void ProjectileDriver::InvalidateWorldTransform() {
+    if (m_worldDirty) {
+        return;  // Children are already dirty
+    }
+    IPositionable::InvalidateWorldTransform();
+    for (auto& child : m_children) {
+        child->InvalidateWorldTransform();
+    }
+}
+
+uint64_t ProjectileDriver::NextLeafGeneration() {
+    static std::atomic<uint64_t> s_nextGeneration{1};
+    return s_nextGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ProjectileDriver::InvalidateLeaves() {
+    // Walk up explicitly - structural changes are rare, so the dynamic_cast per level is fine
+    for (IPositionable* node = this; node; node = node->GetParent()) {
+        auto* driver = dynamic_cast<ProjectileDriver*>(node);
+        if (!driver) {
+            break;
+        }
+        driver->m_leafGeneration = NextLeafGeneration();
+    }
+}
+
+const std::vector<ControlledProjectile*>& ProjectileDriver::GetInteractiveLeaves() {
+    if (m_leavesBuiltGeneration == m_leafGeneration) {
+        return m_leaves;
+    }
+
+    m_leaves.clear();  // Keeps capacity
+    for (const auto& child : m_children) {
+        if (auto* proj = dynamic_cast<ControlledProjectile*>(child.get())) {
+            m_leaves.push_back(proj);
+        } else if (auto* childDriver = dynamic_cast<ProjectileDriver*>(child.get())) {
+            if (childDriver->IsVisible()) {
+                const auto& childLeaves = childDriver->GetInteractiveLeaves();
+                m_leaves.insert(m_leaves.end(), childLeaves.begin(), childLeaves.end());
+            }
+        }
+    }
+    m_leavesBuiltGeneration = m_leafGeneration;
+    return m_leaves;
+}
+
 void ProjectileDriver::SetVisible(bool visible) {
     bool wasVisible = m_localVisible;
     if (visible == wasVisible) {
@@ -213,6 +434,8 @@ void ProjectileDriver::SetVisible(bool visible) {
         GetID(), wasVisible, visible, m_children.size());
 
     m_localVisible = visible;
+    InvalidateLeaves();  // Hidden sub-drivers drop out of the interactive leaves
+    WakeUp();
 
     // Auto-clear interaction state when hiding
     if (wasVisible && !visible && m_interactionController) {
@@ -240,12 +463,14 @@ void ProjectileDriver::OnParentHide() {
 
 void ProjectileDriver::SetCenter(const RE::NiPoint3& worldPos) {
     m_anchor.SetWorldPosition(worldPos);
+    InvalidateWorldTransform();
 }
 
 void ProjectileDriver::SetAnchor(RE::NiAVObject* node, bool useRotation, bool useScale) {
     m_anchor.SetDirect(node);
     m_anchor.SetUseRotation(useRotation);
     m_anchor.SetUseScale(useScale);
+    InvalidateWorldTransform();
     if (node) {
         spdlog::trace("ProjectileDriver: Set anchor to {:p}, useRot={}, useScale={}",
             (void*)node, useRotation, useScale);
@@ -419,6 +644,7 @@ void ProjectileDriver::StartDriverPositioning(bool isLeftHand,
     }
 
     m_isGrabbing = true;
+    InvalidateWorldTransform();
 }
 
 void ProjectileDriver::UpdateGrabbedProjectile(ControlledProjectile* proj) {
@@ -472,6 +698,7 @@ void ProjectileDriver::EndDriverPositioning() {
     }
 
     m_isGrabbing = false;
+    InvalidateWorldTransform();
 }
 
 void ProjectileDriver::SetInteractionController(std::unique_ptr<Widget::InteractionController> controller) {
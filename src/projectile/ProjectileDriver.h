@@ -35,9 +35,21 @@ public:
     // === Update (call each frame) ===
     void Update(float deltaTime);
 
+    // Compute phase of a root update (DriverUpdateManager runs it for independent roots on
+    // worker threads before the serial Update). Follows the anchor, applies facing, runs
+    // parallel-safe layouts and resolves the subtree's world transforms - all tree-local math.
+    // The following Update() skips whatever ran here and applies the queued side effects.
+    void ComputeLayout(float deltaTime);
+
+    // Main thread, before ComputeLayout(): sample the anchor and facing anchor game nodes so
+    // the compute phase reads these copies instead. The next Update() drops them.
+    void SnapshotAnchors();
+
     // === Child Management ===
     // Add any IPositionable child (projectile or sub-driver)
     // Sets this driver as the parent of the child
+    // Called while Update() is iterating this driver's children (e.g. from a child's callback),
+    // AddChild and Clear are queued and applied in call order once the iteration finishes
     virtual void AddChild(IPositionablePtr child);
 
     // Clear all children (destroys projectiles, releases sub-drivers)
@@ -46,6 +58,14 @@ public:
     // Get children
     const std::vector<IPositionablePtr>& GetChildren() const { return m_children; }
 
+    // === Interactive Leaves ===
+    // Flattened projectiles of this subtree, skipping hidden sub-drivers. Cached and rebuilt
+    // only after AddChild/Clear/SetVisible somewhere in the subtree, so per-frame callers
+    // (InteractionController) iterate raw pointers without RTTI, refcounting or allocation.
+    // Pointers stay valid for as long as GetLeafGeneration() returns the same value.
+    const std::vector<ControlledProjectile*>& GetInteractiveLeaves();
+    uint64_t GetLeafGeneration() const { return m_leafGeneration; }
+
     // === Layout ===
     // Derived classes override UpdateLayout() to implement specific layouts (circle, wheel, grid, etc.)
 
@@ -66,26 +86,24 @@ public:
 
     // === Facing Anchor (for look-at-player behavior) ===
     // Set an anchor node that the layout will orient toward (e.g., HMD/player head)
-    void SetFacingAnchor(RE::NiAVObject* anchor) { m_facingAnchor = anchor; }
+    void SetFacingAnchor(RE::NiAVObject* anchor) { m_facingAnchor = anchor; WakeUp(); }
     RE::NiAVObject* GetFacingAnchor() const { return m_facingAnchor; }
     bool HasFacingAnchor() const { return m_facingAnchor != nullptr; }
 
     // Set the facing strategy (determines how the layout rotates toward the anchor)
-    void SetFacingStrategy(IFacingStrategy* strategy) { m_facingStrategy = strategy; }
+    void SetFacingStrategy(IFacingStrategy* strategy) { m_facingStrategy = strategy; WakeUp(); }
 
-    // IPositionable override: compute world position from anchor + parent chain
-    // Scene graph: if we have a parent, our position is rotated by parent's world rotation
-    RE::NiPoint3 GetWorldPosition() const override {
-        if (m_parent) {
-            // Child driver: apply parent's rotation to our local position
-            RE::NiMatrix3 parentWorldRot = m_parent->GetWorldRotation();
-            RE::NiPoint3 rotatedLocalPos = RotatePoint(parentWorldRot, m_localPosition);
-            return m_parent->GetWorldPosition() + rotatedLocalPos;
-        }
-        // Root driver: position is anchor + local offset
-        RE::NiPoint3 anchorPos = m_anchor.GetWorldPosition();
-        return m_localPosition + anchorPos;
-    }
+    // IPositionable override: also invalidates every child's cached world transform
+    void InvalidateWorldTransform() override;
+
+    // === Rest (IPositionable overrides) ===
+    // A driver rests once a frame passes with its world transform unchanged, no grab, an idle
+    // layout and every child at rest. While resting, Update() follows the anchor and facing
+    // but skips the layout and the children loop. Any setter below it wakes it again, and so
+    // does the HMD or player moving (billboarded descendants face them).
+    // Child drivers with a facing anchor turn with the head every frame, so they never rest.
+    bool IsAtRest() const override { return m_resting && !(m_facingStrategy && m_facingAnchor); }
+    void WakeUp() override;
 
     // IPositionable override: event handling for drivers
     // Base implementation handles anchor handle grabs by forwarding to StartDriverPositioning
@@ -139,9 +157,41 @@ protected:
     // Parent rotation is automatically applied via scene graph (GetWorldPosition).
     virtual void UpdateLayout(float deltaTime);
 
+    // Override to return true when UpdateLayout() only touches this driver's own state and
+    // its children's local transforms (SetLocalPosition/SetLocalScale/SetChildVisible), so it
+    // may run on a worker thread in ComputeLayout(). Layouts that spawn, load or call out
+    // into the game must keep the default and run in the serial Update().
+    virtual bool IsLayoutParallelSafe() const { return false; }
+
+    // Override to return false while UpdateLayout() has work no setter announces (a layout
+    // following a hand, or retrying until a node exists). Setters that change the layout's
+    // inputs call WakeUp(); a resting driver otherwise doesn't run UpdateLayout() at all.
+    virtual bool IsLayoutIdle() const { return true; }
+
+    // Show/hide a child from UpdateLayout(). Visibility changes bind or unbind game objects,
+    // so during ComputeLayout() they are queued and applied at the start of Update().
+    void SetChildVisible(IPositionable& child, bool visible);
+
+    // IPositionable override: compute world position from anchor + parent chain
+    // Scene graph: if we have a parent, our position is rotated by parent's world rotation
+    RE::NiPoint3 ComputeWorldPosition() const override {
+        if (m_parent) {
+            // Child driver: apply parent's rotation to our local position
+            RE::NiMatrix3 parentWorldRot = m_parent->GetWorldRotation();
+            RE::NiPoint3 rotatedLocalPos = RotatePoint(parentWorldRot, m_localPosition);
+            return m_parent->GetWorldPosition() + rotatedLocalPos;
+        }
+        // Root driver: position is anchor + local offset
+        return m_localPosition + GetAnchorWorldPosition();
+    }
+
     // Access to children for derived classes (mutable)
+    // Structural changes must go through AddChild/Clear so the leaf cache stays in sync
     std::vector<IPositionablePtr>& GetChildrenMutable() { return m_children; }
 
+    // Stamp a new leaf generation on this driver and every ancestor driver
+    void InvalidateLeaves();
+
     ProjectileSubsystem* m_subsystem = nullptr;
 
     // Transition settings (accessible to derived classes for projectile configuration)
@@ -150,7 +200,56 @@ protected:
 
 private:
     std::vector<IPositionablePtr> m_children;  // Owned children (projectiles and/or sub-drivers)
+
+    // Interactive leaf cache (see GetInteractiveLeaves). Generations are globally unique,
+    // so a stamp taken from one driver never matches another.
+    static uint64_t NextLeafGeneration();
+    std::vector<ControlledProjectile*> m_leaves;
+    uint64_t m_leafGeneration = NextLeafGeneration();
+    uint64_t m_leavesBuiltGeneration = 0;
+
+    // Deferred structural changes (see AddChild). Update() iterates m_children in place,
+    // so nothing may add or remove children until the loop is done.
+    struct PendingChildOp {
+        IPositionablePtr child;  // Child to add, or null for Clear
+    };
+    void AddChildNow(IPositionablePtr child);
+    void ClearChildrenNow();
+    void ApplyPendingChildOps();
+    bool m_iteratingChildren = false;
+    std::vector<PendingChildOp> m_pendingChildOps;
+
+    // Two-phase update state (see ComputeLayout)
+    bool UpdateAnchorAndFacing();  // Returns false when hidden (nothing else to do)
+    void ApplyPendingVisibility();
+    struct PendingVisibility {
+        IPositionable* child;  // Owned by m_children - cleared together with them
+        bool visible;
+    };
+    std::vector<PendingVisibility> m_pendingVisibility;
+    bool m_computingLayout = false;   // Inside UpdateLayout() on a worker thread
+    bool m_facingComputed = false;    // Anchor and facing already ran this frame
+    bool m_layoutComputed = false;    // UpdateLayout() already ran this frame
     Anchor m_anchor;
+    RE::NiPoint3 m_restAnchorPosition;     // Anchor position at the last root invalidation
+    bool m_hasRestAnchorPosition = false;
+
+    // Game node positions sampled by SnapshotAnchors() for the off-thread compute phase
+    RE::NiPoint3 m_anchorSnapshot;
+    RE::NiPoint3 m_facingAnchorSnapshot;
+    bool m_hasAnchorSnapshot = false;
+    RE::NiPoint3 GetAnchorWorldPosition() const {
+        return m_hasAnchorSnapshot ? m_anchorSnapshot : m_anchor.GetWorldPosition();
+    }
+
+    // Rest state (see IsAtRest). The billboard targets are sampled when the driver goes to
+    // rest; only the topmost resting driver is updated, so one sample per resting root.
+    bool CanStayAtRest() const;             // Nothing this frame requires the layout/children
+    bool BillboardTargetsMoved() const;
+    bool m_resting = false;
+    bool m_wakeRequested = false;           // WakeUp() since the current update began
+    RE::NiPoint3 m_restHMDPosition;
+    RE::NiPoint3 m_restPlayerPosition;
     // Note: m_localVisible is inherited from IPositionable
 
     // Facing anchor and strategy (for look-at-player behavior)
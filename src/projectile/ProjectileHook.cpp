@@ -1,5 +1,6 @@
 #include "ProjectileHook.h"
 #include "ProjectileSubsystem.h"
+#include "FrameProfiler.h"
 #include "../log.h"
 #include <thread>
 #include <sstream>
@@ -72,6 +73,7 @@ void ProjectileHook::Hook_GetVelocity(RE::Projectile* proj, float delta) {
     // Then let our subsystem override if this is a controlled projectile
     auto* subsystem = ProjectileSubsystem::GetSingleton();
     if (subsystem && subsystem->IsInitialized()) {
+        FrameProfiler::Scope scope(ProfileScope::Hook);
         subsystem->OnProjectileUpdate(proj, delta);
     }
 }
@@ -2,8 +2,10 @@
 #include "ProjectileHook.h"
 #include "FormIDs.h"
 #include "IPositionable.h"  // For MatrixToEuler
+#include "../Config.h"
 #include "../log.h"
 
+#include <algorithm>
 #include <chrono>
 
 namespace Projectile {
@@ -69,6 +71,11 @@ bool ProjectileSubsystem::Initialize() {
         spdlog::warn("Failed to load weapon form {:x} from {}", FormIDs::WeaponFormID, pluginName);
     }
 
+    m_warmPoolSize = static_cast<size_t>((std::max)(Config::options.warmPoolSize, 0));
+    if (m_warmPoolSize > 0) {
+        spdlog::info("ProjectileSubsystem: warm pool of {} projectiles per form", m_warmPoolSize);
+    }
+
     // Note: ProjectileHook is now installed lazily by DriverUpdateManager::Register()
     // on first driver registration. This ensures zero per-frame cost when unused.
 
@@ -94,6 +101,13 @@ void ProjectileSubsystem::Shutdown() {
     m_weaponForm = nullptr;
     m_casterRef = nullptr;
     m_projectiles.clear();
+    {
+        // A spawn task still in the SKSE queue finds nothing left to launch
+        std::lock_guard<std::mutex> spawnLock(m_spawnMutex);
+        m_pendingSpawns.clear();
+    }
+    m_pendingIndexChanges.clear();
+    m_boundProjectiles.store(nullptr);
 
     m_initialized = false;
     spdlog::info("ProjectileSubsystem shut down");
@@ -161,22 +175,18 @@ void ProjectileSubsystem::ReleaseAllProjectiles() {
         }
     }
     m_projectiles.clear();
+    m_pendingIndexChanges.clear();
+    m_boundProjectiles.store(nullptr);
+    DrainWarmPool();
     ProjectileHook::ResetControlledCount();
 
     spdlog::info("ProjectileSubsystem released all projectiles");
 }
 
 void ProjectileSubsystem::OnProjectileUpdate(RE::Projectile* proj, float delta) {
-    // [DIAG] Measure mutex acquisition time
-    auto lockStart = std::chrono::high_resolution_clock::now();
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    auto lockEnd = std::chrono::high_resolution_clock::now();
-    auto lockTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(lockEnd - lockStart).count();
-    if (lockTimeUs > 100) {
-        spdlog::warn("[PERF] OnProjectileUpdate mutex lock took {}us", lockTimeUs);
-    }
-
-    if (!m_initialized || !proj) {
+    // No m_mutex here: the index is an immutable published snapshot and the transform
+    // comes from the projectile's lock-free mailbox, so the hook never waits on the main thread
+    if (!m_initialized.load(std::memory_order_acquire) || !proj) {
         return;
     }
 
@@ -184,21 +194,25 @@ void ProjectileSubsystem::OnProjectileUpdate(RE::Projectile* proj, float delta)
     auto findStart = std::chrono::high_resolution_clock::now();
 
     // Find if this projectile belongs to us
-    ControlledProjectile* controlledProj = FindByGameProjectile(proj);
+    ControlledProjectilePtr controlledProj = FindByGameProjectile(proj);
 
     auto findEnd = std::chrono::high_resolution_clock::now();
     auto findTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(findEnd - findStart).count();
     if (findTimeUs > 50) {
-        spdlog::warn("[PERF] FindByGameProjectile took {}us (map size={})",
-            findTimeUs, m_projectiles.size());
+        spdlog::warn("[PERF] FindByGameProjectile took {}us", findTimeUs);
     }
 
     if (!controlledProj) {
+        // Parked in the warm pool: keep it alive and out of sight until it's handed out
+        auto parked = m_parkedProjectiles.load(std::memory_order_acquire);
+        if (parked && parked->contains(proj)) {
+            GameProjectile::HoldParked(proj);
+        }
         return;  // Not our projectile
     }
 
-    // Apply our transform overrides
-    controlledProj->GetGameProjectile().ApplyTransform();
+    // Apply our transform overrides to the projectile the game handed us
+    controlledProj->GetGameProjectile().ApplyTransform(proj);
 }
 
 size_t ProjectileSubsystem::GetActiveCount() const {
@@ -213,15 +227,69 @@ size_t ProjectileSubsystem::GetActiveCount() const {
     return count;
 }
 
-ControlledProjectile* ProjectileSubsystem::FindByGameProjectile(RE::Projectile* proj) {
-    for (auto& [uuid, weakPtr] : m_projectiles) {
-        if (auto controlledProj = weakPtr.lock()) {
-            if (controlledProj->GetGameProjectile().GetProjectile() == proj) {
-                return controlledProj.get();
+ControlledProjectilePtr ProjectileSubsystem::FindByGameProjectile(RE::Projectile* proj) const {
+    auto index = m_boundProjectiles.load(std::memory_order_acquire);
+    if (!index) {
+        return nullptr;
+    }
+
+    auto it = index->find(proj);
+    if (it == index->end()) {
+        return nullptr;
+    }
+
+    // Verify the entry - the owner may have expired or unbound since the last publish
+    // (stale entries are pruned by the next PublishBoundIndex)
+    auto controlledProj = it->second.lock();
+    if (!controlledProj || !controlledProj->GetGameProjectile().IsBoundTo(proj)) {
+        return nullptr;
+    }
+    return controlledProj;
+}
+
+void ProjectileSubsystem::IndexBoundProjectile(RE::Projectile* gameProj, ControlledProjectile* controlledProj) {
+    if (!gameProj || !controlledProj) {
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_pendingIndexChanges.push_back({gameProj, controlledProj->weak_from_this()});
+}
+
+void ProjectileSubsystem::UnindexBoundProjectile(RE::Projectile* gameProj) {
+    if (!gameProj) {
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_pendingIndexChanges.push_back({gameProj, {}});
+}
+
+void ProjectileSubsystem::PublishBoundIndex() {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (m_pendingIndexChanges.empty()) {
+        return;
+    }
+
+    // One copy per publish, minus stale entries, with the changes applied in order
+    // (an unbind followed by a bind of a reused pointer must end up bound)
+    auto index = std::make_shared<BoundProjectileIndex>();
+    if (auto current = m_boundProjectiles.load(std::memory_order_acquire)) {
+        index->reserve(current->size() + m_pendingIndexChanges.size());
+        for (const auto& [gameProj, weakPtr] : *current) {
+            auto controlledProj = weakPtr.lock();
+            if (controlledProj && controlledProj->GetGameProjectile().IsBoundTo(gameProj)) {
+                index->emplace(gameProj, weakPtr);
             }
         }
     }
-    return nullptr;
+    for (auto& change : m_pendingIndexChanges) {
+        if (change.owner.expired()) {
+            index->erase(change.gameProj);
+        } else {
+            (*index)[change.gameProj] = std::move(change.owner);
+        }
+    }
+    m_pendingIndexChanges.clear();
+    m_boundProjectiles.store(std::move(index), std::memory_order_release);
 }
 
 bool ProjectileSubsystem::FireProjectileFor(ControlledProjectile* controlledProj) {
@@ -257,109 +325,338 @@ bool ProjectileSubsystem::FireProjectileFor(ControlledProjectile* controlledProj
         return false;
     }
 
-    // Fire using SKSE task queue for thread safety
-    auto task = SKSE::GetTaskInterface();
-    if (!task) {
-        spdlog::error("FireProjectileFor: SKSE task interface not available");
-        return false;
+    // Hand out a parked projectile of this form if the warm pool has one - bound this frame,
+    // no spawn batch round trip. The pool is topped up either way.
+    if (m_warmPoolSize > 0) {
+        RE::Projectile* warmProj = nullptr;
+        {
+            std::lock_guard<std::recursive_mutex> lock(m_mutex);
+            warmProj = TakeWarmProjectile(formIndex);
+            if (warmProj) {
+                ++m_warmStats.hits;
+            } else {
+                ++m_warmStats.misses;
+            }
+            RefillWarmPool(formIndex);
+        }
+        if (warmProj) {
+            spdlog::trace("FireProjectileFor: UUID={} bound from warm pool (form={})",
+                controlledProj->GetUUID().ToString(), formIndex);
+            controlledProj->BindToProjectile(warmProj, controlledProj->GetFireGeneration());
+
+            // Publish now rather than at the end of the frame - until the hook finds it in
+            // the index, it's neither held nor moved. Only then drop it from the parked set,
+            // so the hook always finds it in one of the two.
+            PublishBoundIndex();
+            std::lock_guard<std::recursive_mutex> lock(m_mutex);
+            PublishParkedProjectiles();
+            return true;
+        }
     }
 
-    // Capture what we need for the lambda
-    auto weaponPtr = weaponForm;
-    auto casterPtr = caster;
-    auto ammoPtr = ammoForm;
     // Spawn out of sight so we dont see its initial scale, next transform update will move into position
-    RE::NiPoint3 launchPos = RE::NiPoint3{transform.position.x, transform.position.y, transform.position.z - 1000.0f};
+    PendingSpawn spawn;
+    spawn.uuid = controlledProj->GetUUID();
+    spawn.ammo = ammoForm;
+    spawn.launchPos = RE::NiPoint3{transform.position.x, transform.position.y, transform.position.z - 1000.0f};
     // Extract Euler angles from rotation matrix for LaunchArrow API
-    RE::NiPoint3 launchRot = MatrixToEuler(transform.rotation);
-    UUID uuid = controlledProj->GetUUID();
-
+    spawn.launchRot = MatrixToEuler(transform.rotation);
     // Capture current fire generation - used to detect stale requests on rapid visibility toggles
-    uint64_t fireGeneration = controlledProj->GetFireGeneration();
+    spawn.fireGeneration = controlledProj->GetFireGeneration();
+    spawn.requestTime = std::chrono::steady_clock::now();
 
     // Get weak_ptr with proper synchronization - callers don't hold the mutex
-    std::weak_ptr<ControlledProjectile> weakProj;
     {
         std::lock_guard<std::recursive_mutex> lock(m_mutex);
-        auto it = m_projectiles.find(uuid);
+        auto it = m_projectiles.find(spawn.uuid);
         if (it != m_projectiles.end()) {
-            weakProj = it->second;
+            spawn.proj = it->second;
         }
     }
 
-    task->AddTask([weaponPtr, casterPtr, ammoPtr, launchPos, launchRot, weakProj, uuid, fireGeneration]() {
-        spdlog::trace("FireProjectileFor task: ENTER UUID={}", uuid.ToString());
+    return QueueSpawn(std::move(spawn));
+}
 
-        // Check generation BEFORE launching - if stale, don't create the game projectile at all
-        auto proj = weakProj.lock();
-        if (!proj) {
-            spdlog::warn("FireProjectileFor task: ControlledProjectile {} no longer exists", uuid.ToString());
-            return;
+bool ProjectileSubsystem::QueueSpawn(PendingSpawn&& spawn) {
+    // Fire using SKSE task queue for thread safety
+    auto task = SKSE::GetTaskInterface();
+    if (!task) {
+        spdlog::error("QueueSpawn: SKSE task interface not available");
+        return false;
+    }
+
+    // Join the pending batch; only the first request since the last batch queues the task
+    bool queueTask = false;
+    {
+        std::lock_guard<std::mutex> lock(m_spawnMutex);
+        m_pendingSpawns.push_back(std::move(spawn));
+        queueTask = !m_spawnTaskQueued;
+        m_spawnTaskQueued = true;
+    }
+    if (queueTask) {
+        task->AddTask([this]() { ProcessSpawnBatch(); });
+    }
+
+    return true;
+}
+
+void ProjectileSubsystem::ProcessSpawnBatch() {
+    // Take the whole batch; requests made while launching queue a new task
+    {
+        std::lock_guard<std::mutex> lock(m_spawnMutex);
+        m_spawnBatch.swap(m_pendingSpawns);
+        m_spawnTaskQueued = false;
+    }
+    if (m_spawnBatch.empty()) {
+        return;
+    }
+
+    // Shared lookups for the whole batch
+    auto* weaponPtr = GetWeaponForm();
+    auto* casterPtr = GetCasterReference();
+
+    // Get the shooter as an Actor
+    RE::Actor* shooter = casterPtr ? casterPtr->As<RE::Actor>() : nullptr;
+    if (!shooter) {
+        shooter = RE::PlayerCharacter::GetSingleton();
+    }
+
+    if (!shooter || !weaponPtr) {
+        spdlog::error("ProcessSpawnBatch: no valid shooter or weapon, dropping {} requests", m_spawnBatch.size());
+        for (const auto& spawn : m_spawnBatch) {
+            if (spawn.warmFormIndex >= 0) {
+                ParkWarmProjectile(spawn.warmFormIndex, nullptr);
+            }
         }
+        m_spawnBatch.clear();
+        return;
+    }
 
-        if (fireGeneration != proj->GetFireGeneration()) {
-            spdlog::trace("FireProjectileFor task: stale generation ({} vs current {}), not launching",
-                fireGeneration, proj->GetFireGeneration());
-            return;
+    size_t launched = 0;
+    float totalLatencyMs = 0.0f;
+    float maxLatencyMs = 0.0f;
+
+    for (const auto& spawn : m_spawnBatch) {
+        // Pool launches have no owner yet - park them for the next show of their form
+        if (spawn.warmFormIndex >= 0) {
+            RE::Projectile* gameProj = nullptr;
+            if (spawn.ammo) {
+                RE::Projectile::ProjectileRot angles{};
+                angles.x = spawn.launchRot.x;  // pitch
+                angles.z = spawn.launchRot.z;  // yaw
+                RE::ProjectileHandle handle;
+                RE::Projectile::LaunchArrow(&handle, shooter, spawn.ammo, weaponPtr, spawn.launchPos, angles);
+                gameProj = handle ? handle.get().get() : nullptr;
+            }
+            ParkWarmProjectile(spawn.warmFormIndex, gameProj);
+            continue;
         }
 
-        if (!casterPtr || !ammoPtr) {
-            spdlog::error("FireProjectileFor task: missing caster or ammo");
-            return;
+        // Check generation BEFORE launching - if stale, don't create the game projectile at all
+        auto proj = spawn.proj.lock();
+        if (!proj) {
+            spdlog::warn("ProcessSpawnBatch: ControlledProjectile {} no longer exists", spawn.uuid.ToString());
+            continue;
         }
 
-        // Get the shooter as an Actor
-        auto* shooter = casterPtr->As<RE::Actor>();
-        if (!shooter) {
-            shooter = RE::PlayerCharacter::GetSingleton();
+        if (spawn.fireGeneration != proj->GetFireGeneration()) {
+            spdlog::trace("ProcessSpawnBatch: stale generation ({} vs current {}), not launching",
+                spawn.fireGeneration, proj->GetFireGeneration());
+            continue;
         }
 
-        if (!shooter) {
-            spdlog::error("FireProjectileFor task: no valid shooter");
-            return;
+        if (!spawn.ammo) {
+            spdlog::error("ProcessSpawnBatch: missing ammo for UUID={}", spawn.uuid.ToString());
+            continue;
         }
 
         // Set up launch angles from rotation
-        RE::Projectile::ProjectileRot angles;
-        angles.x = launchRot.x;  // pitch
-        angles.z = launchRot.z;  // yaw
+        RE::Projectile::ProjectileRot angles{};
+        angles.x = spawn.launchRot.x;  // pitch
+        angles.z = spawn.launchRot.z;  // yaw
 
         // Launch the projectile
         RE::ProjectileHandle handle;
-        RE::Projectile::LaunchArrow(&handle, shooter, ammoPtr, weaponPtr, launchPos, angles);
-
-        spdlog::trace("FireProjectileFor task: LaunchArrow returned, handle valid={}",
-            static_cast<bool>(handle));
+        RE::Projectile::LaunchArrow(&handle, shooter, spawn.ammo, weaponPtr, spawn.launchPos, angles);
 
         if (!handle) {
-            spdlog::warn("FireProjectileFor task: LaunchArrow returned null handle");
-            return;
+            spdlog::warn("ProcessSpawnBatch: LaunchArrow returned null handle for UUID={}", spawn.uuid.ToString());
+            continue;
         }
 
         // Get the projectile pointer from handle
         RE::Projectile* gameProj = handle.get().get();
         if (!gameProj) {
-            spdlog::error("FireProjectileFor task: handle.get() returned null projectile");
-            return;
+            spdlog::error("ProcessSpawnBatch: handle.get() returned null projectile");
+            continue;
         }
 
         // Bind to the ControlledProjectile's GameProjectile (generation already checked above)
-        proj->BindToProjectile(gameProj, fireGeneration);
-        spdlog::trace("FireProjectileFor task: successfully bound projectile UUID={}", uuid.ToString());
-    });
+        proj->BindToProjectile(gameProj, spawn.fireGeneration);
 
-    return true;
+        float latencyMs = std::chrono::duration<float, std::milli>(
+            std::chrono::steady_clock::now() - spawn.requestTime).count();
+        totalLatencyMs += latencyMs;
+        maxLatencyMs = (std::max)(maxLatencyMs, latencyMs);
+        ++launched;
+    }
+
+    // Route the whole batch's bindings to the hook with one index publish
+    PublishBoundIndex();
+
+    float meanLatencyMs = launched ? totalLatencyMs / static_cast<float>(launched) : 0.0f;
+    spdlog::trace("ProcessSpawnBatch: launched {}/{} projectiles, latency mean {:.2f}ms max {:.2f}ms",
+        launched, m_spawnBatch.size(), meanLatencyMs, maxLatencyMs);
+
+    {
+        std::lock_guard<std::mutex> lock(m_spawnMutex);
+        m_spawnStats.batches++;
+        m_spawnStats.requests += m_spawnBatch.size();
+        m_spawnStats.launched += launched;
+        m_spawnStats.lastBatchSize = m_spawnBatch.size();
+        m_spawnStats.lastBatchMeanLatencyMs = meanLatencyMs;
+        m_spawnStats.lastBatchMaxLatencyMs = maxLatencyMs;
+        m_spawnStats.peakLatencyMs = (std::max)(m_spawnStats.peakLatencyMs, maxLatencyMs);
+    }
+    m_spawnBatch.clear();  // Keeps capacity for the next batch
+}
+
+ProjectileSubsystem::SpawnStats ProjectileSubsystem::GetSpawnStats() const {
+    std::lock_guard<std::mutex> lock(m_spawnMutex);
+    return m_spawnStats;
+}
+
+// =============================================================================
+// Warm pool
+// =============================================================================
+
+RE::Projectile* ProjectileSubsystem::TakeWarmProjectile(int formIndex) {
+    auto it = m_warmPool.find(formIndex);
+    if (it == m_warmPool.end()) {
+        return nullptr;
+    }
+
+    auto& parked = it->second.parked;
+    RE::Projectile* taken = nullptr;
+    while (!taken && !parked.empty()) {
+        ParkedProjectile entry = parked.back();
+        parked.pop_back();
+        m_formManager.ReleaseForm(formIndex);  // The new owner holds its own ref
+        ProjectileHook::DecrementControlledCount();
+
+        if (GameProjectileUtils::IsHandleValid(entry.proj, entry.refHandle)) {
+            taken = entry.proj;
+        } else {
+            ++m_warmStats.expired;
+        }
+    }
+
+    if (!taken) {
+        PublishParkedProjectiles();  // Expired entries only - nothing for the hook to lose
+    }
+    return taken;
 }
 
-int ProjectileSubsystem::AcquireForm(const std::string& modelPath) {
+void ProjectileSubsystem::RefillWarmPool(int formIndex) {
+    auto* ammoForm = m_formManager.GetAmmoForm(formIndex);
+    const auto* slot = m_formManager.GetFormSlot(formIndex);
+    auto* caster = GetCasterReference();
+    if (!ammoForm || !slot || slot->assignedModel.empty() || !caster) {
+        return;
+    }
+
+    auto& pool = m_warmPool[formIndex];
+    while (pool.parked.size() + pool.inFlight < m_warmPoolSize) {
+        // Take a ref so the form keeps its model while the projectile waits in the pool
+        if (m_formManager.AcquireForm(slot->assignedModel) != formIndex) {
+            spdlog::warn("RefillWarmPool: could not take a ref on form {}", formIndex);
+            return;
+        }
+
+        // Launched well below the caster, where it stays hidden until handed out
+        RE::NiPoint3 casterPos = caster->GetPosition();
+        PendingSpawn spawn;
+        spawn.ammo = ammoForm;
+        spawn.launchPos = RE::NiPoint3{casterPos.x, casterPos.y, casterPos.z - 1000.0f};
+        spawn.requestTime = std::chrono::steady_clock::now();
+        spawn.warmFormIndex = formIndex;
+        if (!QueueSpawn(std::move(spawn))) {
+            m_formManager.ReleaseForm(formIndex);
+            return;
+        }
+        ++pool.inFlight;
+    }
+}
+
+void ProjectileSubsystem::ParkWarmProjectile(int formIndex, RE::Projectile* proj) {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+    auto it = m_warmPool.find(formIndex);
+    if (it == m_warmPool.end() || it->second.inFlight == 0) {
+        return;  // Pool was drained while the launch was queued (ref already released)
+    }
+    --it->second.inFlight;
+
+    uint32_t refHandle = GameProjectileUtils::GetOrCreateRefHandle(proj);
+    if (!proj || refHandle == 0) {
+        spdlog::warn("ParkWarmProjectile: launch for form {} failed", formIndex);
+        m_formManager.ReleaseForm(formIndex);
+        return;
+    }
+
+    GameProjectile::HoldParked(proj);
+    it->second.parked.push_back({proj, refHandle});
+    ProjectileHook::IncrementControlledCount();  // Keeps the hook running while only the pool is alive
+    PublishParkedProjectiles();
+}
+
+void ProjectileSubsystem::DrainWarmPool() {
+    for (auto& [formIndex, pool] : m_warmPool) {
+        for (size_t i = 0; i < pool.parked.size() + pool.inFlight; ++i) {
+            m_formManager.ReleaseForm(formIndex);
+        }
+        for (size_t i = 0; i < pool.parked.size(); ++i) {
+            ProjectileHook::DecrementControlledCount();
+        }
+    }
+    // Drained projectiles are left to the game like any unbound projectile. In-flight launches
+    // find no pool entry and are not parked (their refs are released above)
+    m_warmPool.clear();
+    PublishParkedProjectiles();
+}
+
+void ProjectileSubsystem::PublishParkedProjectiles() {
+    auto parked = std::make_shared<ParkedProjectileSet>();
+    for (const auto& [formIndex, pool] : m_warmPool) {
+        for (const auto& entry : pool.parked) {
+            parked->insert(entry.proj);
+        }
+    }
+    m_warmStats.parked = parked->size();
+    m_parkedProjectiles.store(parked->empty() ? nullptr : std::move(parked), std::memory_order_release);
+}
+
+ProjectileSubsystem::WarmPoolStats ProjectileSubsystem::GetWarmPoolStats() const {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    return m_warmStats;
+}
+
+int ProjectileSubsystem::AcquireForm(InternedString modelPath) {
     auto lockStart = std::chrono::high_resolution_clock::now();
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
     auto lockEnd = std::chrono::high_resolution_clock::now();
     auto lockTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(lockEnd - lockStart).count();
     if (lockTimeUs > 200) {
-        spdlog::warn("[LOCK] ProjectileSubsystem::AcquireForm waited {}us (model='{}')", lockTimeUs, modelPath);
+        spdlog::warn("[LOCK] ProjectileSubsystem::AcquireForm waited {}us (model='{}')", lockTimeUs, modelPath.view());
+    }
+    int formIndex = m_formManager.AcquireForm(modelPath);
+    if (formIndex < 0 && !m_warmPool.empty()) {
+        // Parked projectiles are only an optimization - give their forms back to visible elements
+        spdlog::info("ProjectileSubsystem::AcquireForm: out of forms, draining warm pool");
+        DrainWarmPool();
+        formIndex = m_formManager.AcquireForm(modelPath);
     }
-    return m_formManager.AcquireForm(modelPath);
+    return formIndex;
 }
 
 void ProjectileSubsystem::ReleaseForm(int formIndex) {
@@ -3,9 +3,13 @@
 #include "../util/UUID.h"
 #include "ControlledProjectile.h"
 #include "FormManager.h"
+#include <atomic>
+#include <chrono>
 #include <unordered_map>
 #include <memory>
 #include <mutex>
+#include <unordered_set>
+#include <vector>
 
 namespace Projectile {
 
@@ -20,7 +24,7 @@ public:
     // Lifecycle
     bool Initialize();
     void Shutdown();
-    bool IsInitialized() const { return m_initialized; }
+    bool IsInitialized() const { return m_initialized.load(std::memory_order_acquire); }
 
     // === Projectile Management ===
 
@@ -39,11 +43,16 @@ public:
     // === Update (called from ProjectileHook) ===
 
     // Called by ProjectileHook for each projectile update - applies our transform overrides
+    // Lock-free: reads the published bound-projectile index and each projectile's transform mailbox
     void OnProjectileUpdate(RE::Projectile* proj, float delta);
 
+    // Apply the binds/unbinds queued since the last publish to the hook's index in one copy.
+    // Called once per frame by DriverUpdateManager and after each spawn batch.
+    void PublishBoundIndex();
+
     // === Form Management (for ControlledProjectile visibility changes) ===
     // Acquire a form for a model. Returns formIndex or -1 if unavailable.
-    int AcquireForm(const std::string& modelPath);
+    int AcquireForm(InternedString modelPath);
     // Release a form when projectile is hidden/destroyed.
     void ReleaseForm(int formIndex);
 
@@ -51,6 +60,29 @@ public:
     size_t GetActiveCount() const;
     size_t GetUsedForms() const { return m_formManager.GetUsedForms(); }
     size_t GetTotalForms() const { return m_formManager.GetTotalForms(); }
+    size_t GetIdleForms() const { return m_formManager.GetIdleForms(); }
+    FormManager::Stats GetFormStats() const { return m_formManager.GetStats(); }
+
+    // Batched spawning (see FireProjectileFor). Latency is request -> BindToProjectile.
+    struct SpawnStats {
+        uint64_t batches = 0;               // SKSE tasks run
+        uint64_t requests = 0;              // Fire requests processed
+        uint64_t launched = 0;              // Requests bound to a game projectile
+        size_t lastBatchSize = 0;
+        float lastBatchMeanLatencyMs = 0.0f;
+        float lastBatchMaxLatencyMs = 0.0f;
+        float peakLatencyMs = 0.0f;         // Worst latency of any batch so far
+    };
+    SpawnStats GetSpawnStats() const;
+
+    // Warm pool (see FireProjectileFor). A hit is a show bound in the same frame.
+    struct WarmPoolStats {
+        size_t parked = 0;        // Ready to hand out
+        uint64_t hits = 0;        // Shows served from the pool
+        uint64_t misses = 0;      // Shows that had to wait for a spawn batch
+        uint64_t expired = 0;     // Parked projectiles the game destroyed before use
+    };
+    WarmPoolStats GetWarmPoolStats() const;
 
 private:
     ProjectileSubsystem() = default;
@@ -59,14 +91,39 @@ private:
     ProjectileSubsystem& operator=(const ProjectileSubsystem&) = delete;
 
     // Fire a projectile for a ControlledProjectile (binds to its GameProjectile)
-    // Gets transform from the ControlledProjectile itself
+    // Gets transform from the ControlledProjectile itself. Requests are queued and launched
+    // together by a single SKSE task, so opening a menu costs one task instead of one per item.
+    // With a warm pool, a parked projectile of the same form is bound immediately instead.
     bool FireProjectileFor(ControlledProjectile* controlledProj);
 
+    // SKSE task: launch every queued fire request
+    void ProcessSpawnBatch();
+
+    // === Warm pool (all called with m_mutex held) ===
+    // Pop a parked projectile for formIndex that the game hasn't destroyed (nullptr if none).
+    // A taken projectile stays in the published parked set until the caller has indexed it
+    // and calls PublishParkedProjectiles
+    RE::Projectile* TakeWarmProjectile(int formIndex);
+    // Queue pool launches until formIndex has m_warmPoolSize parked or in flight
+    void RefillWarmPool(int formIndex);
+    // Park a projectile launched for the pool (from the spawn batch)
+    void ParkWarmProjectile(int formIndex, RE::Projectile* proj);
+    // Drop every parked projectile and release their forms (the game cleans the projectiles up)
+    void DrainWarmPool();
+    // Publish the parked set read by the hook
+    void PublishParkedProjectiles();
+
     // Unregister a projectile from tracking (called by ControlledProjectile::Destroy)
     void UnregisterProjectile(const UUID& uuid);
 
     // Find a ControlledProjectile by its game projectile pointer (for hook routing)
-    ControlledProjectile* FindByGameProjectile(RE::Projectile* proj);
+    // O(1) lock-free lookup in the published index - called for every arrow in the world each frame
+    ControlledProjectilePtr FindByGameProjectile(RE::Projectile* proj) const;
+
+    // Maintain the game projectile index (called by ControlledProjectile on bind/unbind)
+    // Changes are queued under m_mutex and reach the hook on the next PublishBoundIndex
+    void IndexBoundProjectile(RE::Projectile* gameProj, ControlledProjectile* controlledProj);
+    void UnindexBoundProjectile(RE::Projectile* gameProj);
 
     // Get game forms
     RE::TESObjectWEAP* GetWeaponForm();
@@ -78,7 +135,62 @@ private:
     // Map UUID -> ControlledProjectile (weak refs, shared_ptr owned externally)
     std::unordered_map<UUID, std::weak_ptr<ControlledProjectile>, UUID::Hash> m_projectiles;
 
-    bool m_initialized = false;
+    // Map bound game projectile -> ControlledProjectile (hook routing index)
+    // Immutable snapshots published copy-on-write so the hook never takes m_mutex.
+    // Entries are verified on lookup (GameProjectile::IsBoundTo), so a stale pointer
+    // (unbound since the last publish, or the game destroyed the arrow) is harmless
+    using BoundProjectileIndex = std::unordered_map<RE::Projectile*, std::weak_ptr<ControlledProjectile>>;
+    std::atomic<std::shared_ptr<const BoundProjectileIndex>> m_boundProjectiles;
+
+    // Binds (owner set) and unbinds (owner empty) waiting for PublishBoundIndex, in call order
+    struct IndexChange {
+        RE::Projectile* gameProj = nullptr;
+        std::weak_ptr<ControlledProjectile> owner;
+    };
+    std::vector<IndexChange> m_pendingIndexChanges;  // Guarded by m_mutex
+
+    std::atomic<bool> m_initialized{false};
+
+    // Warm pool: projectiles launched ahead of time for forms in use, hidden and held still by
+    // the hook (GameProjectile::HoldParked). Each parked or in-flight projectile holds a ref on
+    // its form. Used projectiles never go back to the pool - drivers modify their nodes.
+    struct ParkedProjectile {
+        RE::Projectile* proj = nullptr;
+        uint32_t refHandle = 0;
+    };
+    struct WarmForm {
+        std::vector<ParkedProjectile> parked;
+        size_t inFlight = 0;  // Pool launches waiting in the spawn batch
+    };
+    std::unordered_map<int, WarmForm> m_warmPool;  // formIndex -> pool (guarded by m_mutex)
+    size_t m_warmPoolSize = 0;                     // Target per form (0 = off)
+    WarmPoolStats m_warmStats;                     // Guarded by m_mutex
+
+    // Parked projectiles for hook routing, published copy-on-write like m_boundProjectiles
+    using ParkedProjectileSet = std::unordered_set<RE::Projectile*>;
+    std::atomic<std::shared_ptr<const ParkedProjectileSet>> m_parkedProjectiles;
+
+    // Fire requests waiting for the spawn task. A task is queued for the first request after
+    // each batch, and later requests join it until it runs.
+    struct PendingSpawn {
+        std::weak_ptr<ControlledProjectile> proj;
+        UUID uuid;
+        RE::TESAmmo* ammo = nullptr;
+        RE::NiPoint3 launchPos;
+        RE::NiPoint3 launchRot;
+        uint64_t fireGeneration = 0;
+        std::chrono::steady_clock::time_point requestTime;
+        int warmFormIndex = -1;  // >= 0: launch for the warm pool instead of proj
+    };
+    mutable std::mutex m_spawnMutex;
+    std::vector<PendingSpawn> m_pendingSpawns;
+    std::vector<PendingSpawn> m_spawnBatch;  // Being launched (swapped with m_pendingSpawns)
+    bool m_spawnTaskQueued = false;
+    SpawnStats m_spawnStats;                 // Guarded by m_spawnMutex
+
+    // Add a request to the pending batch, queueing the SKSE task if none is queued.
+    // Never called with m_spawnMutex held (m_mutex may be held).
+    bool QueueSpawn(PendingSpawn&& spawn);
 
     // Cached game forms (weapon/caster - projectile/ammo forms moved to FormManager)
     RE::TESObjectWEAP* m_weaponForm = nullptr;
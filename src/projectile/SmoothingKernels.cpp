@@ -0,0 +1,118 @@
+#include "SmoothingKernels.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define SMOOTHING_KERNELS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC/Clang need per-function target attributes to emit AVX2 without -mavx2;
+// MSVC emits any intrinsic regardless of /arch
+#if defined(SMOOTHING_KERNELS_X86) && (defined(__GNUC__) || defined(__clang__))
+#define SMOOTHING_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SMOOTHING_TARGET_AVX2
+#endif
+
+namespace Projectile {
+namespace SmoothingKernels {
+
+namespace {
+
+void LerpMaskedScalar(float* current, const float* target, const float* factor,
+                      const uint32_t* laneMask, size_t begin, size_t count) {
+    for (size_t i = begin; i < count; ++i) {
+        if (laneMask[i]) {
+            current[i] += (target[i] - current[i]) * factor[i];
+        }
+    }
+}
+
+#if defined(SMOOTHING_KERNELS_X86)
+size_t LerpMaskedSSE2(float* current, const float* target, const float* factor,
+                      const uint32_t* laneMask, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 c = _mm_loadu_ps(current + i);
+        __m128 t = _mm_loadu_ps(target + i);
+        __m128 f = _mm_loadu_ps(factor + i);
+        __m128 m = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(laneMask + i)));
+        __m128 lerped = _mm_add_ps(c, _mm_mul_ps(_mm_sub_ps(t, c), f));
+        // Select lerped where mask set, original elsewhere (keeps inactive lanes bit-exact)
+        _mm_storeu_ps(current + i, _mm_or_ps(_mm_and_ps(m, lerped), _mm_andnot_ps(m, c)));
+    }
+    return i;
+}
+
+SMOOTHING_TARGET_AVX2
+size_t LerpMaskedAVX2(float* current, const float* target, const float* factor,
+                      const uint32_t* laneMask, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 c = _mm256_loadu_ps(current + i);
+        __m256 t = _mm256_loadu_ps(target + i);
+        __m256 f = _mm256_loadu_ps(factor + i);
+        __m256 m = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(laneMask + i)));
+        // Separate mul + add (no FMA) to stay bit-identical with the scalar path
+        __m256 lerped = _mm256_add_ps(c, _mm256_mul_ps(_mm256_sub_ps(t, c), f));
+        _mm256_storeu_ps(current + i, _mm256_blendv_ps(c, lerped, m));
+    }
+    return i;
+}
+#endif
+
+}  // namespace
+
+SimdLevel DetectSimdLevel() {
+#if defined(SMOOTHING_KERNELS_X86)
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        // OS must save YMM state (XCR0 bits 1 and 2)
+        if (osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(info, 7, 0);
+            if (info[1] & (1 << 5)) {
+                return SimdLevel::AVX2;
+            }
+        }
+    }
+    return SimdLevel::SSE2;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : SimdLevel::SSE2;
+#endif
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+const char* ToString(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::SSE2: return "SSE2";
+        case SimdLevel::AVX2: return "AVX2";
+        default: return "Scalar";
+    }
+}
+
+void LerpMasked(float* current, const float* target, const float* factor,
+                const uint32_t* laneMask, size_t count, SimdLevel level) {
+    size_t done = 0;
+#if defined(SMOOTHING_KERNELS_X86)
+    if (level == SimdLevel::AVX2) {
+        done = LerpMaskedAVX2(current, target, factor, laneMask, count);
+    } else if (level == SimdLevel::SSE2) {
+        done = LerpMaskedSSE2(current, target, factor, laneMask, count);
+    }
+#endif
+    // Remainder lanes (and the whole array on the scalar path)
+    LerpMaskedScalar(current, target, factor, laneMask, done, count);
+}
+
+}  // namespace SmoothingKernels
+} // namespace Projectile
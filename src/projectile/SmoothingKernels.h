@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Projectile {
+
+// Batch kernels for TransformStore's exponential smoothing pass.
+// Each kernel computes, for every lane i whose mask is set:
+//     current[i] += (target[i] - current[i]) * factor[i]
+// using exactly one subtract, one multiply and one add per lane (no FMA), so every
+// SIMD level produces bit-identical results to the scalar TransformSmoother path.
+namespace SmoothingKernels {
+
+enum class SimdLevel : uint8_t {
+    Scalar,     // Portable fallback
+    SSE2,       // 4 lanes (baseline on x64)
+    AVX2        // 8 lanes
+};
+
+// Best level supported by this CPU/OS (checked once via CPUID)
+SimdLevel DetectSimdLevel();
+const char* ToString(SimdLevel level);
+
+// Lane masks are 0 (skip) or 0xFFFFFFFF (update). Arrays need no particular alignment.
+void LerpMasked(float* current, const float* target, const float* factor,
+                const uint32_t* laneMask, size_t count, SimdLevel level);
+
+}  // namespace SmoothingKernels
+
+} // namespace Projectile
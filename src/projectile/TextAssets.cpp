@@ -1,38 +1,41 @@
 #include "TextAssets.h"
+#include "FontRegistry.h"
+#include "GlyphMetricsTable.h"
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
-#include <sstream>
+#include <optional>
 #include <spdlog/spdlog.h>
 
 namespace Projectile {
 namespace TextAssets {
 
 // =============================================================================
-// Runtime-loaded metrics from CSV
+// Runtime-loaded metrics (binary file if present and current, else CSV)
 // =============================================================================
 
-static std::unordered_map<wchar_t, UVCoord> s_uvCoords;      // UV coordinates from CSV
-static std::unordered_map<wchar_t, float> s_widthRatios;     // Width ratios from CSV
+static FontRegistry s_fonts;
 static bool s_metricsLoaded = false;
-static int s_atlasCols = 0;  // Derived from max col in CSV
-static int s_atlasRows = 0;  // Derived from max row in CSV
+
+namespace {
+    // Main font's metrics, empty until loaded
+    const GlyphMetricsTable& MainTable() {
+        static const GlyphMetricsTable s_empty;
+        return s_fonts.GetFontCount() > 0 ? s_fonts.GetFont(MAIN_FONT).metrics : s_empty;
+    }
+}
 
 const UVCoord* GetCharUV(wchar_t ch) {
-    // Try loading CSV if not loaded yet
+    // Try loading metrics if not loaded yet
     if (!s_metricsLoaded) {
-        if (!LoadMetricsFromCSV()) {
-            spdlog::error("TextAssets: Failed to load character metrics from CSV! Text rendering will not work.");
+        if (!LoadMetrics()) {
+            spdlog::error("TextAssets: Failed to load character metrics! Text rendering will not work.");
             return nullptr;
         }
     }
 
-    // Look up in CSV-loaded coordinates
-    auto it = s_uvCoords.find(ch);
-    if (it != s_uvCoords.end()) {
-        return &it->second;
-    }
-
-    // Character not found in CSV
-    return nullptr;
+    const auto* glyph = MainTable().Find(static_cast<uint32_t>(ch));
+    return glyph ? &glyph->uv : nullptr;
 }
 
 bool IsRenderableChar(wchar_t ch) {
@@ -44,105 +47,122 @@ bool IsRenderableChar(wchar_t ch) {
 }
 
 // =============================================================================
-// Runtime CSV Loading
+// Runtime Metrics Loading
 // =============================================================================
 
-bool LoadMetricsFromCSV() {
-    if (s_metricsLoaded) {
-        return true;
+namespace {
+    // The binary file is only trusted if it's at least as new as the CSV it was built from
+    bool IsBinaryCurrent() {
+        std::error_code ec;
+        auto binaryTime = std::filesystem::last_write_time(TEXT_METRICS_BIN, ec);
+        if (ec) {
+            return false;
+        }
+        auto csvTime = std::filesystem::last_write_time(TEXT_METRICS_CSV, ec);
+        return ec || binaryTime >= csvTime;
     }
 
-    std::ifstream file(TEXT_METRICS_CSV);
-    if (!file.is_open()) {
-        spdlog::warn("TextAssets: Could not open metrics CSV at {}", TEXT_METRICS_CSV);
-        return false;
+    std::optional<GlyphMetricsTable> LoadBinary() {
+        if (!IsBinaryCurrent()) {
+            return std::nullopt;
+        }
+        std::ifstream file(TEXT_METRICS_BIN, std::ios::binary);
+        auto table = GlyphMetricsTable::ReadBinary(file);
+        if (!table) {
+            spdlog::warn("TextAssets: Ignoring unreadable metrics file {}", TEXT_METRICS_BIN);
+        }
+        return table;
     }
 
-    std::string line;
-    // Skip header line
-    if (!std::getline(file, line)) {
-        spdlog::warn("TextAssets: CSV file is empty");
-        return false;
+    std::optional<GlyphMetricsTable> LoadCSV() {
+        std::ifstream file(TEXT_METRICS_CSV);
+        if (!file.is_open()) {
+            spdlog::warn("TextAssets: Could not open metrics CSV at {}", TEXT_METRICS_CSV);
+            return std::nullopt;
+        }
+        auto table = GlyphMetricsTable::ParseCSV(file);
+        if (!table) {
+            spdlog::warn("TextAssets: CSV file is empty");
+        }
+        return table;
     }
 
-    int loadedCount = 0;
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
-
-        // Parse CSV: Character,Unicode,Index,Row,Col,X,Y,Width,WidthRatio
-        std::stringstream ss(line);
-        std::string charStr, unicode, index, row, col, x, y, width, widthRatio;
-
-        std::getline(ss, charStr, ',');
-        std::getline(ss, unicode, ',');
-        std::getline(ss, index, ',');
-        std::getline(ss, row, ',');
-        std::getline(ss, col, ',');
-        std::getline(ss, x, ',');
-        std::getline(ss, y, ',');
-        std::getline(ss, width, ',');
-        std::getline(ss, widthRatio, ',');
-
-        if (charStr.empty() || widthRatio.empty()) continue;
-
-        // Handle the character (could be multi-byte UTF-8)
-        wchar_t ch = 0;
-        if (charStr.size() == 1) {
-            ch = static_cast<wchar_t>(charStr[0]);
-        } else {
-            // Parse Unicode value (U+XXXX format)
-            if (unicode.size() >= 6 && unicode[0] == 'U' && unicode[1] == '+') {
-                unsigned int codepoint = 0;
-                std::stringstream hexss;
-                hexss << std::hex << unicode.substr(2);
-                hexss >> codepoint;
-                ch = static_cast<wchar_t>(codepoint);
-            }
+    KerningTable LoadKerning() {
+        std::ifstream file(TEXT_KERNING_CSV);
+        if (!file.is_open()) {
+            return {};
         }
+        auto kerning = KerningTable::ParseCSV(file);
+        return kerning ? std::move(*kerning) : KerningTable{};
+    }
 
-        if (ch != 0) {
-            try {
-                // Load UV coordinates (Row, Col)
-                int rowVal = std::stoi(row);
-                int colVal = std::stoi(col);
-                s_uvCoords[ch] = UVCoord(colVal, rowVal);
-
-                // Track max row/col for atlas dimensions
-                if (colVal > s_atlasCols) s_atlasCols = colVal;
-                if (rowVal > s_atlasRows) s_atlasRows = rowVal;
-
-                // Load width ratio
-                float ratio = std::stof(widthRatio);
-                s_widthRatios[ch] = ratio;
-
-                loadedCount++;
-            } catch (...) {
-                // Skip invalid lines
+    // Register the fonts of every manifest in FONT_MANIFEST_DIR as fallbacks of the main font
+    void LoadFontManifests() {
+        std::error_code ec;
+        std::vector<std::filesystem::path> manifests;
+        for (const auto& entry : std::filesystem::directory_iterator(FONT_MANIFEST_DIR, ec)) {
+            if (entry.is_regular_file(ec) && entry.path().extension() == ".csv") {
+                manifests.push_back(entry.path());
             }
         }
+        std::sort(manifests.begin(), manifests.end());
+
+        std::vector<FontId> fallbacks;
+        for (const auto& manifestPath : manifests) {
+            std::ifstream manifest(manifestPath);
+            std::vector<std::string> errors;
+            auto added = s_fonts.LoadManifest(manifest, manifestPath.parent_path(), &errors);
+            for (const auto& error : errors) {
+                spdlog::warn("TextAssets: {}: {}", manifestPath.filename().string(), error);
+            }
+            for (FontId font : added) {
+                const auto& loaded = s_fonts.GetFont(font);
+                spdlog::info("TextAssets: Font '{}' - {} characters, {} kerning pairs, atlas {}",
+                    loaded.name, loaded.metrics.GetGlyphCount(), loaded.kerning.Size(), loaded.atlasPath);
+            }
+            fallbacks.insert(fallbacks.end(), added.begin(), added.end());
+        }
+        s_fonts.SetFallbacks(MAIN_FONT, std::move(fallbacks));
     }
+}
 
-    // Convert from max index to count (0-based to 1-based)
-    s_atlasCols += 1;
-    s_atlasRows += 1;
+bool LoadMetrics() {
+    if (s_metricsLoaded) {
+        return true;
+    }
 
+    const char* source = TEXT_METRICS_BIN;
+    auto table = LoadBinary();
+    if (!table) {
+        source = TEXT_METRICS_CSV;
+        table = LoadCSV();
+    }
+    if (!table) {
+        return false;
+    }
+
+    s_fonts.AddFont("main", TEXT_ATLAS_PATH, std::move(*table), LoadKerning());
     s_metricsLoaded = true;
-    spdlog::info("TextAssets: Loaded {} characters from CSV (atlas {}x{})", loadedCount, s_atlasCols, s_atlasRows);
+    const auto& main = s_fonts.GetFont(MAIN_FONT);
+    spdlog::info("TextAssets: Loaded {} characters from {} (atlas {}x{}, {} dense pages, {} sparse, {} kerning pairs)",
+        main.metrics.GetGlyphCount(), source, main.metrics.GetAtlasCols(), main.metrics.GetAtlasRows(),
+        main.metrics.GetDensePageCount(), main.metrics.GetSparseCount(), main.kerning.Size());
+
+    LoadFontManifests();
     return true;
 }
 
 float GetWidthRatio(wchar_t ch) {
     // Try loading if not loaded yet
     if (!s_metricsLoaded) {
-        LoadMetricsFromCSV();
+        LoadMetrics();
     }
 
-    auto it = s_widthRatios.find(ch);
-    if (it != s_widthRatios.end()) {
-        return it->second;
+    if (const auto* glyph = MainTable().Find(static_cast<uint32_t>(ch))) {
+        return glyph->widthRatio;
     }
 
-    spdlog::error("TextAssets::GetWidthRatio - Character not found in CSV: '{}' (U+{:04X})",
+    spdlog::error("TextAssets::GetWidthRatio - Character not found in metrics: '{}' (U+{:04X})",
         static_cast<char>(ch <= 127 ? ch : '?'), static_cast<unsigned int>(ch));
     return 0.0f;
 }
@@ -153,16 +173,23 @@ bool IsMetricsLoaded() {
 
 int GetAtlasCols() {
     if (!s_metricsLoaded) {
-        LoadMetricsFromCSV();
+        LoadMetrics();
     }
-    return s_atlasCols;
+    return MainTable().GetAtlasCols();
 }
 
 int GetAtlasRows() {
     if (!s_metricsLoaded) {
-        LoadMetricsFromCSV();
+        LoadMetrics();
+    }
+    return MainTable().GetAtlasRows();
+}
+
+const FontRegistry& GetFonts() {
+    if (!s_metricsLoaded) {
+        LoadMetrics();
     }
-    return s_atlasRows;
+    return s_fonts;
 }
 
 } // namespace TextAssets
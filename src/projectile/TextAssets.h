@@ -1,9 +1,12 @@
 #pragma once
 
-#include <unordered_map>
+#include <cstdint>
 #include <string>
 
 namespace Projectile {
+
+class FontRegistry;
+
 namespace TextAssets {
 
 // =============================================================================
@@ -19,6 +22,19 @@ constexpr const char* TEXT_ATLAS_PATH = "textures\\3DUI\\text_atlas_main.dds";
 // Character metrics CSV (relative to SKSE plugins folder)
 constexpr const char* TEXT_METRICS_CSV = "Data\\SKSE\\Plugins\\3DUI\\text_atlas_main_mapping.csv";
 
+// Optional precompiled metrics (written by generate_atlas.py), preferred over the CSV unless older
+constexpr const char* TEXT_METRICS_BIN = "Data\\SKSE\\Plugins\\3DUI\\text_atlas_main_mapping.bin";
+
+// Optional pair kerning for the main atlas: Left,Right,Adjust (U+XXXX, width ratio units)
+constexpr const char* TEXT_KERNING_CSV = "Data\\SKSE\\Plugins\\3DUI\\text_atlas_main_kerning.csv";
+
+// Extra fonts: every *.csv here is a font manifest (see FontRegistry::LoadManifest), loaded
+// in name order. Their fonts become the main font's fallbacks.
+constexpr const char* FONT_MANIFEST_DIR = "Data\\SKSE\\Plugins\\3DUI\\Fonts";
+
+// The built-in atlas is always the first registered font
+constexpr uint16_t MAIN_FONT = 0;
+
 // =============================================================================
 // Character Spacing
 // =============================================================================
@@ -41,29 +57,34 @@ struct UVCoord {
 };
 
 // Get UV coordinates for a character (returns nullptr if not found)
-// Loaded from CSV at runtime
+// Loaded from the metrics file at runtime
 const UVCoord* GetCharUV(wchar_t ch);
 
 // Check if character is renderable
 bool IsRenderableChar(wchar_t ch);
 
 // =============================================================================
-// Runtime CSV Loading
+// Runtime Metrics Loading
 // =============================================================================
 
-// Load character metrics from CSV file (call once at startup)
-bool LoadMetricsFromCSV();
+// Load character metrics from the binary metrics file, or the CSV if that's missing or
+// stale (call once at startup)
+bool LoadMetrics();
 
 // Get width ratio for a character (0.0-1.0+ relative to cell size)
 // Returns 0 and logs error if character not found
 float GetWidthRatio(wchar_t ch);
 
-// Check if metrics were loaded from CSV
+// Check if metrics were loaded
 bool IsMetricsLoaded();
 
-// Get atlas dimensions (derived from max row/col in CSV)
+// Get atlas dimensions (derived from max row/col in the metrics)
 int GetAtlasCols();
 int GetAtlasRows();
 
+// All fonts: MAIN_FONT plus those from FONT_MANIFEST_DIR. Loads metrics on first use;
+// empty if the main metrics couldn't be loaded.
+const FontRegistry& GetFonts();
+
 } // namespace TextAssets
 } // namespace Projectile
@@ -0,0 +1,305 @@
+#include "TextLayout.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace Projectile {
+
+namespace {
+    bool IsWhitespace(wchar_t ch) {
+        return ch == L' ' || ch == L'\t' || ch == L'\u00A0';
+    }
+
+    bool SameUV(const TextAssets::UVCoord& a, const TextAssets::UVCoord& b) {
+        return a.col == b.col && a.row == b.row;
+    }
+}
+
+// =============================================================================
+// TextLayout
+// =============================================================================
+
+namespace {
+    // Shared by both metric sources. kerning(font, left, right) is the pair adjustment in
+    // width ratio units.
+    template <class MetricsFn, class KerningFn>
+    TextLayout ComputeLayout(const std::wstring& text, const TextLayoutParams& params,
+                             MetricsFn metrics, KerningFn kerning)
+    {
+        TextLayout layout;
+        if (text.empty()) {
+            return layout;
+        }
+
+        const float letterDistance = params.letterDistance;
+        const float lineHeight = params.characterHeight * params.lineSpacing;
+        layout.glyphs.reserve(text.size());
+
+        // Lines are split by \n and aligned independently
+        size_t lineStart = 0;
+        int lineIndex = 0;
+        while (lineStart <= text.size()) {
+            size_t lineEnd = text.find(L'\n', lineStart);
+            if (lineEnd == std::wstring::npos) {
+                lineEnd = text.size();
+            }
+
+            float yOffset = -lineIndex * lineHeight;  // Negative because subsequent lines go down
+            size_t firstGlyph = layout.glyphs.size();
+            float currentX = 0.0f;
+            wchar_t previous = 0;           // Kerning partner, reset by whitespace and missing glyphs
+            FontId previousFont = 0;
+
+            for (size_t i = lineStart; i < lineEnd; ++i) {
+                wchar_t ch = text[i];
+                GlyphMetrics glyph = metrics(ch);
+
+                // Spaces/tabs add to position but don't render
+                if (!IsWhitespace(ch)) {
+                    if (previous && glyph.uv && previousFont == glyph.font) {
+                        currentX += letterDistance * kerning(glyph.font, previous, ch);
+                    }
+
+                    LaidOutGlyph& laid = layout.glyphs.emplace_back();
+                    laid.ch = ch;
+                    laid.x = currentX;
+                    laid.y = yOffset;
+                    laid.widthRatio = glyph.widthRatio;
+                    if (glyph.uv) {
+                        laid.uv = *glyph.uv;
+                        laid.font = glyph.font;
+                        laid.visible = true;
+                        if (std::find(layout.fonts.begin(), layout.fonts.end(), glyph.font) == layout.fonts.end()) {
+                            layout.fonts.push_back(glyph.font);
+                        }
+                    }
+                    previous = laid.visible ? ch : 0;
+                    previousFont = glyph.font;
+                } else {
+                    previous = 0;
+                }
+
+                currentX += letterDistance * (glyph.widthRatio + TextAssets::CHAR_GAP);
+            }
+
+            // Align the line on its first and last glyph's left edges
+            if (layout.glyphs.size() > firstGlyph) {
+                float firstPosX = layout.glyphs[firstGlyph].x;
+                float lastPosX = layout.glyphs.back().x;
+                float centerOffset = (firstPosX + lastPosX) / -2.0f;
+                float totalWidth = lastPosX - firstPosX;
+
+                float alignOffset = centerOffset;
+                switch (params.alignment) {
+                    case TextAlignment::Left:
+                        alignOffset = totalWidth / 2.0f + centerOffset;
+                        break;
+                    case TextAlignment::Right:
+                        alignOffset = -totalWidth / 2.0f + centerOffset;
+                        break;
+                    case TextAlignment::Center:
+                    default:
+                        break;
+                }
+
+                for (size_t i = firstGlyph; i < layout.glyphs.size(); ++i) {
+                    layout.glyphs[i].x += alignOffset;
+                }
+            }
+
+            lineStart = lineEnd + 1;
+            ++lineIndex;
+        }
+
+        // Bounds over visible glyphs: width from the glyph's ratio, half a character height
+        // above and below the line center
+        bool foundFirst = false;
+        TextBounds& bounds = layout.bounds;
+        for (const auto& glyph : layout.glyphs) {
+            if (!glyph.visible) {
+                continue;
+            }
+
+            float left = glyph.x;
+            float right = glyph.x + letterDistance * glyph.widthRatio;
+            float top = glyph.y + params.characterHeight * 0.5f;
+            float bottom = glyph.y - params.characterHeight * 0.5f;
+
+            if (!foundFirst) {
+                bounds.minX = left;
+                bounds.maxX = right;
+                bounds.minY = bottom;
+                bounds.maxY = top;
+                foundFirst = true;
+            } else {
+                bounds.minX = (std::min)(bounds.minX, left);
+                bounds.maxX = (std::max)(bounds.maxX, right);
+                bounds.minY = (std::min)(bounds.minY, bottom);
+                bounds.maxY = (std::max)(bounds.maxY, top);
+            }
+        }
+
+        if (foundFirst) {
+            bounds.width = bounds.maxX - bounds.minX;
+            bounds.height = bounds.maxY - bounds.minY;
+        }
+
+        return layout;
+    }
+}
+
+TextLayout TextLayout::Compute(const std::wstring& text, const TextLayoutParams& params, GlyphMetricsFn metrics) {
+    return ComputeLayout(text, params, metrics, [](FontId, wchar_t, wchar_t) { return 0.0f; });
+}
+
+TextLayout TextLayout::Compute(const std::wstring& text, const TextLayoutParams& params, const FontRegistry& fonts) {
+    if (fonts.GetFontCount() == 0) {
+        return ComputeLayout(text, params, [](wchar_t) { return GlyphMetrics{}; },
+                             [](FontId, wchar_t, wchar_t) { return 0.0f; });
+    }
+
+    FontId font = params.font < fonts.GetFontCount() ? params.font : FontId(0);
+    auto metrics = [&fonts, font](wchar_t ch) {
+        auto resolved = fonts.Resolve(font, static_cast<uint32_t>(ch));
+        return resolved.glyph ? GlyphMetrics{resolved.glyph->widthRatio, &resolved.glyph->uv, resolved.font}
+                              : GlyphMetrics{};
+    };
+    auto kerning = [&fonts](FontId glyphFont, wchar_t left, wchar_t right) {
+        return fonts.GetKerning(glyphFont, static_cast<uint32_t>(left), static_cast<uint32_t>(right));
+    };
+    return ComputeLayout(text, params, metrics, kerning);
+}
+
+// =============================================================================
+// TextLayoutCache
+// =============================================================================
+
+bool TextLayoutCache::Key::operator==(const Key& other) const {
+    return text == other.text &&
+           params.alignment == other.params.alignment &&
+           params.lineSpacing == other.params.lineSpacing &&
+           params.letterDistance == other.params.letterDistance &&
+           params.characterHeight == other.params.characterHeight &&
+           params.font == other.params.font;
+}
+
+size_t TextLayoutCache::KeyHash::operator()(const Key& key) const {
+    size_t hash = std::hash<std::wstring>{}(key.text);
+    auto combine = [&hash](size_t value) {
+        hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    };
+    combine(static_cast<size_t>(key.params.alignment));
+    combine(std::hash<float>{}(key.params.lineSpacing));
+    combine(std::hash<float>{}(key.params.letterDistance));
+    combine(std::hash<float>{}(key.params.characterHeight));
+    combine(key.params.font);
+    return hash;
+}
+
+TextLayoutCache::TextLayoutCache(GlyphMetricsFn metrics, size_t capacity)
+    : m_metrics(metrics)
+    , m_capacity((std::max)(capacity, size_t(1)))
+{
+}
+
+TextLayoutCache::TextLayoutCache(const FontRegistry* fonts, size_t capacity)
+    : m_fonts(fonts)
+    , m_capacity((std::max)(capacity, size_t(1)))
+{
+}
+
+std::shared_ptr<const TextLayout> TextLayoutCache::Get(const std::wstring& text, const TextLayoutParams& params) {
+    Key key{text, params};
+    {
+        std::lock_guard lock(m_mutex);
+        if (auto it = m_entries.find(key); it != m_entries.end()) {
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lruPos);
+            ++m_stats.hits;
+            return it->second.layout;
+        }
+        ++m_stats.misses;
+    }
+
+    // Compute outside the lock; a racing miss on the same key just computes it twice
+    auto layout = std::make_shared<const TextLayout>(m_fonts
+        ? TextLayout::Compute(text, params, *m_fonts)
+        : TextLayout::Compute(text, params, m_metrics));
+
+    std::lock_guard lock(m_mutex);
+    if (auto it = m_entries.find(key); it != m_entries.end()) {
+        return it->second.layout;
+    }
+
+    m_lru.push_front(key);
+    m_entries.emplace(std::move(key), Entry{layout, m_lru.begin()});
+
+    while (m_entries.size() > m_capacity) {
+        m_entries.erase(m_lru.back());
+        m_lru.pop_back();
+        ++m_stats.evictions;
+    }
+    return layout;
+}
+
+void TextLayoutCache::Clear() {
+    std::lock_guard lock(m_mutex);
+    m_entries.clear();
+    m_lru.clear();
+}
+
+TextLayoutCache::Stats TextLayoutCache::GetStats() const {
+    std::lock_guard lock(m_mutex);
+    Stats stats = m_stats;
+    stats.entries = m_entries.size();
+    return stats;
+}
+
+// =============================================================================
+// Incremental glyph updates
+// =============================================================================
+
+void PlanGlyphNodeUpdates(const TextLayout& layout, std::vector<GlyphNodeState>& states,
+                          std::vector<GlyphNodeUpdate>& outUpdates)
+{
+    for (size_t i = 0; i < states.size(); ++i) {
+        GlyphNodeState& state = states[i];
+        GlyphNodeUpdate update;
+        update.node = static_cast<uint32_t>(i);
+
+        const LaidOutGlyph* glyph = i < layout.glyphs.size() ? &layout.glyphs[i] : nullptr;
+        if (glyph && glyph->visible) {
+            if (!state.known || !state.shown) {
+                update.ops |= GlyphNodeUpdate::Show;
+            }
+            if (!state.known || !state.shown || state.x != glyph->x || state.y != glyph->y) {
+                update.ops |= GlyphNodeUpdate::Move;
+            }
+            // A hidden node's UV scale was zeroed, so showing it always rewrites the UV
+            if (!state.known || !state.shown || !SameUV(state.uv, glyph->uv)) {
+                update.ops |= GlyphNodeUpdate::SetUV;
+            }
+            // The node's texture survives hiding and 3D changes, so font is tracked even
+            // while the rest of the state is unknown
+            if (state.font != glyph->font) {
+                update.ops |= GlyphNodeUpdate::SetFont | GlyphNodeUpdate::SetUV;
+            }
+            state.shown = true;
+            state.x = glyph->x;
+            state.y = glyph->y;
+            state.uv = glyph->uv;
+            state.font = glyph->font;
+        } else {
+            if (!state.known || state.shown) {
+                update.ops |= GlyphNodeUpdate::Hide;
+            }
+            state.shown = false;
+        }
+        state.known = true;
+
+        if (update.ops) {
+            outUpdates.push_back(update);
+        }
+    }
+}
+
+} // namespace Projectile
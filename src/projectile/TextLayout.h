@@ -0,0 +1,184 @@
+#pragma once
+
+#if !defined(TEST_ENVIRONMENT)
+#include <RE/Skyrim.h>
+#else
+#include "TestStubs.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "FontRegistry.h"
+#include "TextAssets.h"
+
+namespace Projectile {
+
+// =============================================================================
+// TextBounds
+// Represents the bounding box of rendered text in driver local space
+// =============================================================================
+struct TextBounds {
+    float minX = 0.0f;
+    float maxX = 0.0f;
+    float minY = 0.0f;
+    float maxY = 0.0f;
+    float width = 0.0f;
+    float height = 0.0f;
+
+    RE::NiPoint3 GetCenter() const {
+        return RE::NiPoint3((minX + maxX) * 0.5f, (minY + maxY) * 0.5f, 0.0f);
+    }
+
+    bool IsEmpty() const { return width <= 0.0f; }
+};
+
+// =============================================================================
+// TextAlignment
+// =============================================================================
+enum class TextAlignment {
+    Left,
+    Center,
+    Right
+};
+
+// Atlas data for one character. uv is null for characters missing from the atlas.
+struct GlyphMetrics {
+    float widthRatio = 0.0f;
+    const TextAssets::UVCoord* uv = nullptr;
+    FontId font = 0;                // Font whose atlas uv refers to
+};
+
+// Metrics source - TextAssets in game, fixed tables in tests
+using GlyphMetricsFn = GlyphMetrics (*)(wchar_t ch);
+
+struct TextLayoutParams {
+    TextAlignment alignment = TextAlignment::Center;
+    float lineSpacing = 1.2f;       // Multiplier of character height between lines
+    float letterDistance = TextAssets::BASE_LETTER_DISTANCE;
+    float characterHeight = 100.0f;
+    FontId font = 0;                // Registry font; fallbacks supply characters it lacks
+};
+
+// One rendered character. Whitespace and newlines get no glyph.
+struct LaidOutGlyph {
+    wchar_t ch = 0;
+    float x = 0.0f;                 // Left edge
+    float y = 0.0f;                 // Line center
+    float widthRatio = 0.0f;
+    TextAssets::UVCoord uv;
+    FontId font = 0;                // Atlas uv is in
+    bool visible = false;           // False if the character isn't in the atlas
+};
+
+// =============================================================================
+// TextLayout
+// Glyph positions for a string, in unscaled driver-local units (the text projectile's
+// base scale applies TextDriver's text scale, so layouts don't depend on it).
+//
+// With a FontRegistry each character resolves through params.font's fallback chain, and
+// adjacent glyphs from the same font are kerned (whitespace breaks a pair).
+// =============================================================================
+struct TextLayout {
+    std::vector<LaidOutGlyph> glyphs;
+    TextBounds bounds;              // Over visible glyphs
+    std::vector<FontId> fonts;      // Fonts of the visible glyphs, in first-use order
+
+    static TextLayout Compute(const std::wstring& text, const TextLayoutParams& params, GlyphMetricsFn metrics);
+    static TextLayout Compute(const std::wstring& text, const TextLayoutParams& params, const FontRegistry& fonts);
+};
+
+// =============================================================================
+// TextLayoutCache
+// LRU of computed layouts keyed by (text, layout params), so texts that come
+// back - tooltips, labels toggled between a few states - skip layout entirely.
+// Layouts are immutable and shared; thread-safe.
+// =============================================================================
+class TextLayoutCache {
+public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t entries = 0;
+    };
+
+    TextLayoutCache(GlyphMetricsFn metrics, size_t capacity);
+    // fonts must outlive the cache
+    TextLayoutCache(const FontRegistry* fonts, size_t capacity);
+
+    std::shared_ptr<const TextLayout> Get(const std::wstring& text, const TextLayoutParams& params);
+
+    void Clear();
+    Stats GetStats() const;
+
+private:
+    struct Key {
+        std::wstring text;
+        TextLayoutParams params;
+
+        bool operator==(const Key& other) const;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    using LruList = std::list<Key>;
+
+    struct Entry {
+        std::shared_ptr<const TextLayout> layout;
+        LruList::iterator lruPos;
+    };
+
+    GlyphMetricsFn m_metrics = nullptr;
+    const FontRegistry* m_fonts = nullptr;  // Used instead of m_metrics when set
+    size_t m_capacity;
+
+    mutable std::mutex m_mutex;
+    LruList m_lru;                  // Front = most recently used
+    std::unordered_map<Key, Entry, KeyHash> m_entries;
+    Stats m_stats;
+};
+
+// =============================================================================
+// Incremental glyph updates
+// TextDriver keeps what each character node currently shows; when the text changes only
+// nodes whose glyph, position or visibility differ are rewritten.
+// =============================================================================
+
+// What a character node currently shows
+struct GlyphNodeState {
+    bool known = false;             // False for a node we haven't written yet - write everything
+    bool shown = false;
+    float x = 0.0f;
+    float y = 0.0f;
+    TextAssets::UVCoord uv;
+    FontId font = 0;                // Atlas bound to the node's material - valid even when !known
+};
+
+struct GlyphNodeUpdate {
+    enum Op : uint8_t {
+        Show = 1 << 0,
+        Hide = 1 << 1,              // HideNodeByPosition + HideCharacter
+        Move = 1 << 2,              // Set local X/Z to the glyph position
+        SetUV = 1 << 3,
+        SetFont = 1 << 4            // Bind the font's atlas texture (always with SetUV)
+    };
+
+    uint32_t node = 0;              // Node index, glyph i goes on node i
+    uint8_t ops = 0;
+};
+
+// Append the updates that make states (one per node) show layout, and apply them to states.
+// Glyphs beyond states.size() are dropped; nodes beyond the glyphs are hidden.
+void PlanGlyphNodeUpdates(const TextLayout& layout, std::vector<GlyphNodeState>& states,
+                          std::vector<GlyphNodeUpdate>& outUpdates);
+
+} // namespace Projectile
@@ -0,0 +1,53 @@
+#include "TextureCache.h"
+
+#include <algorithm>
+
+namespace Projectile {
+
+namespace {
+    // Bytes per 4x4 block for block-compressed DXGI formats, 0 if not block-compressed
+    uint32_t BlockBytes(uint32_t dxgiFormat) {
+        if ((dxgiFormat >= 70 && dxgiFormat <= 72) ||    // BC1
+            (dxgiFormat >= 79 && dxgiFormat <= 81)) {    // BC4
+            return 8;
+        }
+        if ((dxgiFormat >= 73 && dxgiFormat <= 78) ||    // BC2, BC3
+            (dxgiFormat >= 82 && dxgiFormat <= 84) ||    // BC5
+            (dxgiFormat >= 94 && dxgiFormat <= 99)) {    // BC6H, BC7
+            return 16;
+        }
+        return 0;
+    }
+
+    // Bits per pixel for uncompressed DXGI formats (32 for anything not listed)
+    uint32_t BitsPerPixel(uint32_t dxgiFormat) {
+        if (dxgiFormat >= 1 && dxgiFormat <= 4) return 128;    // R32G32B32A32
+        if (dxgiFormat >= 9 && dxgiFormat <= 14) return 64;    // R16G16B16A16
+        if ((dxgiFormat >= 48 && dxgiFormat <= 52) ||          // R8G8
+            dxgiFormat == 85 || dxgiFormat == 86) return 16;   // B5G6R5, B5G5R5A1
+        if (dxgiFormat >= 60 && dxgiFormat <= 65) return 8;    // R8, A8
+        return 32;
+    }
+}
+
+size_t EstimateTextureBytes(uint32_t width, uint32_t height, uint32_t mipLevels,
+                            uint32_t arraySize, uint32_t dxgiFormat) {
+    uint32_t blockBytes = BlockBytes(dxgiFormat);
+    uint32_t bitsPerPixel = BitsPerPixel(dxgiFormat);
+
+    size_t total = 0;
+    uint32_t w = (std::max)(width, 1u);
+    uint32_t h = (std::max)(height, 1u);
+    for (uint32_t mip = 0; mip < (std::max)(mipLevels, 1u); ++mip) {
+        if (blockBytes) {
+            total += static_cast<size_t>((w + 3) / 4) * ((h + 3) / 4) * blockBytes;
+        } else {
+            total += (static_cast<size_t>(w) * h * bitsPerPixel + 7) / 8;
+        }
+        w = (std::max)(w / 2, 1u);
+        h = (std::max)(h / 2, 1u);
+    }
+    return total * (std::max)(arraySize, 1u);
+}
+
+} // namespace Projectile
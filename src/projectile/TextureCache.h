@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include "../util/StringTable.h"
+
+namespace Projectile {
+
+// Size in bytes of a 2D texture (all mips and array slices) in the given DXGI format.
+// Block-compressed formats are sized in 4x4 blocks; unknown formats count as 32bpp.
+size_t EstimateTextureBytes(uint32_t width, uint32_t height, uint32_t mipLevels,
+                            uint32_t arraySize, uint32_t dxgiFormat);
+
+// =============================================================================
+// TextureCache
+// Byte-budgeted LRU cache of loaded textures, keyed by interned path (not thread-safe -
+// AsyncTextureLoader guards it with its cache mutex).
+//
+// - Inserting past the budget evicts least recently used textures first
+// - Pinned paths (in use by a live projectile) are never evicted; pins may be taken
+//   before the texture is loaded
+// - Texture is any copyable handle (NiPointer in game, a fake type in tests)
+// =============================================================================
+template <class Texture>
+class TextureCache {
+public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+        uint64_t evictedBytes = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+        size_t peakBytes = 0;
+        size_t pinnedEntries = 0;  // Cached and pinned
+    };
+
+    explicit TextureCache(size_t budgetBytes = 0) : m_budget(budgetBytes) {}
+
+    // 0 = unbounded. Shrinking evicts down to the new budget.
+    void SetBudget(size_t budgetBytes) {
+        m_budget = budgetBytes;
+        EvictToBudget(m_lru.end());
+    }
+    size_t GetBudget() const { return m_budget; }
+
+    // Cached texture (refreshing its LRU position), or an empty Texture.
+    // countMiss=false for lookups that don't load on a miss, so misses aren't counted twice.
+    Texture Find(InternedString key, bool countMiss = true) {
+        auto it = m_index.find(key);
+        if (it == m_index.end()) {
+            m_stats.misses += countMiss;
+            return Texture();
+        }
+        ++m_stats.hits;
+        m_lru.splice(m_lru.begin(), m_lru, it->second);
+        return it->second->texture;
+    }
+
+    bool Contains(InternedString key) const { return m_index.contains(key); }
+
+    // Add or replace a texture, then evict down to the budget (never the new entry itself)
+    void Insert(InternedString key, Texture texture, size_t bytes) {
+        auto it = m_index.find(key);
+        if (it != m_index.end()) {
+            m_bytes -= it->second->bytes;
+            it->second->texture = std::move(texture);
+            it->second->bytes = bytes;
+            m_lru.splice(m_lru.begin(), m_lru, it->second);
+        } else {
+            m_lru.push_front({key, std::move(texture), bytes});
+            m_index.emplace(key, m_lru.begin());
+        }
+        m_bytes += bytes;
+        ++m_stats.insertions;
+        if (m_bytes > m_stats.peakBytes) {
+            m_stats.peakBytes = m_bytes;
+        }
+        EvictToBudget(m_lru.begin());
+    }
+
+    // Pins nest - each Pin needs a matching Unpin
+    void Pin(InternedString key) { ++m_pins[key]; }
+
+    void Unpin(InternedString key) {
+        auto it = m_pins.find(key);
+        if (it == m_pins.end()) {
+            return;
+        }
+        if (--it->second == 0) {
+            m_pins.erase(it);
+            EvictToBudget(m_lru.end());  // May have been holding the cache over budget
+        }
+    }
+
+    bool IsPinned(InternedString key) const { return m_pins.contains(key); }
+
+    // Drop every unpinned texture
+    void Clear() {
+        for (auto it = m_lru.begin(); it != m_lru.end();) {
+            it = IsPinned(it->key) ? std::next(it) : Erase(it);
+        }
+    }
+
+    size_t Size() const { return m_index.size(); }
+    size_t GetBytes() const { return m_bytes; }
+
+    Stats GetStats() const {
+        Stats stats = m_stats;
+        stats.entries = m_index.size();
+        stats.bytes = m_bytes;
+        for (const auto& [key, count] : m_pins) {
+            stats.pinnedEntries += m_index.contains(key);
+        }
+        return stats;
+    }
+
+private:
+    struct Entry {
+        InternedString key;
+        Texture texture;
+        size_t bytes;
+    };
+    using EntryList = std::list<Entry>;  // Front = most recently used
+
+    typename EntryList::iterator Erase(typename EntryList::iterator it) {
+        m_bytes -= it->bytes;
+        m_index.erase(it->key);
+        return m_lru.erase(it);
+    }
+
+    // Evict unpinned entries from the LRU end until under budget, sparing keep
+    void EvictToBudget(typename EntryList::iterator keep) {
+        if (m_budget == 0) {
+            return;
+        }
+        auto it = m_lru.end();
+        while (m_bytes > m_budget && it != m_lru.begin()) {
+            --it;
+            if (it == keep || IsPinned(it->key)) {
+                continue;
+            }
+            ++m_stats.evictions;
+            m_stats.evictedBytes += it->bytes;
+            it = Erase(it);
+        }
+    }
+
+    EntryList m_lru;
+    std::unordered_map<InternedString, typename EntryList::iterator, InternedString::Hash> m_index;
+    std::unordered_map<InternedString, uint32_t, InternedString::Hash> m_pins;
+    size_t m_budget = 0;
+    size_t m_bytes = 0;
+    Stats m_stats;
+};
+
+} // namespace Projectile
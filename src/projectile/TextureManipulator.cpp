@@ -11,7 +11,11 @@ namespace Projectile {
 // =============================================================================
 
 bool TextureManipulator::SetCharUV(RE::NiAVObject* node, const TextAssets::UVCoord& uv) {
-    if (!node) {
+    return SetCharUV(node, uv, TextAssets::GetAtlasCols(), TextAssets::GetAtlasRows());
+}
+
+bool TextureManipulator::SetCharUV(RE::NiAVObject* node, const TextAssets::UVCoord& uv, int atlasCols, int atlasRows) {
+    if (!node || atlasCols <= 0 || atlasRows <= 0) {
         return false;
     }
 
@@ -23,8 +27,8 @@ bool TextureManipulator::SetCharUV(RE::NiAVObject* node, const TextAssets::UVCoo
 
     // Calculate UV using direct division to minimize float precision issues
     // Using double for intermediate calculation, then cast to float at the end
-    const double cols = static_cast<double>(TextAssets::GetAtlasCols());
-    const double rows = static_cast<double>(TextAssets::GetAtlasRows());
+    const double cols = static_cast<double>(atlasCols);
+    const double rows = static_cast<double>(atlasRows);
 
     // Scale factor - halved because mesh UVs span 2x the cell size (range: -0.5 to 1.5)
     float scaleX = static_cast<float>(1.0 / cols * 0.5);
@@ -63,46 +67,60 @@ bool TextureManipulator::HideCharacter(RE::NiAVObject* node) {
 // New code should use AsyncTextureLoader for non-blocking loads
 static std::unordered_map<std::string, RE::NiPointer<RE::NiTexture>> s_textureCache;
 
-bool TextureManipulator::SetTexture(RE::NiAVObject* node, const char* texturePath) {
-
-    if (!node || !texturePath) {
-        spdlog::error("TextureManipulator::SetTexture - null node or texturePath");
-        return false;
-    }
-
+RE::BSEffectShaderMaterial* TextureManipulator::GetEffectMaterial(RE::NiAVObject* node, const char* caller,
+                                                                  RE::BSGeometry*& outGeometry,
+                                                                  RE::BSShaderProperty*& outShaderProperty) {
     auto* geometry = node->AsGeometry();
     if (!geometry) {
-        spdlog::error("TextureManipulator::SetTexture - node is not geometry");
-        return false;
+        spdlog::error("TextureManipulator::{} - node is not geometry", caller);
+        return nullptr;
     }
 
     auto* effectState = geometry->GetGeometryRuntimeData().properties[RE::BSGeometry::States::kEffect].get();
     if (!effectState) {
-        spdlog::error("TextureManipulator::SetTexture - no effect state on geometry");
-        return false;
+        spdlog::error("TextureManipulator::{} - no effect state on geometry", caller);
+        return nullptr;
     }
 
     auto* shaderProperty = netimmerse_cast<RE::BSShaderProperty*>(effectState);
     if (!shaderProperty) {
-        spdlog::error("TextureManipulator::SetTexture - effectState is not BSShaderProperty");
-        return false;
+        spdlog::error("TextureManipulator::{} - effectState is not BSShaderProperty", caller);
+        return nullptr;
     }
 
     auto* material = shaderProperty->material;
     if (!material) {
-        spdlog::error("TextureManipulator::SetTexture - shaderProperty has no material");
-        return false;
+        spdlog::error("TextureManipulator::{} - shaderProperty has no material", caller);
+        return nullptr;
     }
 
     // Check if this is an effect shader material
     if (material->GetType() != RE::BSShaderMaterial::Type::kEffect) {
-        spdlog::error("TextureManipulator::SetTexture - Material type is NOT kEffect (type={}), cannot set texture",
-            static_cast<int>(material->GetType()));
+        spdlog::error("TextureManipulator::{} - Material type is NOT kEffect (type={}), cannot set texture",
+            caller, static_cast<int>(material->GetType()));
+        return nullptr;
+    }
+
+    outGeometry = geometry;
+    outShaderProperty = shaderProperty;
+    return static_cast<RE::BSEffectShaderMaterial*>(material);
+}
+
+bool TextureManipulator::SetTexture(RE::NiAVObject* node, const char* texturePath,
+                                    float priority, TextureRequestToken* token) {
+
+    if (!node || !texturePath) {
+        spdlog::error("TextureManipulator::SetTexture - null node or texturePath");
         return false;
     }
 
-    auto* effectMaterial = static_cast<RE::BSEffectShaderMaterial*>(material);
-    std::string pathKey(texturePath);
+    RE::BSGeometry* geometry = nullptr;
+    RE::BSShaderProperty* shaderProperty = nullptr;
+    auto* effectMaterial = GetEffectMaterial(node, "SetTexture", geometry, shaderProperty);
+    if (!effectMaterial) {
+        return false;
+    }
+    InternedString pathKey(texturePath);
 
     // Use AsyncTextureLoader for non-blocking texture loading
     // The loader returns immediately with either:
@@ -115,12 +133,12 @@ bool TextureManipulator::SetTexture(RE::NiAVObject* node, const char* texturePat
 
     if (!texture) {
         // Not in async cache - request async load with callback for texture swap
-        // Capture necessary pointers for the callback (weak references would be safer in production)
+        // Capture necessary pointers for the callback - owners cancel the token before the node goes away
         texture = asyncLoader.RequestTexture(pathKey,
             [geometry, shaderProperty, effectMaterial, pathKey](RE::NiPointer<RE::NiTexture> loadedTexture) {
                 // Callback fires on main thread when texture load completes
                 if (!loadedTexture) {
-                    spdlog::error("TextureManipulator: Async load FAILED for '{}'", pathKey);
+                    spdlog::error("TextureManipulator: Async load FAILED for '{}'", pathKey.view());
                     return;
                 }
 
@@ -132,8 +150,9 @@ bool TextureManipulator::SetTexture(RE::NiAVObject* node, const char* texturePat
                 shaderProperty->SetupGeometry(geometry);
                 shaderProperty->FinishSetupGeometry(geometry);
 
-                spdlog::trace("TextureManipulator: Async texture swap complete for '{}'", pathKey);
-            });
+                spdlog::trace("TextureManipulator: Async texture swap complete for '{}'", pathKey.view());
+            },
+            priority, token);
 
         if (!texture) {
             spdlog::error("TextureManipulator::SetTexture - FAILED to get texture or placeholder for '{}'", texturePath);
@@ -166,6 +185,31 @@ bool TextureManipulator::SetTexture(RE::NiAVObject* node, const char* texturePat
     return true;
 }
 
+bool TextureManipulator::SetAtlasTexture(RE::NiAVObject* node, RE::NiSourceTexture* page, const AtlasUV& uv) {
+    if (!node || !page) {
+        spdlog::error("TextureManipulator::SetAtlasTexture - null node or page");
+        return false;
+    }
+
+    RE::BSGeometry* geometry = nullptr;
+    RE::BSShaderProperty* shaderProperty = nullptr;
+    auto* effectMaterial = GetEffectMaterial(node, "SetAtlasTexture", geometry, shaderProperty);
+    if (!effectMaterial) {
+        return false;
+    }
+
+    // Pages never load asynchronously - bind directly, then select the icon's sub-rect
+    effectMaterial->sourceTexture.reset(page);
+    SetMaterialUV(geometry, uv.offsetX, uv.offsetY, uv.scaleX, uv.scaleY);
+
+    // Same rebind as SetTexture() - required for the texture change to take effect
+    shaderProperty->SetMaterial(effectMaterial, true);
+    shaderProperty->SetupGeometry(geometry);
+    shaderProperty->FinishSetupGeometry(geometry);
+
+    return true;
+}
+
 bool TextureManipulator::SetMaterialUV(RE::BSGeometry* geometry,
                                         float offsetX, float offsetY,
                                         float scaleX, float scaleY) {
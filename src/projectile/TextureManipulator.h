@@ -1,6 +1,8 @@
 #pragma once
 
 #include "TextAssets.h"
+#include "IconAtlasLayout.h"
+#include "TextureRequestQueue.h"
 
 #if !defined(TEST_ENVIRONMENT)
 #include "RE/Skyrim.h"
@@ -26,12 +28,21 @@ public:
     // Set UV coordinates to display a specific character from the atlas
     static bool SetCharUV(RE::NiAVObject* node, const TextAssets::UVCoord& uv);
     static bool SetCharUV(RE::NiAVObject* node, int col, int row);
+    // Same for an atlas with an atlasCols x atlasRows grid (font atlases other than the main one)
+    static bool SetCharUV(RE::NiAVObject* node, const TextAssets::UVCoord& uv, int atlasCols, int atlasRows);
 
     // Hide a character by setting UV scale to zero
     static bool HideCharacter(RE::NiAVObject* node);
 
     // Set the texture on a node's material (for effect shaders)
-    static bool SetTexture(RE::NiAVObject* node, const char* texturePath);
+    // If the texture isn't loaded yet, a placeholder is shown and the load queued at priority
+    // (lower loads first); token then receives a handle to cancel the pending swap
+    static bool SetTexture(RE::NiAVObject* node, const char* texturePath,
+                           float priority = 0.0f, TextureRequestToken* token = nullptr);
+
+    // Show one icon of a shared atlas page (see IconAtlas): binds the page texture and
+    // selects the icon's sub-rect through the material UVs
+    static bool SetAtlasTexture(RE::NiAVObject* node, RE::NiSourceTexture* page, const AtlasUV& uv);
 
     // =========================================================================
     // Character Node Access
@@ -67,6 +78,11 @@ public:
     static void ShowNodeByPosition(RE::NiAVObject* node);
 
 private:
+    // Effect shader material of a geometry node, or nullptr (logged as caller) if it has none
+    static RE::BSEffectShaderMaterial* GetEffectMaterial(RE::NiAVObject* node, const char* caller,
+                                                         RE::BSGeometry*& outGeometry,
+                                                         RE::BSShaderProperty*& outShaderProperty);
+
     // Internal helper to set material UV offset and scale
     static bool SetMaterialUV(RE::BSGeometry* geometry,
                               float offsetX, float offsetY,
@@ -0,0 +1,82 @@
+#include "TextureRequestQueue.h"
+
+#include <algorithm>
+
+namespace Projectile {
+
+namespace {
+    // Added to hidden icons so even the farthest visible icon goes first
+    constexpr float HIDDEN_PRIORITY_OFFSET = 1.0e6f;
+}
+
+float TextureRequestQueue::MakePriority(bool visible, float distanceToHmd) {
+    float distance = (std::max)(distanceToHmd, 0.0f);
+    return visible ? distance : HIDDEN_PRIORITY_OFFSET + distance;
+}
+
+void TextureRequestQueue::Push(Key key, uint64_t requestId, float priority) {
+    m_requestKeys[requestId] = key;
+
+    auto [it, inserted] = m_entries.try_emplace(key);
+    Entry& entry = it->second;
+    entry.requests.push_back(requestId);
+
+    if (inserted) {
+        entry.priority = priority;
+        entry.firstRequest = Clock::now();
+    } else if (priority < entry.priority) {
+        entry.priority = priority;  // Re-queue at the more urgent position
+    } else {
+        return;
+    }
+
+    entry.sequence = m_nextSequence++;
+    m_heap.push({entry.priority, entry.sequence, key});
+}
+
+bool TextureRequestQueue::Cancel(uint64_t requestId) {
+    auto keyIt = m_requestKeys.find(requestId);
+    if (keyIt == m_requestKeys.end()) {
+        return false;
+    }
+    Key key = keyIt->second;
+    m_requestKeys.erase(keyIt);
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        return false;
+    }
+    auto& requests = it->second.requests;
+    requests.erase(std::remove(requests.begin(), requests.end(), requestId), requests.end());
+    if (!requests.empty()) {
+        return false;
+    }
+
+    // Nobody wants it any more - its heap node goes stale
+    m_entries.erase(it);
+    ++m_dropped;
+    return true;
+}
+
+bool TextureRequestQueue::Pop(Key& key, Clock::duration& waited) {
+    while (!m_heap.empty()) {
+        HeapNode node = m_heap.top();
+        m_heap.pop();
+
+        auto it = m_entries.find(node.key);
+        if (it == m_entries.end() || it->second.sequence != node.sequence) {
+            continue;  // Cancelled or re-queued since
+        }
+
+        key = node.key;
+        waited = Clock::now() - it->second.firstRequest;
+        for (uint64_t requestId : it->second.requests) {
+            m_requestKeys.erase(requestId);
+        }
+        m_entries.erase(it);
+        return true;
+    }
+    return false;
+}
+
+} // namespace Projectile
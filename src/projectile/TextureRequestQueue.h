@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include "../util/StringTable.h"
+
+namespace Projectile {
+
+// Handle for one AsyncTextureLoader::RequestTexture call. Cancelling it drops its callback,
+// and the queued load too if no other request still wants that texture.
+struct TextureRequestToken {
+    InternedString path;
+    uint64_t id = 0;
+
+    bool IsValid() const { return id != 0; }
+};
+
+// =============================================================================
+// TextureRequestQueue
+// Priority queue of texture loads for AsyncTextureLoader's workers (not thread-safe -
+// the loader guards it with its queue mutex).
+//
+// - Lower priority values load first; equal priorities load in request order
+// - Requests for a texture that's already queued merge into one load, which takes the
+//   most urgent priority among them
+// - Requests carry caller-assigned IDs; once every request for a queued texture is
+//   cancelled, the load is dropped before a worker ever sees it
+// =============================================================================
+class TextureRequestQueue {
+public:
+    using Key = uint32_t;  // Interned texture path ID
+    using Clock = std::chrono::steady_clock;
+
+    // Priority for an icon: anything visible goes before anything hidden, nearer to the
+    // HMD before farther away
+    static float MakePriority(bool visible, float distanceToHmd);
+
+    // Queue a load (or join the queued one) for request requestId (unique, non-zero)
+    void Push(Key key, uint64_t requestId, float priority);
+
+    // Cancel a request. Returns true if that dropped the queued load.
+    // Requests whose load was already popped are ignored.
+    bool Cancel(uint64_t requestId);
+
+    // Take the most urgent load. waited = time since its first request.
+    bool Pop(Key& key, Clock::duration& waited);
+
+    bool Contains(Key key) const { return m_entries.contains(key); }
+    size_t Size() const { return m_entries.size(); }
+    bool Empty() const { return m_entries.empty(); }
+
+    // Loads dropped because all their requests were cancelled (lifetime total)
+    uint64_t GetDroppedCount() const { return m_dropped; }
+
+private:
+    struct Entry {
+        float priority = 0.0f;
+        uint64_t sequence = 0;           // Matches the entry's live heap node
+        Clock::time_point firstRequest;
+        std::vector<uint64_t> requests;  // Live request IDs
+    };
+
+    struct HeapNode {
+        float priority;
+        uint64_t sequence;
+        Key key;
+
+        // std::priority_queue is a max-heap: "less" = later
+        bool operator<(const HeapNode& other) const {
+            if (priority != other.priority) {
+                return priority > other.priority;
+            }
+            return sequence > other.sequence;
+        }
+    };
+
+    std::unordered_map<Key, Entry> m_entries;
+    std::unordered_map<uint64_t, Key> m_requestKeys;  // Live request ID -> key
+    std::priority_queue<HeapNode> m_heap;             // Stale nodes are skipped on Pop
+    uint64_t m_nextSequence = 1;
+    uint64_t m_dropped = 0;
+};
+
+} // namespace Projectile
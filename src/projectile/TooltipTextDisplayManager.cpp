@@ -33,7 +33,7 @@ void TooltipTextDisplayManager::Initialize() {
 
     auto rightText = std::make_shared<Projectile::TextDriver>();
     rightText->SetTextScale(m_textScale);
-    rightText->SetTransitionMode(Projectile::TransitionMode::Lerp);
+    rightText->SetTransitionMode(Projectile::TransitionMode::Slerp);
     rightText->SetSmoothingSpeed(15);
     rightText->SetAlignment(Projectile::TextAlignment::Center);
     m_rightHand.textDriver = rightText.get();
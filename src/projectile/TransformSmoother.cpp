@@ -1,12 +1,26 @@
 #include "TransformSmoother.h"
+#include "IPositionable.h"  // For quaternion helpers
 #include <cmath>
 
 namespace Projectile {
 
+void TransformSmoother::SetMode(TransitionMode mode) {
+    if (mode == TransitionMode::Slerp && m_mode != TransitionMode::Slerp) {
+        // Other modes don't maintain the quaternions - resync from the matrices
+        m_currentQuat = MatrixToQuaternion(m_current.rotation);
+        m_targetQuat = MatrixToQuaternion(m_target.rotation);
+    }
+    m_mode = mode;
+}
+
 void TransformSmoother::SetTarget(const ProjectileTransform& target) {
+    // Most retargets keep the rotation - only re-derive the quaternion when it changed
+    if (m_mode == TransitionMode::Slerp && !NearlyEqual(target.rotation, m_target.rotation, 0.0f)) {
+        m_targetQuat = MatrixToQuaternion(target.rotation);
+    }
     m_target = target;
 
-    if (m_mode == TransitionMode::Lerp) {
+    if (IsSmoothedMode(m_mode)) {
         m_isTransitioning = true;
     } else {
         // Instant mode - apply immediately
@@ -17,6 +31,7 @@ void TransformSmoother::SetTarget(const ProjectileTransform& target) {
 
 void TransformSmoother::SetCurrent(const ProjectileTransform& current) {
     m_current = current;
+    m_currentQuat = MatrixToQuaternion(current.rotation);
 }
 
 bool TransformSmoother::Update(float deltaTime) {
@@ -24,9 +39,48 @@ bool TransformSmoother::Update(float deltaTime) {
         return false;
     }
 
+    if (!ClampDeltaTime(deltaTime)) {
+        return false;  // Skip this frame, don't corrupt state
+    }
+
+    float smoothFactor = ComputeSmoothFactor(m_speed, deltaTime);
+
+    // Smoothly interpolate position toward target
+    m_current.position.x += (m_target.position.x - m_current.position.x) * smoothFactor;
+    m_current.position.y += (m_target.position.y - m_current.position.y) * smoothFactor;
+    m_current.position.z += (m_target.position.z - m_current.position.z) * smoothFactor;
+
+    if (m_mode == TransitionMode::Slerp) {
+        // Slerp in quaternion space with the same factor - avoids popping on sharp facing changes
+        m_currentQuat = SlerpQuaternion(m_currentQuat, m_targetQuat, smoothFactor);
+        m_current.rotation = QuaternionToMatrix(m_currentQuat);
+    } else {
+        // Snap rotation (no interpolation) - use Slerp mode for smoothed rotation
+        // For billboard tracking, snapping is fine since rotation updates every frame anyway
+        m_current.rotation = m_target.rotation;
+    }
+
+    // Smoothly interpolate scale
+    m_current.scale += (m_target.scale - m_current.scale) * smoothFactor;
+
+    // Converged - snap to target and end the transition
+    if (IsConverged(m_current.position.x, m_target.position.x, CONVERGED_POSITION_EPSILON) &&
+        IsConverged(m_current.position.y, m_target.position.y, CONVERGED_POSITION_EPSILON) &&
+        IsConverged(m_current.position.z, m_target.position.z, CONVERGED_POSITION_EPSILON) &&
+        IsConverged(m_current.scale, m_target.scale, CONVERGED_SCALE_EPSILON) &&
+        (m_mode != TransitionMode::Slerp || IsRotationConverged(m_currentQuat, m_targetQuat))) {
+        m_current = m_target;
+        m_currentQuat = m_targetQuat;
+        m_isTransitioning = false;
+    }
+
+    return true;
+}
+
+bool TransformSmoother::ClampDeltaTime(float& deltaTime) {
     // Validate deltaTime - game freeze/resume can produce NaN or huge values
     if (!std::isfinite(deltaTime) || deltaTime <= 0.0f) {
-        return false;  // Skip this frame, don't corrupt state
+        return false;
     }
 
     // Cap deltaTime to avoid excessive jumps after long pauses
@@ -34,36 +88,32 @@ bool TransformSmoother::Update(float deltaTime) {
     if (deltaTime > MAX_DELTA) {
         deltaTime = MAX_DELTA;
     }
+    return true;
+}
 
+float TransformSmoother::ComputeSmoothFactor(float speed, float deltaTime) {
     // Exponential smoothing - continuously chase the target
     // smoothFactor = 1 - exp(-speed * deltaTime)
     // Higher speed = more responsive (10 = snappy, 2 = floaty)
-
-    float smoothFactor = 1.0f - std::exp(-m_speed * deltaTime);
+    float smoothFactor = 1.0f - std::exp(-speed * deltaTime);
 
     // Clamp to valid range [0, 1]
     if (smoothFactor < 0.0f) smoothFactor = 0.0f;
     if (smoothFactor > 1.0f) smoothFactor = 1.0f;
+    return smoothFactor;
+}
 
-    // Smoothly interpolate position toward target
-    m_current.position.x += (m_target.position.x - m_current.position.x) * smoothFactor;
-    m_current.position.y += (m_target.position.y - m_current.position.y) * smoothFactor;
-    m_current.position.z += (m_target.position.z - m_current.position.z) * smoothFactor;
-
-    // Snap rotation (no interpolation) - proper matrix interpolation would require quaternion slerp
-    // For billboard tracking, snapping is fine since rotation updates every frame anyway
-    m_current.rotation = m_target.rotation;
-
-    // Smoothly interpolate scale
-    m_current.scale += (m_target.scale - m_current.scale) * smoothFactor;
-
-    return true;
+bool TransformSmoother::IsRotationConverged(const RE::NiQuaternion& current, const RE::NiQuaternion& target) {
+    float dot = current.w * target.w + current.x * target.x + current.y * target.y + current.z * target.z;
+    return std::abs(dot) >= CONVERGED_ROTATION_DOT;
 }
 
 void TransformSmoother::Reset() {
     m_isTransitioning = false;
     m_target = ProjectileTransform();
     m_current = ProjectileTransform();
+    m_targetQuat = RE::NiQuaternion(1.0f, 0.0f, 0.0f, 0.0f);
+    m_currentQuat = RE::NiQuaternion(1.0f, 0.0f, 0.0f, 0.0f);
 }
 
 } // namespace Projectile
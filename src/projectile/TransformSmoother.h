@@ -7,9 +7,15 @@ namespace Projectile {
 // How position changes are applied
 enum class TransitionMode {
     Instant,        // Position changes immediately (default)
-    Lerp            // Position interpolates over time
+    Lerp,           // Position interpolates over time, rotation snaps to target
+    Slerp           // Like Lerp, but rotation also slerps (quaternion space) with the same factor
 };
 
+// True for modes that smooth toward the target over time (anything but Instant)
+inline bool IsSmoothedMode(TransitionMode mode) {
+    return mode != TransitionMode::Instant;
+}
+
 // Handles smooth interpolation of transform changes over time.
 // Uses exponential smoothing for responsive, natural-feeling transitions.
 class TransformSmoother {
@@ -17,7 +23,7 @@ public:
     TransformSmoother() = default;
 
     // === Mode ===
-    void SetMode(TransitionMode mode) { m_mode = mode; }
+    void SetMode(TransitionMode mode);
     TransitionMode GetMode() const { return m_mode; }
 
     // === Smoothing Speed ===
@@ -47,12 +53,35 @@ public:
     // Reset transition state
     void Reset();
 
+    // === Shared Math (also used by TransformStore's batch update) ===
+    // Validate and cap deltaTime. Returns false if the frame should be skipped.
+    static bool ClampDeltaTime(float& deltaTime);
+
+    // smoothFactor = 1 - exp(-speed * deltaTime), clamped to [0, 1]
+    static float ComputeSmoothFactor(float speed, float deltaTime);
+
+    // Once every component is within these tolerances of the target, the transition snaps to
+    // the target and ends (IsTransitioning() becomes false) so the owner can go to rest
+    static constexpr float CONVERGED_POSITION_EPSILON = 0.01f;   // Game units
+    static constexpr float CONVERGED_SCALE_EPSILON = 0.0001f;
+    static constexpr float CONVERGED_ROTATION_DOT = 0.999999f;   // |dot| of unit quaternions (Slerp)
+
+    static bool IsConverged(float current, float target, float epsilon) {
+        return current - target <= epsilon && target - current <= epsilon;
+    }
+    static bool IsRotationConverged(const RE::NiQuaternion& current, const RE::NiQuaternion& target);
+
 private:
     TransitionMode m_mode = TransitionMode::Lerp;
     float m_speed = 13.0f;
     bool m_isTransitioning = false;
     ProjectileTransform m_target;
     ProjectileTransform m_current;
+
+    // Slerp mode only. The target quaternion is re-derived only when the target rotation
+    // changes; while transitioning, Update() rebuilds the current matrix from the slerp
+    RE::NiQuaternion m_targetQuat{1.0f, 0.0f, 0.0f, 0.0f};
+    RE::NiQuaternion m_currentQuat{1.0f, 0.0f, 0.0f, 0.0f};
 };
 
 } // namespace Projectile
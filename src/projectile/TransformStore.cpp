@@ -0,0 +1,349 @@
+#include "TransformStore.h"
+#include "IPositionable.h"  // For quaternion helpers
+
+namespace Projectile {
+
+TransformStore& TransformStore::GetSingleton() {
+    static TransformStore instance;
+    return instance;
+}
+
+TransformStore::TransformStore()
+    : m_simdLevel(SmoothingKernels::DetectSimdLevel()) {}
+
+TransformHandle TransformStore::Allocate() {
+    uint32_t sparse;
+    if (!m_freeIndices.empty()) {
+        sparse = m_freeIndices.back();
+        m_freeIndices.pop_back();
+    } else {
+        sparse = static_cast<uint32_t>(m_sparseToDense.size());
+        m_sparseToDense.push_back(TransformHandle::INVALID_INDEX);
+        m_generations.push_back(0);
+    }
+
+    uint32_t dense = static_cast<uint32_t>(m_denseToSparse.size());
+    m_sparseToDense[sparse] = dense;
+    m_denseToSparse.push_back(sparse);
+
+    // Defaults match a freshly constructed TransformSmoother
+    const ProjectileTransform identity;
+    const RE::NiQuaternion identityQuat(1.0f, 0.0f, 0.0f, 0.0f);
+    m_currentX.push_back(identity.position.x);
+    m_currentY.push_back(identity.position.y);
+    m_currentZ.push_back(identity.position.z);
+    m_currentScale.push_back(identity.scale);
+    m_targetX.push_back(identity.position.x);
+    m_targetY.push_back(identity.position.y);
+    m_targetZ.push_back(identity.position.z);
+    m_targetScale.push_back(identity.scale);
+    m_currentRotation.push_back(identity.rotation);
+    m_targetRotation.push_back(identity.rotation);
+    m_currentQuat.push_back(identityQuat);
+    m_targetQuat.push_back(identityQuat);
+    m_speed.push_back(13.0f);
+    m_elapsed.push_back(0.0f);
+    m_mode.push_back(TransitionMode::Lerp);
+    m_flags.push_back(0);
+    m_output.push_back(nullptr);
+
+    return TransformHandle{sparse, m_generations[sparse]};
+}
+
+void TransformStore::Release(TransformHandle handle) {
+    uint32_t dense = DenseIndex(handle);
+    if (dense == TransformHandle::INVALID_INDEX) {
+        return;
+    }
+
+    // Swap-remove: move the last dense slot into the hole
+    uint32_t last = static_cast<uint32_t>(m_denseToSparse.size() - 1);
+    if (dense != last) {
+        uint32_t movedSparse = m_denseToSparse[last];
+        m_denseToSparse[dense] = movedSparse;
+        m_sparseToDense[movedSparse] = dense;
+
+        m_currentX[dense] = m_currentX[last];
+        m_currentY[dense] = m_currentY[last];
+        m_currentZ[dense] = m_currentZ[last];
+        m_currentScale[dense] = m_currentScale[last];
+        m_targetX[dense] = m_targetX[last];
+        m_targetY[dense] = m_targetY[last];
+        m_targetZ[dense] = m_targetZ[last];
+        m_targetScale[dense] = m_targetScale[last];
+        m_currentRotation[dense] = m_currentRotation[last];
+        m_targetRotation[dense] = m_targetRotation[last];
+        m_currentQuat[dense] = m_currentQuat[last];
+        m_targetQuat[dense] = m_targetQuat[last];
+        m_speed[dense] = m_speed[last];
+        m_elapsed[dense] = m_elapsed[last];
+        m_mode[dense] = m_mode[last];
+        m_flags[dense] = m_flags[last];
+        m_output[dense] = m_output[last];
+    }
+
+    m_denseToSparse.pop_back();
+    m_currentX.pop_back();
+    m_currentY.pop_back();
+    m_currentZ.pop_back();
+    m_currentScale.pop_back();
+    m_targetX.pop_back();
+    m_targetY.pop_back();
+    m_targetZ.pop_back();
+    m_targetScale.pop_back();
+    m_currentRotation.pop_back();
+    m_targetRotation.pop_back();
+    m_currentQuat.pop_back();
+    m_targetQuat.pop_back();
+    m_speed.pop_back();
+    m_elapsed.pop_back();
+    m_mode.pop_back();
+    m_flags.pop_back();
+    m_output.pop_back();
+
+    m_sparseToDense[handle.index] = TransformHandle::INVALID_INDEX;
+    ++m_generations[handle.index];
+    m_freeIndices.push_back(handle.index);
+}
+
+bool TransformStore::IsAlive(TransformHandle handle) const {
+    return DenseIndex(handle) != TransformHandle::INVALID_INDEX;
+}
+
+uint32_t TransformStore::DenseIndex(TransformHandle handle) const {
+    if (handle.index >= m_sparseToDense.size() || m_generations[handle.index] != handle.generation) {
+        return TransformHandle::INVALID_INDEX;
+    }
+    return m_sparseToDense[handle.index];
+}
+
+void TransformStore::SetMode(TransformHandle handle, TransitionMode mode) {
+    uint32_t i = DenseIndex(handle);
+    if (i == TransformHandle::INVALID_INDEX) {
+        return;
+    }
+    if (mode == TransitionMode::Slerp && m_mode[i] != TransitionMode::Slerp) {
+        // Other modes don't maintain the quaternions - resync from the matrices
+        m_currentQuat[i] = MatrixToQuaternion(m_currentRotation[i]);
+        m_targetQuat[i] = MatrixToQuaternion(m_targetRotation[i]);
+    }
+    m_mode[i] = mode;
+}
+
+TransitionMode TransformStore::GetMode(TransformHandle handle) const {
+    uint32_t i = DenseIndex(handle);
+    return i != TransformHandle::INVALID_INDEX ? m_mode[i] : TransitionMode::Lerp;
+}
+
+void TransformStore::SetSpeed(TransformHandle handle, float speed) {
+    uint32_t i = DenseIndex(handle);
+    if (i != TransformHandle::INVALID_INDEX) {
+        m_speed[i] = speed;
+    }
+}
+
+float TransformStore::GetSpeed(TransformHandle handle) const {
+    uint32_t i = DenseIndex(handle);
+    return i != TransformHandle::INVALID_INDEX ? m_speed[i] : 0.0f;
+}
+
+void TransformStore::WriteCurrent(uint32_t i, const ProjectileTransform& transform) {
+    m_currentX[i] = transform.position.x;
+    m_currentY[i] = transform.position.y;
+    m_currentZ[i] = transform.position.z;
+    m_currentRotation[i] = transform.rotation;
+    m_currentScale[i] = transform.scale;
+    if (m_mode[i] == TransitionMode::Slerp) {
+        m_currentQuat[i] = MatrixToQuaternion(transform.rotation);
+    }
+}
+
+void TransformStore::WriteTarget(uint32_t i, const ProjectileTransform& transform) {
+    m_targetX[i] = transform.position.x;
+    m_targetY[i] = transform.position.y;
+    m_targetZ[i] = transform.position.z;
+    m_targetScale[i] = transform.scale;
+    // Most retargets keep the rotation - only re-derive the quaternion when it changed
+    if (m_mode[i] == TransitionMode::Slerp && !NearlyEqual(transform.rotation, m_targetRotation[i], 0.0f)) {
+        m_targetQuat[i] = MatrixToQuaternion(transform.rotation);
+    }
+    m_targetRotation[i] = transform.rotation;
+}
+
+ProjectileTransform TransformStore::ReadCurrent(uint32_t i) const {
+    ProjectileTransform transform;
+    transform.position = RE::NiPoint3(m_currentX[i], m_currentY[i], m_currentZ[i]);
+    transform.rotation = m_currentRotation[i];
+    transform.scale = m_currentScale[i];
+    return transform;
+}
+
+void TransformStore::SetTarget(TransformHandle handle, const ProjectileTransform& target) {
+    uint32_t i = DenseIndex(handle);
+    if (i == TransformHandle::INVALID_INDEX) {
+        return;
+    }
+
+    WriteTarget(i, target);
+    if (IsSmoothedMode(m_mode[i])) {
+        m_flags[i] |= FLAG_TRANSITIONING;
+    } else {
+        // Instant mode - apply immediately
+        WriteCurrent(i, target);
+        m_flags[i] &= ~FLAG_TRANSITIONING;
+    }
+}
+
+void TransformStore::SetCurrent(TransformHandle handle, const ProjectileTransform& current) {
+    uint32_t i = DenseIndex(handle);
+    if (i != TransformHandle::INVALID_INDEX) {
+        WriteCurrent(i, current);
+    }
+}
+
+ProjectileTransform TransformStore::GetTarget(TransformHandle handle) const {
+    uint32_t i = DenseIndex(handle);
+    ProjectileTransform transform;
+    if (i != TransformHandle::INVALID_INDEX) {
+        transform.position = RE::NiPoint3(m_targetX[i], m_targetY[i], m_targetZ[i]);
+        transform.rotation = m_targetRotation[i];
+        transform.scale = m_targetScale[i];
+    }
+    return transform;
+}
+
+ProjectileTransform TransformStore::GetCurrent(TransformHandle handle) const {
+    uint32_t i = DenseIndex(handle);
+    return i != TransformHandle::INVALID_INDEX ? ReadCurrent(i) : ProjectileTransform{};
+}
+
+bool TransformStore::IsTransitioning(TransformHandle handle) const {
+    uint32_t i = DenseIndex(handle);
+    return i != TransformHandle::INVALID_INDEX && (m_flags[i] & FLAG_TRANSITIONING) != 0;
+}
+
+void TransformStore::Reset(TransformHandle handle) {
+    uint32_t i = DenseIndex(handle);
+    if (i == TransformHandle::INVALID_INDEX) {
+        return;
+    }
+    const ProjectileTransform identity;
+    WriteCurrent(i, identity);
+    WriteTarget(i, identity);
+    m_flags[i] = 0;
+    m_output[i] = nullptr;
+}
+
+void TransformStore::Retarget(TransformHandle handle, const ProjectileTransform& target,
+                              const ProjectileTransform* startFrom, float elapsed) {
+    uint32_t i = DenseIndex(handle);
+    if (i == TransformHandle::INVALID_INDEX) {
+        return;
+    }
+
+    // If starting a new transition, initialize from the given (game) position
+    if (startFrom && IsSmoothedMode(m_mode[i]) && !(m_flags[i] & FLAG_TRANSITIONING)) {
+        WriteCurrent(i, *startFrom);
+    }
+    SetTarget(handle, target);
+    m_elapsed[i] = elapsed;
+    m_flags[i] |= FLAG_ACTIVE;
+}
+
+void TransformStore::SetOutput(TransformHandle handle, GameProjectile* output) {
+    uint32_t i = DenseIndex(handle);
+    if (i != TransformHandle::INVALID_INDEX) {
+        m_output[i] = output;
+    }
+}
+
+void TransformStore::SmoothActive(float deltaTime) {
+    if (!TransformSmoother::ClampDeltaTime(deltaTime)) {
+        return;  // Skip this frame, don't corrupt state
+    }
+
+    const size_t count = m_denseToSparse.size();
+    constexpr uint8_t MASK = FLAG_ACTIVE | FLAG_TRANSITIONING;
+
+    // Per-lane smooth factor and update mask. Elements of a driver share one speed and
+    // elapsed time, so exp() is only re-evaluated when either changes
+    m_factor.resize(count);
+    m_laneMask.resize(count);
+    float lastSpeed = 0.0f;
+    float lastDelta = deltaTime;
+    float smoothFactor = TransformSmoother::ComputeSmoothFactor(lastSpeed, deltaTime);
+    bool anyActive = false;
+    for (size_t i = 0; i < count; ++i) {
+        bool active = (m_flags[i] & MASK) == MASK;
+        if (active) {
+            // Owners updated at a reduced rate pass the time since their last update
+            float slotDelta = m_elapsed[i];
+            if (slotDelta <= 0.0f || !TransformSmoother::ClampDeltaTime(slotDelta)) {
+                slotDelta = deltaTime;
+            }
+            if (m_speed[i] != lastSpeed || slotDelta != lastDelta) {
+                lastSpeed = m_speed[i];
+                lastDelta = slotDelta;
+                smoothFactor = TransformSmoother::ComputeSmoothFactor(lastSpeed, lastDelta);
+            }
+        }
+        m_factor[i] = smoothFactor;
+        m_laneMask[i] = active ? 0xFFFFFFFFu : 0u;
+        anyActive |= active;
+    }
+    if (!anyActive) {
+        return;
+    }
+
+    // Position and scale: same math as TransformSmoother::Update, one array at a time
+    using SmoothingKernels::LerpMasked;
+    LerpMasked(m_currentX.data(), m_targetX.data(), m_factor.data(), m_laneMask.data(), count, m_simdLevel);
+    LerpMasked(m_currentY.data(), m_targetY.data(), m_factor.data(), m_laneMask.data(), count, m_simdLevel);
+    LerpMasked(m_currentZ.data(), m_targetZ.data(), m_factor.data(), m_laneMask.data(), count, m_simdLevel);
+    LerpMasked(m_currentScale.data(), m_targetScale.data(), m_factor.data(), m_laneMask.data(), count, m_simdLevel);
+
+    // Rotation snaps to target, or slerps in Slerp mode (see TransformSmoother::Update).
+    // Converged slots snap to their target and stop transitioning, letting their owners rest
+    using TS = TransformSmoother;
+    for (size_t i = 0; i < count; ++i) {
+        if (!m_laneMask[i]) {
+            continue;
+        }
+        bool slerp = m_mode[i] == TransitionMode::Slerp;
+        if (slerp) {
+            m_currentQuat[i] = SlerpQuaternion(m_currentQuat[i], m_targetQuat[i], m_factor[i]);
+            m_currentRotation[i] = QuaternionToMatrix(m_currentQuat[i]);
+        } else {
+            m_currentRotation[i] = m_targetRotation[i];
+        }
+
+        if (TS::IsConverged(m_currentX[i], m_targetX[i], TS::CONVERGED_POSITION_EPSILON) &&
+            TS::IsConverged(m_currentY[i], m_targetY[i], TS::CONVERGED_POSITION_EPSILON) &&
+            TS::IsConverged(m_currentZ[i], m_targetZ[i], TS::CONVERGED_POSITION_EPSILON) &&
+            TS::IsConverged(m_currentScale[i], m_targetScale[i], TS::CONVERGED_SCALE_EPSILON) &&
+            (!slerp || TS::IsRotationConverged(m_currentQuat[i], m_targetQuat[i]))) {
+            m_currentX[i] = m_targetX[i];
+            m_currentY[i] = m_targetY[i];
+            m_currentZ[i] = m_targetZ[i];
+            m_currentScale[i] = m_targetScale[i];
+            m_currentRotation[i] = m_targetRotation[i];
+            m_currentQuat[i] = m_targetQuat[i];
+            m_flags[i] &= ~FLAG_TRANSITIONING;
+        }
+    }
+}
+
+void TransformStore::Update(float deltaTime) {
+    SmoothActive(deltaTime);
+
+    // Publish to bound game projectiles and clear the per-frame active bits
+    const size_t count = m_denseToSparse.size();
+    for (size_t i = 0; i < count; ++i) {
+        if ((m_flags[i] & FLAG_ACTIVE) && m_output[i]) {
+            m_output[i]->SetTransform(ReadCurrent(i));
+        }
+        m_flags[i] &= ~FLAG_ACTIVE;
+    }
+}
+
+} // namespace Projectile
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "GameProjectile.h"
+#include "SmoothingKernels.h"
+#include "TransformSmoother.h"
+#include <cstdint>
+#include <vector>
+
+namespace Projectile {
+
+// Compact handle to a TransformStore slot
+// The generation detects stale handles after a slot is released and reused
+struct TransformHandle {
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+    uint32_t index = INVALID_INDEX;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != INVALID_INDEX; }
+};
+
+// Central structure-of-arrays store for the per-frame transform state of every live
+// ControlledProjectile (current/target position, rotation, scale and smoother settings).
+// Hot data lives in contiguous arrays so the once-per-frame smoothing and publish pass
+// runs as tight linear loops instead of chasing one heap object per projectile.
+//
+// Semantics match TransformSmoother exactly (same formulas, same float operation order).
+// Slots are kept dense: releasing a slot moves the last slot into its place, and handles
+// map to dense indices through a sparse table.
+//
+// NOT thread-safe - call from the main thread only (same as driver/projectile updates).
+class TransformStore {
+public:
+    static TransformStore& GetSingleton();
+
+    TransformStore();
+    TransformStore(const TransformStore&) = delete;
+    TransformStore& operator=(const TransformStore&) = delete;
+
+    // === Slot Lifecycle ===
+    TransformHandle Allocate();
+    void Release(TransformHandle handle);
+    bool IsAlive(TransformHandle handle) const;
+    size_t GetLiveCount() const { return m_denseToSparse.size(); }
+
+    // === Smoother Settings ===
+    void SetMode(TransformHandle handle, TransitionMode mode);
+    TransitionMode GetMode(TransformHandle handle) const;
+    void SetSpeed(TransformHandle handle, float speed);
+    float GetSpeed(TransformHandle handle) const;
+
+    // === Transform State (same semantics as TransformSmoother) ===
+    void SetTarget(TransformHandle handle, const ProjectileTransform& target);
+    void SetCurrent(TransformHandle handle, const ProjectileTransform& current);
+    ProjectileTransform GetTarget(TransformHandle handle) const;
+    ProjectileTransform GetCurrent(TransformHandle handle) const;
+    bool IsTransitioning(TransformHandle handle) const;
+
+    // Reset transition state, transforms and output (same as TransformSmoother::Reset)
+    void Reset(TransformHandle handle);
+
+    // Per-frame retarget used by ControlledProjectile::Update:
+    // if a new Lerp transition is starting and startFrom is given, current is seeded from it;
+    // then the target is set and the slot is marked active for this frame's Update().
+    // elapsed > 0 smooths this slot over that much time instead of the frame delta (owners
+    // the scheduler updates at a reduced rate catch up instead of converging slower).
+    void Retarget(TransformHandle handle, const ProjectileTransform& target,
+                  const ProjectileTransform* startFrom = nullptr, float elapsed = 0.0f);
+
+    // === Output ===
+    // Game projectile that receives the smoothed transform (nullptr while unbound)
+    void SetOutput(TransformHandle handle, GameProjectile* output);
+
+    // === Batch Update ===
+    // Advance smoothing for every slot retargeted since the last Update, publish the result
+    // to bound outputs, then clear the active bits. Called once per frame by DriverUpdateManager.
+    void Update(float deltaTime);
+
+    // Advance smoothing only (no publish, active bits untouched) - exposed for benchmarks
+    void SmoothActive(float deltaTime);
+
+    // Kernel used by SmoothActive. Defaults to the best level the CPU supports;
+    // every level gives bit-identical results, so overriding is only useful for tests
+    void SetSimdLevel(SmoothingKernels::SimdLevel level) { m_simdLevel = level; }
+    SmoothingKernels::SimdLevel GetSimdLevel() const { return m_simdLevel; }
+
+private:
+    enum SlotFlags : uint8_t {
+        FLAG_TRANSITIONING = 1 << 0,
+        FLAG_ACTIVE = 1 << 1        // Retargeted this frame (owner was updated/visible)
+    };
+
+    // Resolve handle to dense index, or INVALID_INDEX if stale
+    uint32_t DenseIndex(TransformHandle handle) const;
+
+    void WriteCurrent(uint32_t i, const ProjectileTransform& transform);
+    void WriteTarget(uint32_t i, const ProjectileTransform& transform);
+    ProjectileTransform ReadCurrent(uint32_t i) const;
+
+    // Sparse table: handle index -> dense index (+ generation for stale detection)
+    std::vector<uint32_t> m_sparseToDense;
+    std::vector<uint32_t> m_generations;
+    std::vector<uint32_t> m_freeIndices;
+
+    // Dense arrays (one entry per live slot)
+    std::vector<uint32_t> m_denseToSparse;
+    std::vector<float> m_currentX, m_currentY, m_currentZ, m_currentScale;
+    std::vector<float> m_targetX, m_targetY, m_targetZ, m_targetScale;
+    std::vector<RE::NiMatrix3> m_currentRotation;
+    std::vector<RE::NiMatrix3> m_targetRotation;
+    std::vector<RE::NiQuaternion> m_currentQuat;    // Maintained only for Slerp-mode slots
+    std::vector<RE::NiQuaternion> m_targetQuat;     // Re-derived only when the target rotation changes
+    std::vector<float> m_speed;
+    std::vector<float> m_elapsed;   // Time since the owner's last update (0 = frame delta)
+    std::vector<TransitionMode> m_mode;
+    std::vector<uint8_t> m_flags;
+    std::vector<GameProjectile*> m_output;
+
+    // Per-frame scratch for the batch kernels (sized to the dense arrays, reused across frames)
+    std::vector<float> m_factor;
+    std::vector<uint32_t> m_laneMask;
+
+    SmoothingKernels::SimdLevel m_simdLevel;
+};
+
+} // namespace Projectile
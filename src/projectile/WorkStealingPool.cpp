@@ -0,0 +1,138 @@
+#include "WorkStealingPool.h"
+
+namespace Projectile {
+
+WorkStealingPool::~WorkStealingPool() {
+    Stop();
+}
+
+void WorkStealingPool::Start(size_t workerCount) {
+    Stop();
+
+    m_queues.clear();
+    for (size_t i = 0; i <= workerCount; ++i) {
+        m_queues.push_back(std::make_unique<Queue>());
+    }
+
+    m_stopping = false;
+    for (size_t i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&WorkStealingPool::WorkerLoop, this, i);
+    }
+}
+
+void WorkStealingPool::Stop() {
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+}
+
+void WorkStealingPool::ParallelFor(size_t count, const Task& task) {
+    if (count == 0) {
+        return;
+    }
+    if (m_workers.empty() || count == 1) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    // Deal the tasks round-robin before waking anyone, so no worker sees a half-filled queue
+    const size_t queueCount = m_queues.size();
+    for (size_t i = 0; i < count; ++i) {
+        auto& queue = *m_queues[i % queueCount];
+        std::lock_guard lock(queue.mutex);
+        queue.items.push_back(i);
+    }
+    m_remaining.store(count, std::memory_order_release);
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_job = &task;
+        ++m_jobId;
+    }
+    m_wake.notify_all();
+
+    RunAvailable(queueCount - 1, task);
+
+    // Wait for the last tasks and for every worker to let go of the job before it goes out of scope
+    std::unique_lock lock(m_mutex);
+    m_done.wait(lock, [this]() {
+        return m_remaining.load(std::memory_order_acquire) == 0 && m_activeWorkers == 0;
+    });
+    m_job = nullptr;
+}
+
+void WorkStealingPool::WorkerLoop(size_t queueIndex) {
+    uint64_t seenJob = 0;
+    while (true) {
+        const Task* job = nullptr;
+        {
+            std::unique_lock lock(m_mutex);
+            m_wake.wait(lock, [&]() { return m_stopping || m_jobId != seenJob; });
+            if (m_stopping) {
+                return;
+            }
+            seenJob = m_jobId;
+            job = m_job;
+            if (!job) {
+                continue;  // Woke after the job already finished
+            }
+            ++m_activeWorkers;
+        }
+
+        RunAvailable(queueIndex, *job);
+
+        {
+            std::lock_guard lock(m_mutex);
+            --m_activeWorkers;
+        }
+        m_done.notify_all();
+    }
+}
+
+void WorkStealingPool::RunAvailable(size_t queueIndex, const Task& task) {
+    size_t item = 0;
+    while (PopLocal(queueIndex, item) || Steal(queueIndex, item)) {
+        task(item);
+        if (m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            // Last task - take the lock so the caller can't miss the notification
+            { std::lock_guard lock(m_mutex); }
+            m_done.notify_all();
+        }
+    }
+}
+
+bool WorkStealingPool::PopLocal(size_t queueIndex, size_t& item) {
+    auto& queue = *m_queues[queueIndex];
+    std::lock_guard lock(queue.mutex);
+    if (queue.items.empty()) {
+        return false;
+    }
+    item = queue.items.back();
+    queue.items.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::Steal(size_t thiefIndex, size_t& item) {
+    const size_t queueCount = m_queues.size();
+    for (size_t offset = 1; offset < queueCount; ++offset) {
+        auto& queue = *m_queues[(thiefIndex + offset) % queueCount];
+        std::lock_guard lock(queue.mutex);
+        if (!queue.items.empty()) {
+            item = queue.items.front();
+            queue.items.pop_front();
+            m_stolen.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace Projectile
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Projectile {
+
+// Small fork-join thread pool with work stealing, for short bursts of independent tasks
+// (e.g. one per root driver in DriverUpdateManager's layout compute phase).
+//
+// ParallelFor() deals the task indices out over one queue per worker plus one for the
+// calling thread, which works along instead of idling. A thread that runs out of its own
+// tasks steals from the front of the other queues, so a single expensive task doesn't hold
+// up the tasks queued behind it.
+//
+// ParallelFor() must be called from one thread at a time and never from inside a task.
+class WorkStealingPool {
+public:
+    using Task = std::function<void(size_t)>;
+
+    WorkStealingPool() = default;
+    ~WorkStealingPool();
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // Start workerCount threads (0 = run everything on the calling thread). Restarts if running.
+    void Start(size_t workerCount);
+    void Stop();
+    size_t GetWorkerCount() const { return m_workers.size(); }
+
+    // Run task(0) .. task(count - 1) and return once all of them have finished
+    void ParallelFor(size_t count, const Task& task);
+
+    // Tasks run by a thread other than the one they were queued for (lifetime total)
+    uint64_t GetStolenCount() const { return m_stolen.load(std::memory_order_relaxed); }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<size_t> items;
+    };
+
+    void WorkerLoop(size_t queueIndex);
+    void RunAvailable(size_t queueIndex, const Task& task);
+    bool PopLocal(size_t queueIndex, size_t& item);
+    bool Steal(size_t thiefIndex, size_t& item);
+
+    std::vector<std::thread> m_workers;
+    std::vector<std::unique_ptr<Queue>> m_queues;  // One per worker, the caller's is last
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;   // Workers: new job or stop
+    std::condition_variable m_done;   // Caller: job finished
+    const Task* m_job = nullptr;      // Current job (guarded by m_mutex)
+    uint64_t m_jobId = 0;
+    size_t m_activeWorkers = 0;       // Workers still holding m_job
+    bool m_stopping = false;
+
+    std::atomic<size_t> m_remaining{0};
+    std::atomic<uint64_t> m_stolen{0};
+};
+
+} // namespace Projectile
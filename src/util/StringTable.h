@@ -0,0 +1,161 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace Util {
+
+// Process-wide table of interned strings (model/texture paths, border colors).
+// Each distinct string is stored once and identified by a stable 32-bit ID, so the pipeline
+// compares and hashes IDs instead of string contents. ID 0 is the empty string.
+//
+// Intern() takes a mutex; GetView()/GetCStr() are lock-free and safe from any thread.
+// Strings are never freed, so only intern bounded sets like paths - never free-form text
+// such as tooltips or labels. Chunks double in size, so the table never fills before the
+// 32-bit ID space does.
+class StringTable {
+public:
+    using String = std::string;
+    using View = std::string_view;
+
+    static StringTable& GetSingleton() {
+        static StringTable instance;
+        return instance;
+    }
+
+    // ID of str, adding it on first use
+    uint32_t Intern(View str) {
+        if (str.empty()) {
+            return 0;
+        }
+
+        std::lock_guard lock(m_mutex);
+        auto it = m_ids.find(str);
+        if (it != m_ids.end()) {
+            return it->second;
+        }
+
+        uint32_t id = m_count.load(std::memory_order_relaxed);
+        if (id == UINT32_MAX) {
+            std::abort();  // Out of IDs - handing out "" would silently blank paths
+        }
+        auto [chunk, offset] = Locate(id);
+        if (!m_chunks[chunk]) {
+            m_chunks[chunk] = std::make_unique<String[]>(ChunkSize(chunk));
+        }
+        String& stored = m_chunks[chunk][offset];
+        stored.assign(str);
+        m_bytes += stored.size() + 1;
+
+        // Key views point into the stored string, which never moves
+        m_ids.emplace(View(stored), id);
+        m_count.store(id + 1, std::memory_order_release);  // Publishes the entry to readers
+        return id;
+    }
+
+    View GetView(uint32_t id) const { return View(GetCStr(id), GetSize(id)); }
+
+    const char* GetCStr(uint32_t id) const {
+        const String* stored = Find(id);
+        return stored ? stored->c_str() : m_chunks[0][0].c_str();
+    }
+
+    size_t GetSize(uint32_t id) const {
+        const String* stored = Find(id);
+        return stored ? stored->size() : 0;
+    }
+
+    // Statistics
+    size_t GetCount() const { return m_count.load(std::memory_order_acquire); }  // Includes ""
+    size_t GetBytes() const {
+        std::lock_guard lock(m_mutex);
+        return m_bytes;
+    }
+
+private:
+    // Chunk k holds FIRST_CHUNK_SIZE << k strings
+    static constexpr size_t FIRST_CHUNK_SIZE = 1024;
+    static constexpr size_t MAX_CHUNKS = 23;
+    static_assert(FIRST_CHUNK_SIZE * ((uint64_t{1} << MAX_CHUNKS) - 1) >= UINT32_MAX,
+        "chunks must cover every 32-bit ID");
+
+    static constexpr size_t ChunkSize(size_t chunk) { return FIRST_CHUNK_SIZE << chunk; }
+
+    // Chunk and offset of an ID
+    static std::pair<size_t, size_t> Locate(uint32_t id) {
+        size_t chunk = std::bit_width(uint64_t{id} / FIRST_CHUNK_SIZE + 1) - 1;
+        size_t offset = id - FIRST_CHUNK_SIZE * ((size_t{1} << chunk) - 1);
+        return {chunk, offset};
+    }
+
+    StringTable() {
+        m_chunks[0] = std::make_unique<String[]>(ChunkSize(0));  // Slot 0 stays ""
+        m_ids.emplace(View(m_chunks[0][0]), 0);
+    }
+
+    const String* Find(uint32_t id) const {
+        if (id >= m_count.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        auto [chunk, offset] = Locate(id);
+        return &m_chunks[chunk][offset];
+    }
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<View, uint32_t> m_ids;                      // Guarded by m_mutex
+    std::array<std::unique_ptr<String[]>, MAX_CHUNKS> m_chunks;    // Allocated once, never freed
+    std::atomic<uint32_t> m_count{1};
+    size_t m_bytes = 0;
+};
+
+// 4-byte handle to an interned string. Equality and hashing use the ID only.
+class InternedString {
+public:
+    using Table = StringTable;
+    using View = Table::View;
+
+    InternedString() = default;
+    explicit InternedString(View str) : m_id(Table::GetSingleton().Intern(str)) {}
+    explicit InternedString(const char* str) : InternedString(str ? View(str) : View()) {}
+    explicit InternedString(const std::string& str) : InternedString(View(str)) {}
+
+    // Handle for an ID previously returned by GetId()
+    static InternedString FromId(uint32_t id) {
+        InternedString str;
+        str.m_id = id;
+        return str;
+    }
+
+    uint32_t GetId() const { return m_id; }
+    bool empty() const { return m_id == 0; }
+    size_t size() const { return Table::GetSingleton().GetSize(m_id); }
+    View view() const { return Table::GetSingleton().GetView(m_id); }
+    const char* c_str() const { return Table::GetSingleton().GetCStr(m_id); }
+    std::string str() const { return std::string(view()); }
+
+    bool operator==(const InternedString& other) const { return m_id == other.m_id; }
+    bool operator!=(const InternedString& other) const { return m_id != other.m_id; }
+    friend bool operator==(const InternedString& lhs, View rhs) { return lhs.view() == rhs; }
+
+    struct Hash {
+        size_t operator()(const InternedString& str) const { return std::hash<uint32_t>{}(str.m_id); }
+    };
+
+private:
+    uint32_t m_id = 0;
+};
+
+} // namespace Util
+
+namespace Projectile {
+    using Util::InternedString;
+}